@@ -0,0 +1,211 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_batched_strided.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::Level2Op benchmark_op =
+    blas_benchmark::utils::Level2Op::gemv_batched_strided;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int ti,
+         index_t m, index_t n, scalar_t alpha, scalar_t beta,
+         index_t batch_size, index_t stride_a_mul, index_t stride_x_mul,
+         index_t stride_y_mul, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Standard test setup.
+  std::string ts = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(ti));
+  const char* t_str = ts.c_str();
+
+  index_t xlen = t_str[0] == 'n' ? n : m;
+  index_t ylen = t_str[0] == 'n' ? m : n;
+
+  index_t lda = m;
+  index_t incX = 1;
+  index_t incY = 1;
+
+  blas_benchmark::utils::init_level_2_counters<benchmark_op, scalar_t>(
+      state, t_str, beta, m, n, batch_size, stride_a_mul, stride_x_mul,
+      stride_y_mul);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Strides
+  const index_t stride_a = stride_a_mul * lda * n;
+  const index_t stride_x = stride_x_mul * xlen;
+  const index_t stride_y = stride_y_mul * ylen;
+  // Batched matrices and vectors
+  const index_t size_a_batch = lda * n + (batch_size - 1) * stride_a;
+  const index_t size_x_batch = xlen + (batch_size - 1) * stride_x;
+  const index_t size_y_batch = ylen + (batch_size - 1) * stride_y;
+
+  // Input matrix/vector, output vector.
+  std::vector<scalar_t> m_a =
+      blas_benchmark::utils::random_data<scalar_t>(size_a_batch);
+  std::vector<scalar_t> v_x =
+      blas_benchmark::utils::random_data<scalar_t>(size_x_batch);
+  std::vector<scalar_t> v_y =
+      blas_benchmark::utils::random_data<scalar_t>(size_y_batch);
+
+  auto m_a_gpu = blas::helper::allocate<mem_alloc, scalar_t>(size_a_batch, q);
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, scalar_t>(size_x_batch, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, scalar_t>(size_y_batch, q);
+
+  auto copy_a = blas::helper::copy_to_device<scalar_t>(q, m_a.data(), m_a_gpu,
+                                                       size_a_batch);
+  auto copy_x = blas::helper::copy_to_device<scalar_t>(q, v_x.data(), v_x_gpu,
+                                                       size_x_batch);
+  auto copy_y = blas::helper::copy_to_device<scalar_t>(q, v_y.data(), v_y_gpu,
+                                                       size_y_batch);
+
+  sb_handle.wait({copy_a, copy_x, copy_y});
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> v_y_ref = v_y;
+  for (index_t i = 0; i < batch_size; ++i) {
+    reference_blas::gemv(t_str, m, n, alpha, m_a.data() + i * stride_a, lda,
+                         v_x.data() + i * stride_x, incX, beta,
+                         v_y_ref.data() + i * stride_y, incY);
+  }
+  std::vector<scalar_t> v_y_temp = v_y;
+  {
+    auto v_y_temp_gpu =
+        blas::helper::allocate<mem_alloc, scalar_t>(size_y_batch, q);
+    auto copy_temp = blas::helper::copy_to_device<scalar_t>(
+        q, v_y_temp.data(), v_y_temp_gpu, size_y_batch);
+    sb_handle.wait({copy_temp});
+    auto gemv_event = _gemv_strided_batched(
+        sb_handle, *t_str, m, n, alpha, m_a_gpu, lda, stride_a, v_x_gpu, incX,
+        stride_x, beta, v_y_temp_gpu, incY, stride_y, batch_size);
+    sb_handle.wait({gemv_event});
+    auto copy_out = blas::helper::copy_to_host<scalar_t>(
+        q, v_y_temp_gpu, v_y_temp.data(), size_y_batch);
+    sb_handle.wait({copy_out});
+
+    blas::helper::deallocate<mem_alloc>(v_y_temp_gpu, q);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(v_y_temp, v_y_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    auto event = _gemv_strided_batched(
+        sb_handle, *t_str, m, n, alpha, m_a_gpu, lda, stride_a, v_x_gpu, incX,
+        stride_x, beta, v_y_gpu, incY, stride_y, batch_size);
+    sb_handle.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(
+    blas::SB_Handle* sb_handle_ptr, bool* success, std::string mem_type,
+    std::vector<gemv_batched_strided_param_t<scalar_t>> params) {
+  for (auto p : params) {
+    std::string ts;
+    index_t m, n, batch_size, stride_a_mul, stride_x_mul, stride_y_mul;
+    scalar_t alpha, beta;
+    std::tie(ts, m, n, alpha, beta, batch_size, stride_a_mul, stride_x_mul,
+             stride_y_mul) = p;
+    int t = static_cast<int>(blas_benchmark::utils::to_transpose_enum(ts));
+
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         int t, index_t m, index_t n, scalar_t alpha,
+                         scalar_t beta, index_t batch_size,
+                         index_t stride_a_mul, index_t stride_x_mul,
+                         index_t stride_y_mul, bool* success) {
+      run<scalar_t, mem_alloc>(st, sb_handle_ptr, t, m, n, alpha, beta,
+                               batch_size, stride_a_mul, stride_x_mul,
+                               stride_y_mul, success);
+    };
+    benchmark::RegisterBenchmark(
+        blas_benchmark::utils::get_name<benchmark_op, scalar_t>(
+            ts, m, n, batch_size, stride_a_mul, stride_x_mul, stride_y_mul,
+            mem_type)
+            .c_str(),
+        BM_lambda, sb_handle_ptr, t, m, n, alpha, beta, batch_size,
+        stride_a_mul, stride_x_mul, stride_y_mul, success)
+        ->UseRealTime();
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto gemv_batched_strided_params =
+      blas_benchmark::utils::get_gemv_batched_strided_params<scalar_t>(args);
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      gemv_batched_strided_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      gemv_batched_strided_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, blas::SB_Handle* sb_handle_ptr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,197 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename async_scalar.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::async_scalar;
+
+// Measures the latency of `reductions` back-to-back dot, nrm2, asum or iamax of
+// size n returning their result to the host, with the future versions whose
+// results are read at the end (async = 1), or with the synchronous versions
+// blocking the host twice per call (async = 0).
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string operation, index_t n, int reductions, int async,
+         bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, operation, n, reductions, async);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  std::vector<scalar_t> v_x = blas_benchmark::utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> v_y = blas_benchmark::utils::random_data<scalar_t>(n);
+
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+
+  auto copy_x =
+      blas::helper::copy_to_device<scalar_t>(q, v_x.data(), v_x_gpu, n);
+  auto copy_y =
+      blas::helper::copy_to_device<scalar_t>(q, v_y.data(), v_y_gpu, n);
+
+  sb_handle.wait({copy_x, copy_y});
+
+  const index_t one = 1;
+  std::vector<scalar_t> results(reductions);
+  std::vector<index_t> indices(reductions);
+
+  auto run_sync = [&]() {
+    for (int r = 0; r < reductions; ++r) {
+      if (operation == "dot") {
+        results[r] = _dot(sb_handle, n, v_x_gpu, one, v_y_gpu, one);
+      } else if (operation == "nrm2") {
+        results[r] = _nrm2(sb_handle, n, v_x_gpu, one);
+      } else if (operation == "asum") {
+        results[r] = _asum(sb_handle, n, v_x_gpu, one);
+      } else {
+        indices[r] = _iamax(sb_handle, n, v_x_gpu, one);
+      }
+    }
+  };
+
+  auto run_async = [&]() {
+    if (operation == "iamax") {
+      std::vector<blas::Scalar_Future<index_t>> futures;
+      for (int r = 0; r < reductions; ++r) {
+        futures.push_back(_iamax_async(sb_handle, n, v_x_gpu, one));
+      }
+      for (int r = 0; r < reductions; ++r) {
+        indices[r] = futures[r].get();
+      }
+      return;
+    }
+    std::vector<blas::Scalar_Future<scalar_t>> futures;
+    for (int r = 0; r < reductions; ++r) {
+      if (operation == "dot") {
+        futures.push_back(
+            _dot_async(sb_handle, n, v_x_gpu, one, v_y_gpu, one));
+      } else if (operation == "nrm2") {
+        futures.push_back(_nrm2_async(sb_handle, n, v_x_gpu, one));
+      } else {
+        futures.push_back(_asum_async(sb_handle, n, v_x_gpu, one));
+      }
+    }
+    for (int r = 0; r < reductions; ++r) {
+      results[r] = futures[r].get();
+    }
+  };
+
+  // The results are on the host when the calls return, no event to time
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    if (async) {
+      run_async();
+    } else {
+      run_sync();
+    }
+    return {};
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  // Number of back-to-back reductions
+  const int reductions = 16;
+  for (std::string operation : {"dot", "nrm2", "asum", "iamax"}) {
+    for (auto n : params) {
+      for (int async : {0, 1}) {
+        auto BM_lambda = [&](benchmark::State& st,
+                             blas::SB_Handle* sb_handle_ptr,
+                             std::string operation, index_t n, int reductions,
+                             int async, bool* success) {
+          run<scalar_t, mem_alloc>(st, sb_handle_ptr, operation, n,
+                                   reductions, async, success);
+        };
+        benchmark::RegisterBenchmark(
+            blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+                operation, n, reductions, async, mem_type)
+                .c_str(),
+            BM_lambda, sb_handle_ptr, operation, n, reductions, async,
+            success)
+            ->UseRealTime();
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // Small sizes by default, where the host syncs dominate the latency
+  std::vector<blas1_param_t> async_scalar_params{100, 1000, 10000, 100000};
+  if (!args.csv_param.empty()) {
+    async_scalar_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      async_scalar_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      async_scalar_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
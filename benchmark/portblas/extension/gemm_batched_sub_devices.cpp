@@ -0,0 +1,219 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_batched_sub_devices.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::gemm_batched_sub_devices;
+
+// Measures the scaling of a strided batched gemm spread by a
+// blas::SB_Handle_Group over 1, 2, 4 and 8 sub-devices of the benchmarked
+// device, each sub-device getting an equal share of its compute units. The
+// configurations the device cannot be partitioned into are skipped. The
+// "avg_overall_time" counter is the relevant one, the event time being summed
+// over the sub-devices.
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int t1,
+         int t2, index_t m, index_t k, index_t n, scalar_t alpha, scalar_t beta,
+         index_t batch_size, index_t sub_devices, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Standard test setup.
+  std::string t1s = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(t1));
+  std::string t2s = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(t2));
+  const char* t_a = t1s.c_str();
+  const char* t_b = t2s.c_str();
+
+  const bool trA = t_a[0] != 'n';
+  const bool trB = t_b[0] != 'n';
+
+  index_t lda = trA ? k : m;
+  index_t ldb = trB ? n : k;
+  index_t ldc = m;
+
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, beta, m, n, k, batch_size, sub_devices);
+
+  auto device = sb_handle_ptr->get_queue().get_device();
+  auto sb_handle_group = blas::SB_Handle_Group::create_equally(
+      device, sub_devices, {sycl::property::queue::enable_profiling()});
+  if (sb_handle_group.size() != static_cast<size_t>(sub_devices)) {
+    state.SkipWithError("The device cannot be partitioned in this many parts");
+    return;
+  }
+  auto q = sb_handle_group[0].get_queue();
+
+  // Data sizes
+  const index_t stride_a = m * k;
+  const index_t stride_b = k * n;
+  const index_t stride_c = m * n;
+  const index_t size_a_batch = stride_a * batch_size;
+  const index_t size_b_batch = stride_b * batch_size;
+  const index_t size_c_batch = stride_c * batch_size;
+
+  // Matrices
+  std::vector<scalar_t> a =
+      blas_benchmark::utils::random_data<scalar_t>(size_a_batch);
+  std::vector<scalar_t> b =
+      blas_benchmark::utils::random_data<scalar_t>(size_b_batch);
+  std::vector<scalar_t> c =
+      blas_benchmark::utils::const_data<scalar_t>(size_c_batch, 0);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> c_ref = c;
+  for (int batch_idx = 0; batch_idx < batch_size; batch_idx++) {
+    reference_blas::gemm(t_a, t_b, m, n, k, alpha,
+                         a.data() + batch_idx * stride_a, lda,
+                         b.data() + batch_idx * stride_b, ldb, beta,
+                         c_ref.data() + batch_idx * stride_c, ldc);
+  }
+#endif
+
+  // Shared allocations in the context of the group, usable from all the
+  // sub-devices
+  auto context = sb_handle_group.get_context();
+  auto a_gpu = sycl::malloc_shared<scalar_t>(size_a_batch, device, context);
+  auto b_gpu = sycl::malloc_shared<scalar_t>(size_b_batch, device, context);
+  auto c_gpu = sycl::malloc_shared<scalar_t>(size_c_batch, device, context);
+
+  auto copy_a = q.memcpy(a_gpu, a.data(), sizeof(scalar_t) * size_a_batch);
+  auto copy_b = q.memcpy(b_gpu, b.data(), sizeof(scalar_t) * size_b_batch);
+  auto copy_c = q.memcpy(c_gpu, c.data(), sizeof(scalar_t) * size_c_batch);
+
+  sb_handle_group.wait({copy_a, copy_b, copy_c});
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  {
+    auto gemm_event = _gemm_strided_batched(
+        sb_handle_group, *t_a, *t_b, m, n, k, alpha, a_gpu, lda, stride_a,
+        b_gpu, ldb, stride_b, beta, c_gpu, ldc, stride_c, batch_size);
+    sb_handle_group.wait(gemm_event);
+    std::vector<scalar_t> c_temp(c_gpu, c_gpu + size_c_batch);
+
+    std::ostringstream err_stream;
+    if (!utils::compare_vectors(c_temp, c_ref, err_stream, "")) {
+      const std::string& err_str = err_stream.str();
+      state.SkipWithError(err_str.c_str());
+      *success = false;
+    };
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    auto event = _gemm_strided_batched(
+        sb_handle_group, *t_a, *t_b, m, n, k, alpha, a_gpu, lda, stride_a,
+        b_gpu, ldb, stride_b, beta, c_gpu, ldc, stride_c, batch_size);
+    sb_handle_group.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle_group.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  sycl::free(a_gpu, context);
+  sycl::free(b_gpu, context);
+  sycl::free(c_gpu, context);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+#ifdef SB_ENABLE_USM
+  std::vector<gemm_batched_param_t<scalar_t>> params;
+  if (args.csv_param.empty()) {
+    // Moderate sizes with enough batches to feed all the sub-devices
+    for (index_t size : {64, 128, 256, 512}) {
+      params.push_back(std::make_tuple("n", "n", size, size, size, scalar_t{1},
+                                       scalar_t{0}, index_t{32}, 0));
+    }
+  } else {
+    params = blas_benchmark::utils::get_gemm_batched_params<scalar_t>(args);
+  }
+
+  for (auto p : params) {
+    std::string t1s, t2s;
+    index_t m, n, k, batch_size;
+    scalar_t alpha, beta;
+    int batch_type;
+    std::tie(t1s, t2s, m, k, n, alpha, beta, batch_size, batch_type) = p;
+    if (batch_type != 0) {
+      // Only the strided batches are split across the sub-devices
+      continue;
+    }
+    int t1 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t1s));
+    int t2 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t2s));
+
+    for (index_t sub_devices : {1, 2, 4, 8}) {
+      auto BM_lambda = [&](benchmark::State& st,
+                           blas::SB_Handle* sb_handle_ptr, int t1, int t2,
+                           index_t m, index_t k, index_t n, scalar_t alpha,
+                           scalar_t beta, index_t batch_size,
+                           index_t sub_devices, bool* success) {
+        run<scalar_t>(st, sb_handle_ptr, t1, t2, m, k, n, alpha, beta,
+                      batch_size, sub_devices, success);
+      };
+      benchmark::RegisterBenchmark(
+          blas_benchmark::utils::get_name<benchmark_op, scalar_t>(
+              t1s, t2s, m, k, n, batch_size, sub_devices,
+              blas_benchmark::utils::MEM_TYPE_USM)
+              .c_str(),
+          BM_lambda, sb_handle_ptr, t1, t2, m, k, n, alpha, beta, batch_size,
+          sub_devices, success)
+          ->UseRealTime();
+    }
+  }
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
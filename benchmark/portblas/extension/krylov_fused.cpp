@@ -0,0 +1,185 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename krylov_fused.cpp
+ *
+ **************************************************************************/
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::krylov_fused;
+
+// Number of vectors of multi_dot, e.g. a GMRES restart length
+constexpr index_t multi_dot_k = 8;
+
+// Measures the fused operations of the Krylov solvers (fused = 1) against the
+// call sequences they replace (fused = 0): axpby against scal and axpy,
+// axpy_dot against axpy and dot, and multi_dot against k dot.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string operation, index_t n, int fused, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, operation, n, multi_dot_k, fused);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  const scalar_t alpha{1.5};
+  const scalar_t beta{0.5};
+  const index_t x_size = operation == "multi_dot" ? n * multi_dot_k : n;
+  const index_t rs_size = operation == "multi_dot" ? multi_dot_k : 1;
+
+  // Create data
+  std::vector<scalar_t> v_x =
+      blas_benchmark::utils::random_data<scalar_t>(x_size);
+  std::vector<scalar_t> v_y = blas_benchmark::utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> v_z = blas_benchmark::utils::random_data<scalar_t>(n);
+
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto v_z_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto rs_gpu = blas::helper::allocate<mem_alloc, scalar_t>(rs_size, q);
+
+  auto copy_x =
+      blas::helper::copy_to_device<scalar_t>(q, v_x.data(), v_x_gpu, x_size);
+  auto copy_y =
+      blas::helper::copy_to_device<scalar_t>(q, v_y.data(), v_y_gpu, n);
+  auto copy_z =
+      blas::helper::copy_to_device<scalar_t>(q, v_z.data(), v_z_gpu, n);
+
+  sb_handle.wait({copy_x, copy_y, copy_z});
+
+  const index_t one = 1;
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    std::vector<sycl::event> event;
+    if (operation == "axpby") {
+      if (fused) {
+        event = _axpby(sb_handle, n, alpha, v_x_gpu, one, beta, v_y_gpu, one);
+      } else {
+        auto scal_event = _scal(sb_handle, n, beta, v_y_gpu, one);
+        event = _axpy(sb_handle, n, alpha, v_x_gpu, one, v_y_gpu, one,
+                      scal_event);
+      }
+    } else if (operation == "axpy_dot") {
+      if (fused) {
+        event = _axpy_dot(sb_handle, n, alpha, v_x_gpu, one, v_y_gpu, one,
+                          v_z_gpu, one, rs_gpu);
+      } else {
+        auto axpy_event =
+            _axpy(sb_handle, n, alpha, v_x_gpu, one, v_y_gpu, one);
+        event = _dot(sb_handle, n, v_y_gpu, one, v_z_gpu, one, rs_gpu,
+                     axpy_event);
+      }
+    } else {
+      if (fused) {
+        event = _multi_dot(sb_handle, n, multi_dot_k, v_x_gpu, one, n, v_y_gpu,
+                           one, rs_gpu);
+      } else {
+        for (index_t j = 0; j < multi_dot_k; ++j) {
+          auto dot_event = _dot(sb_handle, n, v_x_gpu + j * n, one, v_y_gpu,
+                                one, rs_gpu + j);
+          event.insert(event.end(), dot_event.begin(), dot_event.end());
+        }
+      }
+    }
+    sb_handle.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_z_gpu, q);
+  blas::helper::deallocate<mem_alloc>(rs_gpu, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  for (std::string operation : {"axpby", "axpy_dot", "multi_dot"}) {
+    for (auto n : params) {
+      for (int fused : {0, 1}) {
+        auto BM_lambda = [&](benchmark::State& st,
+                             blas::SB_Handle* sb_handle_ptr,
+                             std::string operation, index_t n, int fused,
+                             bool* success) {
+          run<scalar_t, mem_alloc>(st, sb_handle_ptr, operation, n, fused,
+                                   success);
+        };
+        benchmark::RegisterBenchmark(
+            blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+                operation, n, fused, mem_type)
+                .c_str(),
+            BM_lambda, sb_handle_ptr, operation, n, fused, success)
+            ->UseRealTime();
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto krylov_params = blas_benchmark::utils::get_blas1_params(args);
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      krylov_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      krylov_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,185 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename low_precision.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::low_precision;
+
+// Measures axpy, scal, copy, rot, dot and nrm2 of size n on vectors stored as
+// storage_t, from the same float data. dot and nrm2 accumulate in float
+// whatever the storage, so that the gain of the 16-bit storage is the ratio of
+// the bandwidths to the float storage.
+template <typename storage_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string operation, index_t n, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<float>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, storage_t>(
+      state, operation, n);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  const storage_t alpha{blas_benchmark::utils::random_scalar<float>()};
+  const storage_t c{0.6f};
+  const storage_t s{0.8f};
+
+  // Create data
+  std::vector<float> v_x_f = blas_benchmark::utils::random_data<float>(n);
+  std::vector<float> v_y_f = blas_benchmark::utils::random_data<float>(n);
+  std::vector<storage_t> v_x(v_x_f.begin(), v_x_f.end());
+  std::vector<storage_t> v_y(v_y_f.begin(), v_y_f.end());
+  storage_t res{0.f};
+
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, storage_t>(n, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, storage_t>(n, q);
+  auto res_gpu = blas::helper::allocate<mem_alloc, storage_t>(1, q);
+
+  auto copy_x =
+      blas::helper::copy_to_device<storage_t>(q, v_x.data(), v_x_gpu, n);
+  auto copy_y =
+      blas::helper::copy_to_device<storage_t>(q, v_y.data(), v_y_gpu, n);
+  auto copy_res = blas::helper::copy_to_device<storage_t>(q, &res, res_gpu, 1);
+
+  sb_handle.wait({copy_x, copy_y, copy_res});
+
+  const index_t one = 1;
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    std::vector<sycl::event> event;
+    if (operation == "axpy") {
+      event = _axpy(sb_handle, n, alpha, v_x_gpu, one, v_y_gpu, one);
+    } else if (operation == "scal") {
+      event = _scal(sb_handle, n, alpha, v_x_gpu, one);
+    } else if (operation == "copy") {
+      event = _copy(sb_handle, n, v_x_gpu, one, v_y_gpu, one);
+    } else if (operation == "rot") {
+      event = _rot(sb_handle, n, v_x_gpu, one, v_y_gpu, one, c, s);
+    } else if (operation == "dot") {
+      event = _dot(sb_handle, n, v_x_gpu, one, v_y_gpu, one, res_gpu);
+    } else {
+      event = _nrm2(sb_handle, n, v_x_gpu, one, res_gpu);
+    }
+    sb_handle.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+  blas::helper::deallocate<mem_alloc>(res_gpu, q);
+}
+
+template <typename storage_t, blas::helper::AllocType mem_alloc>
+void register_storage_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                                std::string storage, std::string mem_type,
+                                std::vector<blas1_param_t> params) {
+  for (std::string operation : {"axpy", "scal", "copy", "rot", "dot", "nrm2"}) {
+    for (auto n : params) {
+      auto BM_lambda = [&](benchmark::State& st,
+                           blas::SB_Handle* sb_handle_ptr,
+                           std::string operation, index_t n, bool* success) {
+        run<storage_t, mem_alloc>(st, sb_handle_ptr, operation, n, success);
+      };
+      benchmark::RegisterBenchmark(
+          blas_benchmark::utils::get_name<benchmark_op, float, index_t>(
+              operation, n, storage, mem_type)
+              .c_str(),
+          BM_lambda, sb_handle_ptr, operation, n, success)
+          ->UseRealTime();
+    }
+  }
+}
+
+template <blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  register_storage_benchmark<float, mem_alloc>(sb_handle_ptr, success, "float",
+                                               mem_type, params);
+#ifdef BLAS_ENABLE_HALF
+  register_storage_benchmark<sycl::half, mem_alloc>(sb_handle_ptr, success,
+                                                    "half", mem_type, params);
+#endif
+#ifdef BLAS_ENABLE_BFLOAT16
+  register_storage_benchmark<blas::bfloat16, mem_alloc>(
+      sb_handle_ptr, success, "bfloat16", mem_type, params);
+#endif
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // The storage types are compared to float, registered once
+  if constexpr (std::is_same<scalar_t, float>::value) {
+    // Sweep from 1e3 to 1e8 elements by default
+    std::vector<blas1_param_t> low_precision_params{
+        1000, 10000, 100000, 1000000, 10000000, 100000000};
+    if (!args.csv_param.empty()) {
+      low_precision_params = blas_benchmark::utils::get_blas1_params(args);
+    }
+
+    register_benchmark<blas::helper::AllocType::buffer>(
+        sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+        low_precision_params);
+#ifdef SB_ENABLE_USM
+    register_benchmark<blas::helper::AllocType::usm>(
+        sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+        low_precision_params);
+#endif
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,174 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename plan_replay.cpp
+ *
+ **************************************************************************/
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::plan_replay;
+
+// Measures the host side cost of a short chain of calls (gemv, axpy, scal)
+// issued directly through the interface (replay = 0) or replayed from a
+// captured blas::Execution_Plan (replay = 1). The "avg_host_time" counter
+// reports the time spent submitting the chain, excluding the wait.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t n,
+         int replay, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, n);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  std::vector<scalar_t> m_a =
+      blas_benchmark::utils::random_data<scalar_t>(n * n);
+  std::vector<scalar_t> v_x = blas_benchmark::utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> v_y = blas_benchmark::utils::random_data<scalar_t>(n);
+  // Keep the values bounded across the iterations
+  const scalar_t alpha = scalar_t(1) / static_cast<scalar_t>(n);
+  const scalar_t beta = scalar_t(0);
+  const scalar_t scale = scalar_t(0.5);
+
+  auto m_a_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n * n, q);
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+
+  auto copy_m =
+      blas::helper::copy_to_device<scalar_t>(q, m_a.data(), m_a_gpu, n * n);
+  auto copy_x =
+      blas::helper::copy_to_device<scalar_t>(q, v_x.data(), v_x_gpu, n);
+  auto copy_y =
+      blas::helper::copy_to_device<scalar_t>(q, v_y.data(), v_y_gpu, n);
+
+  sb_handle.wait({copy_m, copy_x, copy_y});
+
+  auto run_chain = [&]() -> std::vector<sycl::event> {
+    auto gemv_event = _gemv(sb_handle, 'n', n, n, alpha, m_a_gpu, n, v_x_gpu,
+                            static_cast<index_t>(1), beta, v_y_gpu,
+                            static_cast<index_t>(1));
+    auto axpy_event = _axpy(sb_handle, n, alpha, v_y_gpu,
+                            static_cast<index_t>(1), v_x_gpu,
+                            static_cast<index_t>(1), gemv_event);
+    return _scal(sb_handle, n, scale, v_x_gpu, static_cast<index_t>(1),
+                 axpy_event);
+  };
+
+  blas::Execution_Plan plan;
+  if (replay) {
+    sb_handle.begin_capture(plan);
+    run_chain();
+    sb_handle.end_capture();
+    sb_handle.wait();
+  }
+
+  double total_host_time = 0;
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    auto start = std::chrono::system_clock::now();
+    auto event = replay ? plan.replay() : run_chain();
+    auto end = std::chrono::system_clock::now();
+    total_host_time += static_cast<double>((end - start).count());
+    sb_handle.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+  total_host_time = 0;
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  state.counters["avg_host_time"] = total_host_time / state.iterations();
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  for (auto n : params) {
+    for (int replay : {0, 1}) {
+      auto BM_lambda = [&](benchmark::State& st,
+                           blas::SB_Handle* sb_handle_ptr, index_t n,
+                           int replay, bool* success) {
+        run<scalar_t, mem_alloc>(st, sb_handle_ptr, n, replay, success);
+      };
+      benchmark::RegisterBenchmark(
+          blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+              n, replay, mem_type)
+              .c_str(),
+          BM_lambda, sb_handle_ptr, n, replay, success)
+          ->UseRealTime();
+    }
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // Small sizes by default, where the host side overhead dominates
+  std::vector<blas1_param_t> plan_params{16, 64, 256, 1024};
+  if (!args.csv_param.empty()) {
+    plan_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      plan_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      plan_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename reduction_launch.cpp
+ *
+ **************************************************************************/
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::reduction_launch;
+
+// Measures dot, nrm2 and asum of size n launched with the work group size and
+// count planned from the device and n (planned = 1), or with the former fixed
+// configuration of the default backend, 16 work groups of 8 work items
+// (planned = 0). The bandwidth is reported through bytes_processed. Backends
+// other than the default one are tuned separately and ignore the planner.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string operation, index_t n, int planned, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, operation, n, planned);
+
+  // Copy of the global handle, only changing the reduction launch
+  blas::SB_Handle sb_handle = *sb_handle_ptr;
+  if (!planned) {
+    sb_handle.set_reduction_launch(8, 16);
+  }
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  std::vector<scalar_t> v_x = blas_benchmark::utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> v_y = blas_benchmark::utils::random_data<scalar_t>(n);
+
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto rs_gpu = blas::helper::allocate<mem_alloc, scalar_t>(1, q);
+
+  auto copy_x =
+      blas::helper::copy_to_device<scalar_t>(q, v_x.data(), v_x_gpu, n);
+  auto copy_y =
+      blas::helper::copy_to_device<scalar_t>(q, v_y.data(), v_y_gpu, n);
+
+  sb_handle.wait({copy_x, copy_y});
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    std::vector<sycl::event> event;
+    if (operation == "dot") {
+      event = _dot(sb_handle, n, v_x_gpu, static_cast<index_t>(1), v_y_gpu,
+                   static_cast<index_t>(1), rs_gpu);
+    } else if (operation == "nrm2") {
+      event = _nrm2(sb_handle, n, v_x_gpu, static_cast<index_t>(1), rs_gpu);
+    } else {
+      event = _asum(sb_handle, n, v_x_gpu, static_cast<index_t>(1), rs_gpu);
+    }
+    sb_handle.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+  blas::helper::deallocate<mem_alloc>(rs_gpu, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  for (std::string operation : {"dot", "nrm2", "asum"}) {
+    for (auto n : params) {
+      for (int planned : {0, 1}) {
+        auto BM_lambda = [&](benchmark::State& st,
+                             blas::SB_Handle* sb_handle_ptr,
+                             std::string operation, index_t n, int planned,
+                             bool* success) {
+          run<scalar_t, mem_alloc>(st, sb_handle_ptr, operation, n, planned,
+                                   success);
+        };
+        benchmark::RegisterBenchmark(
+            blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+                operation, n, planned, mem_type)
+                .c_str(),
+            BM_lambda, sb_handle_ptr, operation, n, planned, success)
+            ->UseRealTime();
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // Sweep from 1e2 to 1e9 elements by default
+  std::vector<blas1_param_t> launch_params{
+      100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+  if (!args.csv_param.empty()) {
+    launch_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      launch_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      launch_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,283 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename rot_batch.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::rot_batch;
+
+// Runs batch_size rotg, rot or rotm on contiguous batches, either with the
+// batched extensions in a single launch (batched = 1) or with one call of the
+// level 1 operation per element of the batch (batched = 0). The vectors of
+// rot and rotm have n elements, rotg ignores n.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string operation, index_t n, index_t batch_size, int batched,
+         bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, operation, n, batch_size, batched);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  constexpr index_t param_size = 5;
+  const index_t one = 1;
+  const index_t size_v{n * batch_size};
+  const index_t size_param{param_size * batch_size};
+
+  // Create data, the rotations of rotm having the full form of H
+  std::vector<scalar_t> v_x =
+      blas_benchmark::utils::random_data<scalar_t>(size_v);
+  std::vector<scalar_t> v_y =
+      blas_benchmark::utils::random_data<scalar_t>(size_v);
+  std::vector<scalar_t> v_a =
+      blas_benchmark::utils::random_data<scalar_t>(batch_size);
+  std::vector<scalar_t> v_b =
+      blas_benchmark::utils::random_data<scalar_t>(batch_size);
+  std::vector<scalar_t> v_c =
+      blas_benchmark::utils::random_data<scalar_t>(batch_size);
+  std::vector<scalar_t> v_s =
+      blas_benchmark::utils::random_data<scalar_t>(batch_size);
+  std::vector<scalar_t> v_param =
+      blas_benchmark::utils::random_data<scalar_t>(size_param);
+  for (index_t i = 0; i < batch_size; ++i) {
+    v_param[i * param_size] = scalar_t{-1};
+  }
+
+  auto gpu_x = blas::helper::allocate<mem_alloc, scalar_t>(size_v, q);
+  auto gpu_y = blas::helper::allocate<mem_alloc, scalar_t>(size_v, q);
+  auto gpu_a = blas::helper::allocate<mem_alloc, scalar_t>(batch_size, q);
+  auto gpu_b = blas::helper::allocate<mem_alloc, scalar_t>(batch_size, q);
+  auto gpu_c = blas::helper::allocate<mem_alloc, scalar_t>(batch_size, q);
+  auto gpu_s = blas::helper::allocate<mem_alloc, scalar_t>(batch_size, q);
+  auto gpu_param = blas::helper::allocate<mem_alloc, scalar_t>(size_param, q);
+
+  auto copy_x =
+      blas::helper::copy_to_device<scalar_t>(q, v_x.data(), gpu_x, size_v);
+  auto copy_y =
+      blas::helper::copy_to_device<scalar_t>(q, v_y.data(), gpu_y, size_v);
+  auto copy_a =
+      blas::helper::copy_to_device<scalar_t>(q, v_a.data(), gpu_a, batch_size);
+  auto copy_b =
+      blas::helper::copy_to_device<scalar_t>(q, v_b.data(), gpu_b, batch_size);
+  auto copy_c =
+      blas::helper::copy_to_device<scalar_t>(q, v_c.data(), gpu_c, batch_size);
+  auto copy_s =
+      blas::helper::copy_to_device<scalar_t>(q, v_s.data(), gpu_s, batch_size);
+  auto copy_param = blas::helper::copy_to_device<scalar_t>(
+      q, v_param.data(), gpu_param, size_param);
+
+  sb_handle.wait(
+      {copy_x, copy_y, copy_a, copy_b, copy_c, copy_s, copy_param});
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> x_ref = v_x;
+  std::vector<scalar_t> y_ref = v_y;
+  std::vector<scalar_t> a_ref = v_a;
+  std::vector<scalar_t> b_ref = v_b;
+  std::vector<scalar_t> c_ref = v_c;
+  std::vector<scalar_t> s_ref = v_s;
+  for (index_t i = 0; i < batch_size; ++i) {
+    if (operation == "rotg") {
+      reference_blas::rotg(&a_ref[i], &b_ref[i], &c_ref[i], &s_ref[i]);
+    } else if (operation == "rot") {
+      reference_blas::rot(n, x_ref.data() + i * n, one, y_ref.data() + i * n,
+                          one, c_ref[i], s_ref[i]);
+    } else {
+      reference_blas::rotm(n, x_ref.data() + i * n, one, y_ref.data() + i * n,
+                           one, v_param.data() + i * param_size);
+    }
+  }
+  typename blas::SB_Handle::event_t verify_event;
+  if (operation == "rotg") {
+    verify_event = _rotg_batch(sb_handle, gpu_a, one, gpu_b, one, gpu_c, one,
+                               gpu_s, one, batch_size);
+  } else if (operation == "rot") {
+    verify_event = _rot_batch(sb_handle, n, gpu_x, one, n, gpu_y, one, n,
+                              gpu_c, one, gpu_s, one, batch_size);
+  } else {
+    verify_event = _rotm_batch(sb_handle, n, gpu_x, one, n, gpu_y, one, n,
+                               gpu_param, param_size, batch_size);
+  }
+  sb_handle.wait(verify_event);
+
+  std::vector<scalar_t> x_temp(size_v);
+  std::vector<scalar_t> y_temp(size_v);
+  std::vector<scalar_t> c_temp(batch_size);
+  std::vector<scalar_t> s_temp(batch_size);
+  auto copy_out_x = blas::helper::copy_to_host(q, gpu_x, x_temp.data(), size_v);
+  auto copy_out_y = blas::helper::copy_to_host(q, gpu_y, y_temp.data(), size_v);
+  auto copy_out_c =
+      blas::helper::copy_to_host(q, gpu_c, c_temp.data(), batch_size);
+  auto copy_out_s =
+      blas::helper::copy_to_host(q, gpu_s, s_temp.data(), batch_size);
+  sb_handle.wait({copy_out_x, copy_out_y, copy_out_c, copy_out_s});
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(x_temp, x_ref, err_stream, "") ||
+      !utils::compare_vectors(y_temp, y_ref, err_stream, "") ||
+      !utils::compare_vectors(c_temp, c_ref, err_stream, "") ||
+      !utils::compare_vectors(s_temp, s_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto run_batched = [&]() -> std::vector<sycl::event> {
+    if (operation == "rotg") {
+      return _rotg_batch(sb_handle, gpu_a, one, gpu_b, one, gpu_c, one, gpu_s,
+                         one, batch_size);
+    } else if (operation == "rot") {
+      return _rot_batch(sb_handle, n, gpu_x, one, n, gpu_y, one, n, gpu_c, one,
+                        gpu_s, one, batch_size);
+    } else {
+      return _rotm_batch(sb_handle, n, gpu_x, one, n, gpu_y, one, n, gpu_param,
+                         param_size, batch_size);
+    }
+  };
+
+  auto run_loop = [&]() -> std::vector<sycl::event> {
+    std::vector<sycl::event> events;
+    for (index_t i = 0; i < batch_size; ++i) {
+      typename blas::SB_Handle::event_t event;
+      if (operation == "rotg") {
+        event = _rotg(sb_handle, gpu_a + i, gpu_b + i, gpu_c + i, gpu_s + i);
+      } else if (operation == "rot") {
+        event = _rot(sb_handle, n, gpu_x + i * n, one, gpu_y + i * n, one,
+                     gpu_c + i, gpu_s + i);
+      } else {
+        event = _rotm(sb_handle, n, gpu_x + i * n, one, gpu_y + i * n, one,
+                      gpu_param + i * param_size);
+      }
+      events.insert(events.end(), event.begin(), event.end());
+    }
+    return events;
+  };
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    auto events = batched ? run_batched() : run_loop();
+    sb_handle.wait(events);
+    return events;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  blas::helper::deallocate<mem_alloc>(gpu_x, q);
+  blas::helper::deallocate<mem_alloc>(gpu_y, q);
+  blas::helper::deallocate<mem_alloc>(gpu_a, q);
+  blas::helper::deallocate<mem_alloc>(gpu_b, q);
+  blas::helper::deallocate<mem_alloc>(gpu_c, q);
+  blas::helper::deallocate<mem_alloc>(gpu_s, q);
+  blas::helper::deallocate<mem_alloc>(gpu_param, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  for (std::string operation : {"rotg", "rot", "rotm"}) {
+    for (index_t batch_size : {128, 4096}) {
+      for (auto n : params) {
+        if (operation == "rotg") {
+          // A single rotation per element of the batch
+          n = 1;
+        }
+        for (int batched : {0, 1}) {
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string operation, index_t n,
+                               index_t batch_size, int batched,
+                               bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, operation, n,
+                                     batch_size, batched, success);
+          };
+          benchmark::RegisterBenchmark(
+              blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+                  operation, n, batch_size, batched, mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, operation, n, batch_size, batched,
+              success)
+              ->UseRealTime();
+        }
+        if (operation == "rotg") {
+          break;
+        }
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // Short vectors by default, as in the batched QR and eigen-solvers
+  std::vector<blas1_param_t> rot_batch_params{16, 64, 256, 1024};
+  if (!args.csv_param.empty()) {
+    rot_batch_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      rot_batch_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      rot_batch_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,137 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename temp_mem_pool.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::temp_mem_pool;
+
+// Pool shared by the threads of a benchmark, created and destroyed by the
+// first thread. The threads are synchronized at the start and at the end of
+// the measurement loop.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+std::unique_ptr<blas::Temp_Mem_Pool> shared_pool;
+
+// Measures the throughput of the temporary memory pool when several host
+// threads acquire and release blocks of n elements and of smaller sizes. The
+// blocks are released immediately, as done by the pool once the commands using
+// them are complete. Each iteration of a thread acquires and releases
+// blocks_per_iteration blocks.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t n,
+         bool* success) {
+  constexpr int blocks_per_iteration = 8;
+
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, n);
+
+  auto& pool = shared_pool<scalar_t, mem_alloc>;
+  if (state.thread_index() == 0) {
+    pool.reset(new blas::Temp_Mem_Pool(sb_handle_ptr->get_queue()));
+  }
+
+  // Sizes n, n / 2, ..., n / 128
+  auto block_size = [n](int i) { return std::max<index_t>(n >> i, 1); };
+
+  for (auto _ : state) {
+    if constexpr (mem_alloc == blas::helper::AllocType::usm) {
+#ifdef SB_ENABLE_USM
+      scalar_t* blocks[blocks_per_iteration];
+      for (int i = 0; i < blocks_per_iteration; ++i) {
+        blocks[i] = pool->template acquire_usm_mem<scalar_t>(block_size(i));
+      }
+      for (int i = 0; i < blocks_per_iteration; ++i) {
+        pool->reclaim_usm_mem(blocks[i]);
+      }
+#endif
+    } else {
+      std::vector<blas::BufferIterator<scalar_t>> blocks;
+      blocks.reserve(blocks_per_iteration);
+      for (int i = 0; i < blocks_per_iteration; ++i) {
+        blocks.push_back(
+            pool->template acquire_buff_mem<scalar_t>(block_size(i)));
+      }
+      for (const auto& block : blocks) {
+        pool->reclaim_buff_mem(block);
+      }
+    }
+  }
+
+  // Acquire and release operations per second
+  state.SetItemsProcessed(state.iterations() * 2 * blocks_per_iteration);
+
+  if (state.thread_index() == 0) {
+    pool.reset();
+  }
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  for (auto n : params) {
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         index_t n, bool* success) {
+      run<scalar_t, mem_alloc>(st, sb_handle_ptr, n, success);
+    };
+    benchmark::RegisterBenchmark(
+        blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+            n, mem_type)
+            .c_str(),
+        BM_lambda, sb_handle_ptr, n, success)
+        ->ThreadRange(1, 32)
+        ->UseRealTime();
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // Scratch sizes of the reductions and of the gemv/gemm temporaries
+  std::vector<blas1_param_t> pool_params{1024, 65536, 1048576};
+  if (!args.csv_param.empty()) {
+    pool_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      pool_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      pool_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,190 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename temp_mem_pool_ops.cpp
+ *
+ **************************************************************************/
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::temp_mem_pool_ops;
+
+// Measures operations allocating temporary memory on each call (transposed
+// gemv, iamax and trsm of size n) run on a SB_Handle without a memory pool
+// (pool = 0) or created from a blas::Temp_Mem_Pool (pool = 1). Both handles
+// are created by the benchmark on the queue of the global handle, so that the
+// comparison does not depend on BLAS_MEMPOOL_BENCHMARK. With the pool, the
+// "pool_hits" and "pool_misses" counters report its acquisitions per
+// iteration.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string operation, index_t n, int pool, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, operation, n, pool);
+
+  auto q = sb_handle_ptr->get_queue();
+  std::unique_ptr<blas::Temp_Mem_Pool> temp_mem_pool;
+  if (pool) {
+    temp_mem_pool.reset(new blas::Temp_Mem_Pool(q));
+  }
+  blas::SB_Handle sb_handle = pool ? blas::SB_Handle(temp_mem_pool.get())
+                                   : blas::SB_Handle(q);
+
+  // Create data
+  std::vector<scalar_t> m_a =
+      blas_benchmark::utils::random_data<scalar_t>(n * n);
+  std::vector<scalar_t> m_b =
+      blas_benchmark::utils::random_data<scalar_t>(n * n);
+  std::vector<scalar_t> v_x = blas_benchmark::utils::random_data<scalar_t>(n);
+  // The solutions of the repeated trsm calls stay bounded
+  const scalar_t diag{2};
+  const scalar_t trsm_alpha{2};
+  if (operation == "trsm") {
+    blas_benchmark::utils::fill_trsm_matrix(m_a, n, n, 'l', diag);
+  }
+
+  auto m_a_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n * n, q);
+  auto m_b_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n * n, q);
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto out_i_gpu = blas::helper::allocate<mem_alloc, index_t>(1, q);
+
+  auto copy_a =
+      blas::helper::copy_to_device<scalar_t>(q, m_a.data(), m_a_gpu, n * n);
+  auto copy_b =
+      blas::helper::copy_to_device<scalar_t>(q, m_b.data(), m_b_gpu, n * n);
+  auto copy_x =
+      blas::helper::copy_to_device<scalar_t>(q, v_x.data(), v_x_gpu, n);
+
+  sb_handle.wait({copy_a, copy_b, copy_x});
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    std::vector<sycl::event> event;
+    if (operation == "gemv") {
+      event = _gemv(sb_handle, 't', n, n, scalar_t{1}, m_a_gpu, n, v_x_gpu,
+                    static_cast<index_t>(1), scalar_t{0}, v_y_gpu,
+                    static_cast<index_t>(1));
+    } else if (operation == "iamax") {
+      event =
+          _iamax(sb_handle, n, v_x_gpu, static_cast<index_t>(1), out_i_gpu);
+    } else {
+      event = _trsm(sb_handle, 'l', 'l', 'n', 'n', n, n, trsm_alpha, m_a_gpu,
+                    n, m_b_gpu, n);
+    }
+    sb_handle.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+  blas::Temp_Mem_Pool_Stats warm_stats{};
+  if (pool) {
+    warm_stats = temp_mem_pool->get_stats();
+  }
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  if (pool) {
+    const auto stats = temp_mem_pool->get_stats();
+    const double iterations = static_cast<double>(state.iterations());
+    state.counters["pool_hits"] = (stats.hits - warm_stats.hits) / iterations;
+    state.counters["pool_misses"] =
+        (stats.misses - warm_stats.misses) / iterations;
+  }
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_b_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+  blas::helper::deallocate<mem_alloc>(out_i_gpu, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  for (std::string operation : {"gemv", "iamax", "trsm"}) {
+    for (auto n : params) {
+      for (int pool : {0, 1}) {
+        auto BM_lambda = [&](benchmark::State& st,
+                             blas::SB_Handle* sb_handle_ptr,
+                             std::string operation, index_t n, int pool,
+                             bool* success) {
+          run<scalar_t, mem_alloc>(st, sb_handle_ptr, operation, n, pool,
+                                   success);
+        };
+        benchmark::RegisterBenchmark(
+            blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+                operation, n, pool, mem_type)
+                .c_str(),
+            BM_lambda, sb_handle_ptr, operation, n, pool, success)
+            ->UseRealTime();
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // Small sizes by default, where the allocations weigh the most
+  std::vector<blas1_param_t> pool_params{64, 256, 1024};
+  if (!args.csv_param.empty()) {
+    pool_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      pool_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      pool_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
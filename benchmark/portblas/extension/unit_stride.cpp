@@ -0,0 +1,163 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename unit_stride.cpp
+ *
+ **************************************************************************/
+#include "../utils.hpp"
+
+constexpr blas_benchmark::utils::ExtensionOp benchmark_op =
+    blas_benchmark::utils::ExtensionOp::unit_stride;
+
+// Measures axpy, scal, copy and swap of size n with unit strides, on vectors
+// aligned to the size of a packet and evaluated with sycl::vec packets
+// (packed = 1), or on vectors moved one element away from the alignment and
+// evaluated element by element (packed = 0), so that the gain of the packets
+// is the ratio of their bandwidths.
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string operation, index_t n, int packed, bool* success) {
+  // initialize the state label
+  blas_benchmark::utils::set_benchmark_label<scalar_t>(
+      state, sb_handle_ptr->get_queue());
+
+  // Google-benchmark counters are double.
+  blas_benchmark::utils::init_extension_counters<benchmark_op, scalar_t>(
+      state, operation, n, packed);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  const index_t offset = packed ? 0 : 1;
+  const scalar_t alpha = blas_benchmark::utils::random_scalar<scalar_t>();
+
+  // Create data
+  std::vector<scalar_t> v_x =
+      blas_benchmark::utils::random_data<scalar_t>(n + offset);
+  std::vector<scalar_t> v_y =
+      blas_benchmark::utils::random_data<scalar_t>(n + offset);
+
+  auto v_x_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n + offset, q);
+  auto v_y_gpu = blas::helper::allocate<mem_alloc, scalar_t>(n + offset, q);
+
+  auto copy_x = blas::helper::copy_to_device<scalar_t>(q, v_x.data(), v_x_gpu,
+                                                       n + offset);
+  auto copy_y = blas::helper::copy_to_device<scalar_t>(q, v_y.data(), v_y_gpu,
+                                                       n + offset);
+
+  sb_handle.wait({copy_x, copy_y});
+
+  auto x_gpu = v_x_gpu + offset;
+  auto y_gpu = v_y_gpu + offset;
+  const index_t one = 1;
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    std::vector<sycl::event> event;
+    if (operation == "axpy") {
+      event = _axpy(sb_handle, n, alpha, x_gpu, one, y_gpu, one);
+    } else if (operation == "scal") {
+      event = _scal(sb_handle, n, alpha, x_gpu, one);
+    } else if (operation == "copy") {
+      event = _copy(sb_handle, n, x_gpu, one, y_gpu, one);
+    } else {
+      event = _swap(sb_handle, n, x_gpu, one, y_gpu, one);
+    }
+    sb_handle.wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.counters["n_fl_ops"]);
+  state.SetBytesProcessed(state.iterations() *
+                          state.counters["bytes_processed"]);
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void register_benchmark(blas::SB_Handle* sb_handle_ptr, bool* success,
+                        std::string mem_type,
+                        std::vector<blas1_param_t> params) {
+  for (std::string operation : {"axpy", "scal", "copy", "swap"}) {
+    for (auto n : params) {
+      for (int packed : {0, 1}) {
+        auto BM_lambda = [&](benchmark::State& st,
+                             blas::SB_Handle* sb_handle_ptr,
+                             std::string operation, index_t n, int packed,
+                             bool* success) {
+          run<scalar_t, mem_alloc>(st, sb_handle_ptr, operation, n, packed,
+                                   success);
+        };
+        benchmark::RegisterBenchmark(
+            blas_benchmark::utils::get_name<benchmark_op, scalar_t, index_t>(
+                operation, n, packed, mem_type)
+                .c_str(),
+            BM_lambda, sb_handle_ptr, operation, n, packed, success)
+            ->UseRealTime();
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  // Sweep from 1e2 to 1e9 elements by default
+  std::vector<blas1_param_t> unit_stride_params{
+      100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+  if (!args.csv_param.empty()) {
+    unit_stride_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_benchmark<scalar_t, blas::helper::AllocType::buffer>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_BUFFER,
+      unit_stride_params);
+#ifdef SB_ENABLE_USM
+  register_benchmark<scalar_t, blas::helper::AllocType::usm>(
+      sb_handle_ptr, success, blas_benchmark::utils::MEM_TYPE_USM,
+      unit_stride_params);
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
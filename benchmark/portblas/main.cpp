@@ -42,6 +42,14 @@ int main(int argc, char** argv) {
   benchmark::Initialize(&argc, argv);
 
   sycl::queue q;
+#ifdef BLAS_IN_ORDER_BENCHMARK
+  const sycl::property_list queue_properties{
+      sycl::property::queue::enable_profiling(),
+      sycl::property::queue::in_order()};
+#else
+  const sycl::property_list queue_properties{
+      sycl::property::queue::enable_profiling()};
+#endif
 
   if (!args.device.empty()) {
     // Initialise the command line device selector in a unique pointer so that
@@ -57,10 +65,9 @@ int main(int argc, char** argv) {
     // Create a queue from the device selector - do this after initialising
     // googlebench, as otherwise we may not be able to delete the queue before
     // we exit (if Initialise calls exit(0)), and dump some information about it
-    q = sycl::queue(*cdsp.get(), {sycl::property::queue::enable_profiling()});
+    q = sycl::queue(*cdsp.get(), queue_properties);
   } else {
-    q = sycl::queue(sycl::default_selector_v,
-                    {sycl::property::queue::enable_profiling()});
+    q = sycl::queue(sycl::default_selector_v, queue_properties);
   }
 
   utils::print_queue_information(q);
@@ -69,6 +76,25 @@ int main(int argc, char** argv) {
   blas::Temp_Mem_Pool mp(q);
   // Create a portBLAS sb_handle from the memory pool
   blas::SB_Handle sb_handle(&mp);
+
+  // Report the pool statistics next to the timings: hits and misses per
+  // iteration of the measurement, and the pool state at its end
+  blas::Temp_Mem_Pool_Stats initial_stats{};
+  blas_benchmark::utils::extra_counters().init =
+      [&](benchmark::State& state) { initial_stats = mp.get_stats(); };
+  blas_benchmark::utils::extra_counters().report =
+      [&](benchmark::State& state) {
+        const auto stats = mp.get_stats();
+        const double iterations = static_cast<double>(state.iterations());
+        state.counters["pool_hits"] =
+            (stats.hits - initial_stats.hits) / iterations;
+        state.counters["pool_misses"] =
+            (stats.misses - initial_stats.misses) / iterations;
+        state.counters["pool_bytes_cached"] = stats.bytes_cached;
+        state.counters["pool_high_water_mark"] = stats.high_water_mark;
+        state.counters["pool_avg_acquire_us"] = stats.avg_acquire_us;
+        state.counters["pool_max_acquire_us"] = stats.max_acquire_us;
+      };
 #else
   // Create a portBLAS sb_handle from the queue
   blas::SB_Handle sb_handle(q);
@@ -77,6 +103,16 @@ int main(int argc, char** argv) {
   // This will be set to false by a failing benchmark
   bool success = true;
 
+#ifdef BLAS_IN_ORDER_BENCHMARK
+  // The same benchmarks with the event dependency tracking of out-of-order
+  // queues, to compare the host overhead of both dispatch paths
+  blas::SB_Handle tracking_sb_handle = sb_handle;
+  tracking_sb_handle.set_in_order_fast_path(false);
+  blas_benchmark::utils::name_tag() = "event_tracking";
+  blas_benchmark::create_benchmark(args, &tracking_sb_handle, &success);
+  blas_benchmark::utils::name_tag() = "in_order_fast_path";
+#endif
+
   // Create the benchmarks
   blas_benchmark::create_benchmark(args, &sb_handle, &success);
 
@@ -36,6 +36,9 @@ function(cpp_type output data)
   if (${data} STREQUAL "half")
     set(${output} "sycl::half" PARENT_SCOPE)
     return()
+  elseif(${data} STREQUAL "bfloat16")
+    set(${output} "sycl::ext::oneapi::bfloat16" PARENT_SCOPE)
+    return()
   elseif(${data} STREQUAL "complex<float>")
     set(${output} "sycl::ext::oneapi::experimental::complex<float>" PARENT_SCOPE)
     return()
@@ -83,10 +86,22 @@ set(COMPLEX_OPS "gemm"
 
 #List of operators supporting Half Data types
 set(HALF_DATA_OPS "axpy" 
+                  "copy"
+                  "dot"
+                  "nrm2"
+                  "rot"
                   "scal"
                   "gemm"
                   "gemm_launcher")
 
+#List of operators supporting BFloat16 Data types
+set(BF16_DATA_OPS "axpy"
+                  "copy"
+                  "dot"
+                  "nrm2"
+                  "rot"
+                  "scal")
+
 function(set_target_compile_def in_target)
   #setting compiler flag for backend
   if(${TUNING_TARGET} STREQUAL "INTEL_GPU")
@@ -130,6 +145,12 @@ function(set_target_compile_def in_target)
       target_compile_definitions(${in_target} PUBLIC BLAS_ENABLE_HALF=1)
     endif()
   endif()
+  if(${BLAS_ENABLE_BFLOAT16})
+    if("${in_target}" IN_LIST BF16_DATA_OPS)
+      message(STATUS "BFloat16 Data type support enabled for target ${in_target}")
+      target_compile_definitions(${in_target} PUBLIC BLAS_ENABLE_BFLOAT16=1)
+    endif()
+  endif()
 endfunction()
 
 # blas unary function for generating source code
@@ -150,6 +171,13 @@ function(generate_blas_objects blas_level func)
       list(APPEND data_list_c "half")
     endif()
   endif()
+  # Extend data_list with 'bfloat16' if target function is
+  # in BF16_DATA_OPS
+  if(BLAS_ENABLE_BFLOAT16)
+    if("${func}" IN_LIST BF16_DATA_OPS)
+      list(APPEND data_list_c "bfloat16")
+    endif()
+  endif()
   foreach(data_in ${data_list_c})
     set(data_list_out ${data_in})
     # When using half with Gemm target, generate a mixed-precision
@@ -754,6 +782,7 @@ function (build_library LIB_NAME ENABLE_EXTENSIONS)
                 $<TARGET_OBJECTS:swap>
                 $<TARGET_OBJECTS:gbmv>
                 $<TARGET_OBJECTS:gemv>
+                $<TARGET_OBJECTS:gemv_batch>
                 $<TARGET_OBJECTS:ger>
                 $<TARGET_OBJECTS:sbmv>
                 $<TARGET_OBJECTS:spmv>
@@ -777,7 +806,11 @@ function (build_library LIB_NAME ENABLE_EXTENSIONS)
                 $<TARGET_OBJECTS:transpose>
                 $<TARGET_OBJECTS:omatadd>
                 $<TARGET_OBJECTS:omatadd_batch>
-                $<TARGET_OBJECTS:axpy_batch>)
+                $<TARGET_OBJECTS:axpy_batch>
+                $<TARGET_OBJECTS:reduction_batch>
+                $<TARGET_OBJECTS:rot_batch>
+                $<TARGET_OBJECTS:axpby>
+                $<TARGET_OBJECTS:axpy_dot>)
 
    if (${ENABLE_EXTENSIONS})
      list(APPEND LIB_SRCS $<TARGET_OBJECTS:reduction>)
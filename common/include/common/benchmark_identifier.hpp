@@ -59,7 +59,8 @@ enum class Level2Op : int {
   tpmv = 12,
   tpsv = 13,
   trmv = 14,
-  trsv = 15
+  trsv = 15,
+  gemv_batched_strided = 16
 };
 
 enum class Level3Op : int {
@@ -83,7 +84,18 @@ enum class ExtensionOp : int {
   omatadd_batch = 5,
   omatcopy2 = 6,
   reduction = 7,
-  axpy_batch = 8
+  axpy_batch = 8,
+  plan_replay = 9,
+  gemm_batched_sub_devices = 10,
+  temp_mem_pool = 11,
+  temp_mem_pool_ops = 12,
+  reduction_launch = 13,
+  krylov_fused = 14,
+  reproducible = 15,
+  unit_stride = 16,
+  low_precision = 17,
+  async_scalar = 18,
+  rot_batch = 19
 };
 
 template <Level1Op op>
@@ -150,6 +162,8 @@ std::string get_operator_name() {
     return "Trmv";
   else if constexpr (op == Level2Op::trsv)
     return "Trsv";
+  else if constexpr (op == Level2Op::gemv_batched_strided)
+    return "Gemv_batched_strided";
   else
     throw std::runtime_error("Unknown BLAS 2 operator");
 }
@@ -198,6 +212,28 @@ std::string get_operator_name() {
     return "Reduction";
   else if constexpr (op == ExtensionOp::axpy_batch)
     return "Axpy_batch";
+  else if constexpr (op == ExtensionOp::plan_replay)
+    return "Plan_replay";
+  else if constexpr (op == ExtensionOp::gemm_batched_sub_devices)
+    return "Gemm_batched_sub_devices";
+  else if constexpr (op == ExtensionOp::temp_mem_pool)
+    return "Temp_mem_pool";
+  else if constexpr (op == ExtensionOp::temp_mem_pool_ops)
+    return "Temp_mem_pool_ops";
+  else if constexpr (op == ExtensionOp::reduction_launch)
+    return "Reduction_launch";
+  else if constexpr (op == ExtensionOp::krylov_fused)
+    return "Krylov_fused";
+  else if constexpr (op == ExtensionOp::reproducible)
+    return "Reproducible";
+  else if constexpr (op == ExtensionOp::unit_stride)
+    return "Unit_stride";
+  else if constexpr (op == ExtensionOp::low_precision)
+    return "Low_precision";
+  else if constexpr (op == ExtensionOp::async_scalar)
+    return "Async_scalar";
+  else if constexpr (op == ExtensionOp::rot_batch)
+    return "Rot_batch";
   else
     throw std::runtime_error("Unknown BLAS extension operator");
 }
@@ -50,6 +50,10 @@ std::string get_parameters_as_string(T arg, Args... args) {
   return str.str();
 }
 
+inline std::string get_name_tag() {
+  return name_tag().empty() ? std::string{} : "/" + name_tag();
+}
+
 template <typename scalar_t>
 inline std::string get_benchmark_name(const std::string &operator_name) {
   std::ostringstream str{};
@@ -66,7 +70,7 @@ template <Level1Op op, typename scalar_t, typename... Args>
 inline std::string get_name(Args... args) {
   std::ostringstream str{};
   str << get_name<op, scalar_t>() << "/";
-  str << get_parameters_as_string(args...);
+  str << get_parameters_as_string(args...) << get_name_tag();
   return str.str();
 }
 
@@ -74,7 +78,7 @@ template <Level2Op op, typename scalar_t, typename... Args>
 inline std::string get_name(Args... args) {
   std::ostringstream str{};
   str << get_benchmark_name<scalar_t>(get_operator_name<op>()) << "/";
-  str << get_parameters_as_string(args...);
+  str << get_parameters_as_string(args...) << get_name_tag();
   return str.str();
 }
 
@@ -82,7 +86,7 @@ template <Level3Op op, typename scalar_t, typename... Args>
 inline std::string get_name(Args... args) {
   std::ostringstream str{};
   str << get_benchmark_name<scalar_t>(get_operator_name<op>()) << "/";
-  str << get_parameters_as_string(args...);
+  str << get_parameters_as_string(args...) << get_name_tag();
   return str.str();
 }
 
@@ -90,7 +94,7 @@ template <ExtensionOp op, typename scalar_t, typename... Args>
 inline std::string get_name(Args... args) {
   std::ostringstream str{};
   str << get_benchmark_name<scalar_t>(get_operator_name<op>()) << "/";
-  str << get_parameters_as_string(args...);
+  str << get_parameters_as_string(args...) << get_name_tag();
   return str.str();
 }
 
@@ -135,6 +139,16 @@ get_name(std::string t, index_t m, index_t n, std::string mem_type) {
   return internal::get_name<op, scalar_t>(t, m, n, mem_type);
 }
 
+template <Level2Op op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == Level2Op::gemv_batched_strided,
+                               std::string>::type
+get_name(std::string t, index_t m, index_t n, index_t batch_size,
+         index_t stride_a_mul, index_t stride_x_mul, index_t stride_y_mul,
+         std::string mem_type) {
+  return internal::get_name<op, scalar_t>(t, m, n, batch_size, stride_a_mul,
+                                          stride_x_mul, stride_y_mul, mem_type);
+}
+
 template <Level2Op op, typename scalar_t, typename index_t>
 inline typename std::enable_if<op == Level2Op::ger, std::string>::type get_name(
     index_t m, index_t n, std::string mem_type) {
@@ -305,6 +319,90 @@ get_name(index_t n, scalar_t alpha, index_t inc_x, index_t inc_y,
                                           stride_y_mul, batch_size, mem_type);
 }
 
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::plan_replay,
+                               std::string>::type
+get_name(index_t n, int replay, std::string mem_type) {
+  return internal::get_name<op, scalar_t>(n, replay, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::gemm_batched_sub_devices,
+                               std::string>::type
+get_name(std::string t1, std::string t2, index_t m, index_t k, index_t n,
+         index_t batch_size, index_t sub_devices, std::string mem_type) {
+  return internal::get_name<op, scalar_t>(t1, t2, m, k, n, batch_size,
+                                          sub_devices, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::temp_mem_pool,
+                               std::string>::type
+get_name(index_t n, std::string mem_type) {
+  return internal::get_name<op, scalar_t>(n, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::temp_mem_pool_ops,
+                               std::string>::type
+get_name(std::string operation, index_t n, int pool, std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, pool, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::reduction_launch,
+                               std::string>::type
+get_name(std::string operation, index_t n, int planned, std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, planned, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::krylov_fused,
+                               std::string>::type
+get_name(std::string operation, index_t n, int fused, std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, fused, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::reproducible,
+                               std::string>::type
+get_name(std::string operation, index_t n, int reproducible,
+         std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, reproducible, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::unit_stride,
+                               std::string>::type
+get_name(std::string operation, index_t n, int packed, std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, packed, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::low_precision,
+                               std::string>::type
+get_name(std::string operation, index_t n, std::string storage,
+         std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, storage, mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::async_scalar,
+                               std::string>::type
+get_name(std::string operation, index_t n, int reductions, int async,
+         std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, reductions, async,
+                                          mem_type);
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::rot_batch, std::string>::type
+get_name(std::string operation, index_t n, index_t batch_size, int batched,
+         std::string mem_type) {
+  return internal::get_name<op, scalar_t>(operation, n, batch_size, batched,
+                                          mem_type);
+}
+
 }  // namespace utils
 }  // namespace blas_benchmark
 
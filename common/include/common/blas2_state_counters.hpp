@@ -100,6 +100,44 @@ init_level_2_counters(benchmark::State& state, const char* t_str,
   return;
 }
 
+template <Level2Op op, typename scalar_t>
+inline typename std::enable_if<op == Level2Op::gemv_batched_strided>::type
+init_level_2_counters(benchmark::State& state, const char* t_str,
+                      scalar_t beta, index_t m, index_t n, index_t batch_size,
+                      index_t stride_a_mul, index_t stride_x_mul,
+                      index_t stride_y_mul) {
+  // Google-benchmark counters are double.
+  double beta_d = static_cast<double>(beta);
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double batch_size_d = static_cast<double>(batch_size);
+  double xlen = t_str[0] == 'n' ? n_d : m_d;
+  double ylen = t_str[0] == 'n' ? m_d : n_d;
+  state.counters["beta"] = beta_d;
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+  state.counters["batch_size"] = batch_size_d;
+  state.counters["stride_a_mul"] = static_cast<double>(stride_a_mul);
+  state.counters["stride_x_mul"] = static_cast<double>(stride_x_mul);
+  state.counters["stride_y_mul"] = static_cast<double>(stride_y_mul);
+
+  const double nflops_AtimesX = 2.0 * m_d * n_d;
+  const double nflops_timesAlpha = ylen;
+  const double nflops_addBetaY = (beta != scalar_t{0}) ? 2 * ylen : 0;
+  const double nflops_tot =
+      (nflops_AtimesX + nflops_timesAlpha + nflops_addBetaY) * batch_size_d;
+  state.counters["n_fl_ops"] = nflops_tot;
+
+  const double mem_readA = m_d * n_d;
+  const double mem_readX = xlen;
+  const double mem_writeY = ylen;
+  const double mem_readY = (beta != scalar_t{0}) ? ylen : 0;
+  state.counters["bytes_processed"] =
+      (mem_readA + mem_readX + mem_writeY + mem_readY) * batch_size_d *
+      sizeof(scalar_t);
+  return;
+}
+
 template <Level2Op op, typename scalar_t>
 inline typename std::enable_if<op == Level2Op::ger>::type init_level_2_counters(
     benchmark::State& state, const char* t_str, scalar_t beta = scalar_t{0},
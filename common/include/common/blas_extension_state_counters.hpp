@@ -106,6 +106,238 @@ init_extension_counters(benchmark::State& state, index_t n,
       3 * size_d * sizeof(scalar_t) * batch_size;
   return;
 }
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::plan_replay>::type
+init_extension_counters(benchmark::State& state, index_t n) {
+  // Chain of a square gemv followed by an axpy and a scal of size n
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  state.counters["n"] = size_d;
+  state.counters["n_fl_ops"] = 2.0 * size_d * size_d + 3.0 * size_d;
+  state.counters["bytes_processed"] =
+      (size_d * size_d + 8.0 * size_d) * sizeof(scalar_t);
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<
+    op == ExtensionOp::gemm_batched_sub_devices>::type
+init_extension_counters(benchmark::State& state, scalar_t beta, index_t m,
+                        index_t n, index_t k, index_t batch_size,
+                        index_t sub_devices) {
+  // Same counters as the strided batched gemm
+  // Google-benchmark counters are double.
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double k_d = static_cast<double>(k);
+  double batch_size_d = static_cast<double>(batch_size);
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+  state.counters["k"] = k_d;
+  state.counters["batch_size"] = batch_size_d;
+  state.counters["sub_devices"] = static_cast<double>(sub_devices);
+  const double nflops_addBetaC = (beta != scalar_t{0}) ? 2 * m_d * n_d : 0;
+  state.counters["n_fl_ops"] =
+      (2 * k_d * m_d * n_d + m_d * n_d + nflops_addBetaC) * batch_size_d;
+  const double mem_readC = (beta != scalar_t{0}) ? m_d * n_d : 0;
+  state.counters["bytes_processed"] =
+      (m_d * k_d + k_d * n_d + mem_readC + m_d * n_d) * batch_size_d *
+      sizeof(scalar_t);
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::temp_mem_pool>::type
+init_extension_counters(benchmark::State& state, index_t n) {
+  // Google-benchmark counters are double.
+  state.counters["n"] = static_cast<double>(n);
+  state.counters["bytes"] = static_cast<double>(n) * sizeof(scalar_t);
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::temp_mem_pool_ops>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n, int pool) {
+  // Transposed gemv, iamax or left lower trsm of size n
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  state.counters["n"] = size_d;
+  state.counters["pool"] = static_cast<double>(pool);
+  if (operation == "gemv") {
+    state.counters["n_fl_ops"] = 2.0 * size_d * size_d;
+    state.counters["bytes_processed"] =
+        (size_d * size_d + 2.0 * size_d) * sizeof(scalar_t);
+  } else if (operation == "iamax") {
+    state.counters["n_fl_ops"] = 2.0 * size_d;
+    state.counters["bytes_processed"] = size_d * sizeof(scalar_t);
+  } else {
+    state.counters["n_fl_ops"] = size_d * size_d * size_d;
+    state.counters["bytes_processed"] =
+        (size_d * (size_d + 1) / 2 + 2.0 * size_d * size_d) * sizeof(scalar_t);
+  }
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::reduction_launch>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n, int planned) {
+  // dot, nrm2 or asum of size n
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  state.counters["n"] = size_d;
+  state.counters["planned"] = static_cast<double>(planned);
+  if (operation == "dot") {
+    state.counters["n_fl_ops"] = 2.0 * size_d;
+    state.counters["bytes_processed"] = (2.0 * size_d + 1) * sizeof(scalar_t);
+  } else {
+    state.counters["n_fl_ops"] = 2.0 * size_d;
+    state.counters["bytes_processed"] = (size_d + 1) * sizeof(scalar_t);
+  }
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::krylov_fused>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n, index_t k, int fused) {
+  // axpby, axpy_dot or multi_dot of size n. The bytes are those of the fused
+  // operation whatever fused, so that the bandwidths compare the times.
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  state.counters["n"] = size_d;
+  state.counters["fused"] = static_cast<double>(fused);
+  if (operation == "axpby") {
+    state.counters["n_fl_ops"] = 3.0 * size_d;
+    state.counters["bytes_processed"] = 3.0 * size_d * sizeof(scalar_t);
+  } else if (operation == "axpy_dot") {
+    state.counters["n_fl_ops"] = 4.0 * size_d;
+    state.counters["bytes_processed"] = (4.0 * size_d + 1) * sizeof(scalar_t);
+  } else {
+    double k_d = static_cast<double>(k);
+    state.counters["k"] = k_d;
+    state.counters["n_fl_ops"] = 2.0 * k_d * size_d;
+    state.counters["bytes_processed"] =
+        ((k_d + 1) * size_d + k_d) * sizeof(scalar_t);
+  }
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::reproducible>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n, int reproducible) {
+  // dot, nrm2 or asum of size n
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  state.counters["n"] = size_d;
+  state.counters["reproducible"] = static_cast<double>(reproducible);
+  state.counters["n_fl_ops"] = 2.0 * size_d;
+  const double vectors = operation == "dot" ? 2.0 : 1.0;
+  state.counters["bytes_processed"] = (vectors * size_d + 1) * sizeof(scalar_t);
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::unit_stride>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n, int packed) {
+  // axpy, scal, copy or swap of size n with unit strides
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  state.counters["n"] = size_d;
+  state.counters["packed"] = static_cast<double>(packed);
+  if (operation == "axpy") {
+    state.counters["n_fl_ops"] = 2.0 * size_d;
+    state.counters["bytes_processed"] = 3.0 * size_d * sizeof(scalar_t);
+  } else if (operation == "scal") {
+    state.counters["n_fl_ops"] = size_d;
+    state.counters["bytes_processed"] = 2.0 * size_d * sizeof(scalar_t);
+  } else if (operation == "copy") {
+    state.counters["n_fl_ops"] = 0.0;
+    state.counters["bytes_processed"] = 2.0 * size_d * sizeof(scalar_t);
+  } else {
+    state.counters["n_fl_ops"] = 0.0;
+    state.counters["bytes_processed"] = 4.0 * size_d * sizeof(scalar_t);
+  }
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::low_precision>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n) {
+  // axpy, scal, copy, rot, dot or nrm2 of size n on vectors of scalar_t
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  state.counters["n"] = size_d;
+  state.counters["storage_bytes"] = static_cast<double>(sizeof(scalar_t));
+  if (operation == "axpy") {
+    state.counters["n_fl_ops"] = 2.0 * size_d;
+    state.counters["bytes_processed"] = 3.0 * size_d * sizeof(scalar_t);
+  } else if (operation == "scal") {
+    state.counters["n_fl_ops"] = size_d;
+    state.counters["bytes_processed"] = 2.0 * size_d * sizeof(scalar_t);
+  } else if (operation == "copy") {
+    state.counters["n_fl_ops"] = 0.0;
+    state.counters["bytes_processed"] = 2.0 * size_d * sizeof(scalar_t);
+  } else if (operation == "rot") {
+    state.counters["n_fl_ops"] = 6.0 * size_d;
+    state.counters["bytes_processed"] = 4.0 * size_d * sizeof(scalar_t);
+  } else if (operation == "dot") {
+    state.counters["n_fl_ops"] = 2.0 * size_d;
+    state.counters["bytes_processed"] = (2.0 * size_d + 1) * sizeof(scalar_t);
+  } else {
+    state.counters["n_fl_ops"] = 2.0 * size_d;
+    state.counters["bytes_processed"] = (size_d + 1) * sizeof(scalar_t);
+  }
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::async_scalar>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n, int reductions, int async) {
+  // reductions back-to-back dot, nrm2, asum or iamax of size n
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  double reductions_d = static_cast<double>(reductions);
+  state.counters["n"] = size_d;
+  state.counters["reductions"] = reductions_d;
+  state.counters["async"] = static_cast<double>(async);
+  state.counters["n_fl_ops"] = reductions_d * 2.0 * size_d;
+  const double vectors = operation == "dot" ? 2.0 : 1.0;
+  state.counters["bytes_processed"] =
+      reductions_d * (vectors * size_d + 1) * sizeof(scalar_t);
+  return;
+}
+
+template <ExtensionOp op, typename scalar_t, typename index_t>
+inline typename std::enable_if<op == ExtensionOp::rot_batch>::type
+init_extension_counters(benchmark::State& state, std::string operation,
+                        index_t n, index_t batch_size, int batched) {
+  // batch_size rotg, or rot or rotm of size n
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(n);
+  double batch_size_d = static_cast<double>(batch_size);
+  state.counters["n"] = size_d;
+  state.counters["batch_size"] = batch_size_d;
+  state.counters["batched"] = static_cast<double>(batched);
+  if (operation == "rotg") {
+    state.counters["n_fl_ops"] = 6.0 * batch_size_d;
+    state.counters["bytes_processed"] = 6.0 * batch_size_d * sizeof(scalar_t);
+  } else if (operation == "rot") {
+    state.counters["n_fl_ops"] = 6.0 * size_d * batch_size_d;
+    state.counters["bytes_processed"] =
+        (4.0 * size_d + 2.0) * batch_size_d * sizeof(scalar_t);
+  } else {
+    state.counters["n_fl_ops"] = 6.0 * size_d * batch_size_d;
+    state.counters["bytes_processed"] =
+        (4.0 * size_d + 5.0) * batch_size_d * sizeof(scalar_t);
+  }
+  return;
+}
 }  // namespace utils
 }  // namespace blas_benchmark
 
@@ -36,6 +36,11 @@ template <typename scalar_t>
 using blas2_param_t =
     std::tuple<std::string, index_t, index_t, scalar_t, scalar_t>;
 
+template <typename scalar_t>
+using gemv_batched_strided_param_t =
+    std::tuple<std::string, index_t, index_t, scalar_t, scalar_t, index_t,
+               index_t, index_t, index_t>;
+
 template <typename scalar_t>
 using copy_param_t = std::tuple<index_t, index_t, index_t, scalar_t>;
 
@@ -346,6 +351,51 @@ static inline std::vector<blas2_param_t<scalar_t>> get_blas2_params(
   }
 }
 
+/**
+ * @fn get_gemv_batched_strided_params
+ * @brief Returns a vector containing the gemv_batched_strided benchmark
+ * parameters, either read from a file according to the command-line args, or
+ * the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<gemv_batched_strided_param_t<scalar_t>>
+get_gemv_batched_strided_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<gemv_batched_strided_param_t<scalar_t>>
+        gemv_batched_strided_default;
+    constexpr index_t dmin = 8, dmax = 256;
+    scalar_t alpha = 1;
+    scalar_t beta = 1;
+    index_t batch_size = 1024;
+    for (std::string t : {"n", "t"}) {
+      for (index_t n = dmin; n <= dmax; n *= 2) {
+        gemv_batched_strided_default.push_back(
+            std::make_tuple(t, n, n, alpha, beta, batch_size, 1, 1, 1));
+      }
+    }
+    return gemv_batched_strided_default;
+  } else {
+    return parse_csv_file<gemv_batched_strided_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 9) {
+            throw std::runtime_error(
+                "invalid number of parameters (9 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0].c_str(), str_to_int<index_t>(v[1]),
+                str_to_int<index_t>(v[2]), str_to_scalar<scalar_t>(v[3]),
+                str_to_scalar<scalar_t>(v[4]), str_to_int<index_t>(v[5]),
+                str_to_int<index_t>(v[6]), str_to_int<index_t>(v[7]),
+                str_to_int<index_t>(v[8]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
 /**
  * @fn get_copy_params
  * @brief Returns a vector containing the blas1 copy benchmark parameters,
@@ -1865,6 +1915,16 @@ static inline double time_events(std::vector<event_t> es) {
   return total_time;
 }
 
+template <typename event_t, std::size_t inline_capacity>
+static inline double time_events(
+    blas::SmallVector<event_t, inline_capacity> es) {
+  double total_time = 0;
+  for (auto e : es) {
+    total_time += time_event(e);
+  }
+  return total_time;
+}
+
 template <typename event_t, typename... other_events_t>
 static inline double time_events(event_t first_event,
                                  other_events_t... next_events) {
@@ -1891,9 +1951,37 @@ static inline std::tuple<double, double> timef(function_t func,
 
 // Functions to initialize and update the counters
 
+/**
+ * @brief Optional callbacks adding backend specific counters to the
+ * benchmarks, e.g. the memory pool statistics of portBLAS. init is called by
+ * init_counters, before the measurement, and report by calc_avg_counters.
+ */
+struct extra_counters_t {
+  std::function<void(benchmark::State&)> init;
+  std::function<void(benchmark::State&)> report;
+};
+
+static inline extra_counters_t& extra_counters() {
+  static extra_counters_t callbacks;
+  return callbacks;
+}
+
+/**
+ * @brief Optional last parameter of the names of the benchmarks registered
+ * next, telling apart the variants of the same benchmarks run by an
+ * executable. Empty by default.
+ */
+static inline std::string& name_tag() {
+  static std::string tag;
+  return tag;
+}
+
 static inline void init_counters(benchmark::State& state) {
   state.counters["best_event_time"] = double(ULONG_MAX);
   state.counters["best_overall_time"] = double(ULONG_MAX);
+  if (extra_counters().init) {
+    extra_counters().init(state);
+  }
 }
 
 static inline void update_counters(benchmark::State& state,
@@ -1915,6 +2003,9 @@ static inline void calc_avg_counters(benchmark::State& state) {
       state.counters["total_event_time"] / state.iterations();
   state.counters["avg_overall_time"] =
       state.counters["total_overall_time"] / state.iterations();
+  if (extra_counters().report) {
+    extra_counters().report(state);
+  }
 }
 
 }  // namespace utils
@@ -38,6 +38,9 @@
 #include <ext/oneapi/experimental/sycl_complex.hpp>
 #endif
 #endif
+#ifdef BLAS_ENABLE_BFLOAT16
+#include <sycl/ext/oneapi/bfloat16.hpp>
+#endif
 
 namespace blas {
 
@@ -163,8 +166,8 @@ index_t vec_total_size(index_t &vector_size, vector_t &&current_vector) {
   return 0;
 }
 
-template <typename vector_t>
-int append_vector(vector_t &lhs_vector, vector_t const &rhs_vector) {
+template <typename vector_t, typename other_vector_t>
+int append_vector(vector_t &lhs_vector, other_vector_t const &rhs_vector) {
   lhs_vector.insert(lhs_vector.end(), rhs_vector.begin(), rhs_vector.end());
   return 0;
 }
@@ -203,6 +206,36 @@ template <class type>
 struct is_half
     : std::integral_constant<bool, std::is_same_v<type, sycl::half>> {};
 
+#ifdef BLAS_ENABLE_BFLOAT16
+// SYCL bfloat16 type alias
+using bfloat16 = sycl::ext::oneapi::bfloat16;
+
+template <>
+struct is_sycl_scalar<bfloat16> : std::true_type {};
+#endif
+
+/**
+ * @brief Type in which the reductions over vectors of value_t accumulate.
+ * The 16-bit floating point types are only used for storage and accumulate
+ * in float.
+ */
+template <typename value_t>
+struct AccumulatorType {
+  using type = value_t;
+};
+
+template <>
+struct AccumulatorType<sycl::half> {
+  using type = float;
+};
+
+#ifdef BLAS_ENABLE_BFLOAT16
+template <>
+struct AccumulatorType<bfloat16> {
+  using type = float;
+};
+#endif
+
 #ifdef BLAS_ENABLE_COMPLEX
 // SYCL Complex type alias
 template <typename T>
@@ -0,0 +1,284 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename small_vector.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_SMALL_VECTOR_H
+#define PORTBLAS_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+/*! SmallVector.
+ * @brief Sequence container storing up to inline_capacity elements inside the
+ * object itself, and falling back to the heap beyond that.
+ *
+ * It implements the subset of the std::vector interface used for event lists,
+ * and converts implicitly from and to std::vector so that code written against
+ * std::vector<sycl::event> keeps compiling.
+ *
+ * @tparam element_t Element type.
+ * @tparam inline_capacity Number of elements stored without heap allocation.
+ */
+template <typename element_t, std::size_t inline_capacity>
+class SmallVector {
+  static_assert(inline_capacity > 0, "The inline capacity must be positive");
+
+ public:
+  using value_type = element_t;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = element_t&;
+  using const_reference = const element_t&;
+  using pointer = element_t*;
+  using const_pointer = const element_t*;
+  using iterator = element_t*;
+  using const_iterator = const element_t*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  SmallVector() noexcept
+      : data_(inline_data()), size_(0), capacity_(inline_capacity) {}
+
+  SmallVector(std::initializer_list<element_t> init) : SmallVector() {
+    append(init.begin(), init.end());
+  }
+
+  /*!
+   * @brief Implicit conversion from std::vector, for callers building their
+   * dependency lists with std::vector.
+   */
+  SmallVector(const std::vector<element_t>& other) : SmallVector() {
+    append(other.begin(), other.end());
+  }
+
+  SmallVector(const SmallVector& other) : SmallVector() {
+    append(other.begin(), other.end());
+  }
+
+  SmallVector(SmallVector&& other) noexcept(
+      std::is_nothrow_move_constructible<element_t>::value)
+      : SmallVector() {
+    steal(std::move(other));
+  }
+
+  ~SmallVector() {
+    clear();
+    release_heap();
+  }
+
+  SmallVector& operator=(const SmallVector& other) {
+    if (this != &other) {
+      clear();
+      append(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  SmallVector& operator=(SmallVector&& other) noexcept(
+      std::is_nothrow_move_constructible<element_t>::value) {
+    if (this != &other) {
+      clear();
+      release_heap();
+      steal(std::move(other));
+    }
+    return *this;
+  }
+
+  SmallVector& operator=(std::initializer_list<element_t> init) {
+    clear();
+    append(init.begin(), init.end());
+    return *this;
+  }
+
+  /*!
+   * @brief Implicit conversion to std::vector, for callers storing the
+   * returned events in a std::vector. This conversion allocates.
+   */
+  operator std::vector<element_t>() const {
+    return std::vector<element_t>(begin(), end());
+  }
+
+  inline size_type size() const noexcept { return size_; }
+  inline bool empty() const noexcept { return size_ == 0; }
+  inline size_type capacity() const noexcept { return capacity_; }
+
+  /*!
+   * @brief Whether the elements are held in the inline storage.
+   */
+  inline bool is_inline() const noexcept {
+    return data_ == const_cast<SmallVector*>(this)->inline_data();
+  }
+
+  inline pointer data() noexcept { return data_; }
+  inline const_pointer data() const noexcept { return data_; }
+
+  inline iterator begin() noexcept { return data_; }
+  inline iterator end() noexcept { return data_ + size_; }
+  inline const_iterator begin() const noexcept { return data_; }
+  inline const_iterator end() const noexcept { return data_ + size_; }
+  inline const_iterator cbegin() const noexcept { return data_; }
+  inline const_iterator cend() const noexcept { return data_ + size_; }
+  inline reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  inline reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  inline const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  inline const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  inline reference operator[](size_type i) noexcept { return data_[i]; }
+  inline const_reference operator[](size_type i) const noexcept {
+    return data_[i];
+  }
+  inline reference front() noexcept { return data_[0]; }
+  inline const_reference front() const noexcept { return data_[0]; }
+  inline reference back() noexcept { return data_[size_ - 1]; }
+  inline const_reference back() const noexcept { return data_[size_ - 1]; }
+
+  inline void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) {
+      grow(new_capacity);
+    }
+  }
+
+  inline void clear() noexcept {
+    std::destroy(data_, data_ + size_);
+    size_ = 0;
+  }
+
+  inline void push_back(const element_t& value) { emplace_back(value); }
+
+  inline void push_back(element_t&& value) { emplace_back(std::move(value)); }
+
+  template <typename... args_t>
+  inline reference emplace_back(args_t&&... args) {
+    if (size_ == capacity_) {
+      grow(2 * capacity_);
+    }
+    new (data_ + size_) element_t(std::forward<args_t>(args)...);
+    return data_[size_++];
+  }
+
+  inline void pop_back() noexcept {
+    --size_;
+    std::destroy_at(data_ + size_);
+  }
+
+  /*!
+   * @brief Inserts the range [first, last) before @p pos.
+   */
+  template <typename input_iterator_t>
+  iterator insert(const_iterator pos, input_iterator_t first,
+                  input_iterator_t last) {
+    const size_type offset = static_cast<size_type>(pos - begin());
+    const size_type old_size = size_;
+    append(first, last);
+    std::rotate(begin() + offset, begin() + old_size, end());
+    return begin() + offset;
+  }
+
+ private:
+  inline element_t* inline_data() noexcept {
+    return std::launder(reinterpret_cast<element_t*>(inline_storage_));
+  }
+
+  template <typename input_iterator_t>
+  inline void append(input_iterator_t first, input_iterator_t last) {
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      input_iterator_t>::iterator_category>::
+                      value) {
+      reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+
+  inline void grow(size_type new_capacity) {
+    element_t* new_data = static_cast<element_t*>(
+        ::operator new(new_capacity * sizeof(element_t),
+                       std::align_val_t{alignof(element_t)}));
+    std::uninitialized_move(data_, data_ + size_, new_data);
+    std::destroy(data_, data_ + size_);
+    release_heap();
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  inline void release_heap() noexcept {
+    if (!is_inline()) {
+      ::operator delete(data_, std::align_val_t{alignof(element_t)});
+      data_ = inline_data();
+      capacity_ = inline_capacity;
+    }
+  }
+
+  /*!
+   * @brief Takes the content of @p other and leaves it empty. This vector must
+   * be empty and use its inline storage.
+   */
+  inline void steal(SmallVector&& other) {
+    if (other.is_inline()) {
+      std::uninitialized_move(other.begin(), other.end(), data_);
+      size_ = other.size_;
+      other.clear();
+    } else {
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_data();
+      other.size_ = 0;
+      other.capacity_ = inline_capacity;
+    }
+  }
+
+  alignas(element_t) unsigned char inline_storage_[inline_capacity *
+                                                   sizeof(element_t)];
+  element_t* data_;
+  size_type size_;
+  size_type capacity_;
+};
+
+/*!
+ * @brief Container of SYCL events returned and taken as dependencies by the
+ * BLAS calls. Most calls depend on, and produce, one or two events, which then
+ * never reach the heap.
+ */
+using event_vector_t = SmallVector<sycl::event, 4>;
+
+}  // namespace blas
+
+#endif  // PORTBLAS_SMALL_VECTOR_H
@@ -25,6 +25,8 @@
 #ifndef PORTBLAS_BLAS1_INTERFACE_H
 #define PORTBLAS_BLAS1_INTERFACE_H
 #include "blas_meta.h"
+#include "sb_handle/scalar_future.h"
+#include "sb_handle/workspace.h"
 
 namespace blas {
 namespace internal {
@@ -34,6 +36,8 @@ namespace internal {
  * Implements AXPY \f$y = ax + y\f$
  *
  * @param sb_handle SB_Handle
+ * @param _alpha Scalar, or BufferIterator or USM pointer to a scalar in
+ * device memory
  * @param _vx BufferIterator or USM pointer
  * @param _incx Increment for the vector X
  * @param _vy BufferIterator or USM pointer
@@ -152,6 +156,14 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
     container_1_t _rs, const index_t _nWG,
     const typename sb_handle_t::event_t &_dependencies);
 
+template <int localSize, bool is_max, typename sb_handle_t,
+          typename container_0_t, typename container_1_t, typename index_t,
+          typename increment_t>
+typename sb_handle_t::event_t _iamax_iamin_packed(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _rs, const index_t _nWG,
+    const typename sb_handle_t::event_t &_dependencies);
+
 /**
  * \brief IAMAX finds the index of the first element having maximum
  * @param _vx BufferIterator or USM pointer
@@ -198,6 +210,9 @@ typename sb_handle_t::event_t _swap(
 /**
  * \brief SCALAR operation on a vector
  * @param sb_handle_t sb_handle
+ * @param _alpha Scalar, or BufferIterator or USM pointer to a scalar in
+ * device memory. A zero alpha in device memory sets x to zero, as on the
+ * host.
  * @param _vx BufferIterator or USM pointer
  * @param _incx Increment for the vector X
  * @param _dependencies Vector of events
@@ -278,6 +293,64 @@ typename sb_handle_t::event_t _dot_impl(
     const index_t _number_wg,
     const typename sb_handle_t::event_t &_dependencies);
 
+/*!
+ * \brief Work group size and number of work groups of a one-pass reduction.
+ */
+template <typename index_t>
+struct reduction_launch_t {
+  index_t local_size;
+  index_t number_WG;
+};
+
+/*!
+ * \brief Plans the launch of the one-pass reductions (dot, nrm2, asum) without
+ * local memory. See documentation in the blas1_interface.hpp file for details.
+ */
+template <typename sb_handle_t, typename index_t>
+reduction_launch_t<index_t> plan_reduction_launch(sb_handle_t &sb_handle,
+                                                  index_t _N);
+
+/*!
+ * \brief Calls @p launch with the work group size of a reduction launch as a
+ * std::integral_constant. See documentation in the blas1_interface.hpp file
+ * for details.
+ */
+template <typename index_t, typename launch_t>
+auto dispatch_reduction_local_size(index_t local_size, launch_t launch);
+
+/*!
+ * \brief Reduces a tree into a single element in a fixed order, for the
+ * reproducible mode of the SB_Handle. See documentation in the
+ * blas1_interface.hpp file for details.
+ */
+template <typename operator_t, typename sb_handle_t, typename lhs_t,
+          typename rhs_t, typename index_t>
+typename sb_handle_t::event_t _reproducible_reduction(
+    sb_handle_t &sb_handle, index_t _N, lhs_t &rs, rhs_t &op,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/*!
+ * \brief Executes the elementwise tree built by @p build_tree over unit
+ * stride vectors, with sycl::vec packets when possible. See documentation in
+ * the blas1_interface.hpp file for details.
+ */
+template <typename increment_t, typename sb_handle_t, typename index_t,
+          typename tree_builder_t, typename... container_t>
+typename sb_handle_t::event_t _execute_unit_stride(
+    sb_handle_t &sb_handle, index_t _N, tree_builder_t build_tree,
+    const typename sb_handle_t::event_t &_dependencies, container_t... _vs);
+
+/*!
+ * \brief Runs a reduction into the single element _rs of a 16-bit type through
+ * a float temporary. See documentation in the blas1_interface.hpp file for
+ * details.
+ */
+template <typename index_t, typename increment_t, typename sb_handle_t,
+          typename container_t, typename reduce_t>
+typename sb_handle_t::event_t _reduce_with_accumulator(
+    sb_handle_t &sb_handle, container_t _rs, reduce_t reduce,
+    const typename sb_handle_t::event_t &_dependencies);
+
 /**
  * @brief _rot constructor given plane rotation
  * @param sb_handle SB_Handle
@@ -285,8 +358,10 @@ typename sb_handle_t::event_t _dot_impl(
  * @param _incx Increment for the vector X
  * @param _vx BufferIterator or USM pointer
  * @param _incy Increment for the vector Y
- * @param _sin sine
- * @param _cos cosine
+ * @param _sin sine, or BufferIterator or USM pointer to it in device
+ * memory
+ * @param _cos cosine, or BufferIterator or USM pointer to it in device
+ * memory
  * @param _N data size
  * @param _dependencies Vector of events
  */
@@ -529,6 +604,100 @@ typename ValueType<container_t>::type _nrm2(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t &_dependencies);
 
+/**
+ * \brief Computes the inner product of two vectors (future version that
+ * returns before the result is available)
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ * @return Scalar_Future holding the result.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Future<typename ValueType<container_0_t>::type> _dot_async(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief Computes the inner product of two vectors with double precision
+ * accumulation and adds a scalar to the result (future version that returns
+ * before the result is available)
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes. If size 0, the result will be sb.
+ * @param sb Scalar to add to the results of the inner product.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ * @return Scalar_Future holding the result.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Future<typename ValueType<container_0_t>::type> _sdsdot_async(
+    sb_handle_t &sb_handle, index_t _N, float sb, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief IAMAX finds the index of the first element having maximum (future
+ * version that returns before the result is available)
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<index_t> _iamax_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief IAMIN finds the index of the first element having minimum (future
+ * version that returns before the result is available)
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<index_t> _iamin_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief ASUM Takes the sum of the absolute values (future version that
+ * returns before the result is available)
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<typename ValueType<container_t>::type> _asum_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector (future version that
+ * returns before the result is available)
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<typename ValueType<container_t>::type> _nrm2_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
 }  // namespace internal
 
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
@@ -537,6 +706,7 @@ typename sb_handle_t::event_t _axpy(
     sb_handle_t &sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_axpy");
   return internal::_axpy(sb_handle, _N, _alpha, _vx, _incx, _vy, _incy,
                          _dependencies);
 }
@@ -557,6 +727,7 @@ typename sb_handle_t::event_t _copy(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_copy");
   return internal::_copy(sb_handle, _N, _vx, _incx, _vy, _incy, _dependencies);
 }
 
@@ -585,6 +756,7 @@ typename sb_handle_t::event_t _dot(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_dot");
   return internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy, _rs,
                         _dependencies);
 }
@@ -616,6 +788,7 @@ typename sb_handle_t::event_t _sdsdot(
     sb_handle_t &sb_handle, index_t _N, float sb, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy, container_2_t _rs,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_sdsdot");
   return internal::_sdsdot(sb_handle, _N, sb, _vx, _incx, _vy, _incy, _rs,
                            _dependencies);
 }
@@ -634,6 +807,7 @@ typename sb_handle_t::event_t _asum(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_asum");
   return internal::_asum(sb_handle, _N, _vx, _incx, _rs, _dependencies);
 }
 
@@ -648,9 +822,39 @@ template <typename sb_handle_t, typename container_t, typename ContainerI,
 typename sb_handle_t::event_t _iamax(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     ContainerI _rs, const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamax");
   return internal::_iamax(sb_handle, _N, _vx, _incx, _rs, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _iamax called with the same arguments.
+ */
+template <typename sb_handle_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+inline size_t _iamax_workspace_size(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    ContainerI _rs) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_iamax(sb_handle, _N, _vx, _incx, _rs, {});
+  });
+}
+
+/*!
+ * @brief _iamax taking its temporary memory from @p workspace, of at least
+ * _iamax_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename sb_handle_t::event_t _iamax(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    ContainerI _rs, Workspace &workspace,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamax");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_iamax(sb_handle, _N, _vx, _incx, _rs, _dependencies);
+  });
+}
+
 /**
  * \brief IAMIN finds the index of the first element having minimum
  * @param _vx BufferIterator or USM pointer
@@ -663,9 +867,39 @@ template <typename sb_handle_t, typename container_t, typename ContainerI,
 typename sb_handle_t::event_t _iamin(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     ContainerI _rs, const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamin");
   return internal::_iamin(sb_handle, _N, _vx, _incx, _rs, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _iamin called with the same arguments.
+ */
+template <typename sb_handle_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+inline size_t _iamin_workspace_size(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    ContainerI _rs) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_iamin(sb_handle, _N, _vx, _incx, _rs, {});
+  });
+}
+
+/*!
+ * @brief _iamin taking its temporary memory from @p workspace, of at least
+ * _iamin_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename sb_handle_t::event_t _iamin(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    ContainerI _rs, Workspace &workspace,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamin");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_iamin(sb_handle, _N, _vx, _incx, _rs, _dependencies);
+  });
+}
+
 /**
  * \brief SWAP interchanges two vectors
  *
@@ -682,12 +916,16 @@ typename sb_handle_t::event_t _swap(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_swap");
   return internal::_swap(sb_handle, _N, _vx, _incx, _vy, _incy, _dependencies);
 }
 
 /**
  * \brief SCALAR operation on a vector
  * @param sb_handle_t sb_handle
+ * @param _alpha Scalar, or BufferIterator or USM pointer to a scalar in
+ * device memory. A zero alpha in device memory sets x to zero, as on the
+ * host.
  * @param _vx BufferIterator or USM pointer
  * @param _incx Increment for the vector X
  * @param _dependencies Vector of events
@@ -698,6 +936,7 @@ typename sb_handle_t::event_t _scal(
     sb_handle_t &sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_scal");
   return internal::_scal(sb_handle, _N, _alpha, _vx, _incx, _dependencies);
 }
 
@@ -715,6 +954,7 @@ typename sb_handle_t::event_t _nrm2(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_nrm2");
   return internal::_nrm2(sb_handle, _N, _vx, _incx, _rs, _dependencies);
 }
 
@@ -727,8 +967,10 @@ typename sb_handle_t::event_t _nrm2(
  * @param _incx Increment for the vector X
  * @param _vx BufferIterator or USM pointer
  * @param _incy Increment for the vector Y
- * @param _sin sine
- * @param _cos cosine
+ * @param _sin sine, or BufferIterator or USM pointer to it in device
+ * memory
+ * @param _cos cosine, or BufferIterator or USM pointer to it in device
+ * memory
  * @param _N data size
  * @param _dependencies Vector of events
  */
@@ -738,6 +980,7 @@ typename sb_handle_t::event_t _rot(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rot");
   return internal::_rot(sb_handle, _N, _vx, _incx, _vy, _incy, _cos, _sin,
                         _dependencies);
 }
@@ -781,6 +1024,7 @@ typename sb_handle_t::event_t _rotm(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _param,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rotm");
   return internal::_rotm(sb_handle, _N, _vx, _incx, _vy, _incy, _param,
                          _dependencies);
 }
@@ -826,6 +1070,7 @@ typename sb_handle_t::event_t _rotmg(
     sb_handle_t &sb_handle, container_0_t _d1, container_1_t _d2,
     container_2_t _x1, container_3_t _y1, container_4_t _param,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rotmg");
   return internal::_rotmg(sb_handle, _d1, _d2, _x1, _y1, _param, _dependencies);
 }
 
@@ -854,6 +1099,7 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _rotg(
     sb_handle_t &sb_handle, container_0_t a, container_1_t b, container_2_t c,
     container_3_t s, const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rotg");
   return internal::_rotg(sb_handle, a, b, c, s, _dependencies);
 }
 
@@ -878,6 +1124,7 @@ template <
 void _rotg(sb_handle_t &sb_handle, scalar_t &a, scalar_t &b, scalar_t &c,
            scalar_t &s,
            const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rotg");
   internal::_rotg(sb_handle, a, b, c, s, _dependencies);
 }
 
@@ -906,6 +1153,7 @@ typename ValueType<container_0_t>::type _dot(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_dot");
   return internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy, _dependencies);
 }
 
@@ -936,6 +1184,7 @@ typename ValueType<container_0_t>::type _sdsdot(
     sb_handle_t &sb_handle, index_t _N, float sb, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_sdsdot");
   return internal::_sdsdot(sb_handle, _N, sb, _vx, _incx, _vy, _incy,
                            _dependencies);
 }
@@ -951,6 +1200,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 index_t _iamax(sb_handle_t &sb_handle, index_t _N, container_t _vx,
                increment_t _incx,
                const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamax");
   return internal::_iamax(sb_handle, _N, _vx, _incx, _dependencies);
 }
 
@@ -965,6 +1215,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 index_t _iamin(sb_handle_t &sb_handle, index_t _N, container_t _vx,
                increment_t _incx,
                const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamin");
   return internal::_iamin(sb_handle, _N, _vx, _incx, _dependencies);
 }
 
@@ -981,6 +1232,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_asum");
   return internal::_asum(sb_handle, _N, _vx, _incx, _dependencies);
 }
 
@@ -997,8 +1249,132 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_nrm2");
   return internal::_nrm2(sb_handle, _N, _vx, _incx, _dependencies);
 }
 
+/**
+ * \brief Computes the inner product of two vectors (future version that
+ * returns before the result is available)
+ *
+ * The result is written to a host slot pooled by the SB_Handle without
+ * blocking the host: only Scalar_Future::get and Scalar_Future::wait do, so
+ * that back-to-back calls overlap and the host syncs once per value read.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator or USM pointer
+ * @tparam container_1_t Buffer Iterator or USM pointer
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ * @return Scalar_Future holding the result.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Future<typename ValueType<container_0_t>::type> _dot_async(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_dot_async");
+  return internal::_dot_async(sb_handle, _N, _vx, _incx, _vy, _incy,
+                              _dependencies);
+}
+
+/**
+ * \brief Computes the inner product of two vectors with double precision
+ * accumulation and adds a scalar to the result (future version that returns
+ * before the result is available, see _dot_async)
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes. If size 0, the result will be sb.
+ * @param sb Scalar to add to the results of the inner product.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ * @return Scalar_Future holding the result.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Future<typename ValueType<container_0_t>::type> _sdsdot_async(
+    sb_handle_t &sb_handle, index_t _N, float sb, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_sdsdot_async");
+  return internal::_sdsdot_async(sb_handle, _N, sb, _vx, _incx, _vy, _incy,
+                                 _dependencies);
+}
+
+/**
+ * \brief IAMAX finds the index of the first element having maximum (future
+ * version that returns before the result is available, see _dot_async)
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<index_t> _iamax_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamax_async");
+  return internal::_iamax_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
+/**
+ * \brief IAMIN finds the index of the first element having minimum (future
+ * version that returns before the result is available, see _dot_async)
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<index_t> _iamin_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_iamin_async");
+  return internal::_iamin_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
+/**
+ * \brief ASUM Takes the sum of the absolute values (future version that
+ * returns before the result is available, see _dot_async)
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<typename ValueType<container_t>::type> _asum_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_asum_async");
+  return internal::_asum_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector (future version that
+ * returns before the result is available, see _dot_async)
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<typename ValueType<container_t>::type> _nrm2_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_nrm2_async");
+  return internal::_nrm2_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
 }  // end namespace blas
 #endif  // PORTBLAS_BLAS1_INTERFACE
@@ -27,6 +27,7 @@
 #define PORTBLAS_BLAS2_INTERFACE_H
 
 #include "operations/blas2_trees.h"
+#include "sb_handle/workspace.h"
 namespace blas {
 namespace internal {
 /*!
@@ -38,6 +39,10 @@ namespace internal {
 
  y = alpha*A*x + beta*y
 
+ Alpha and beta are either host scalars or BufferIterators or USM pointers to
+ scalars in device memory. The kernel checks a zero beta in device memory,
+ so that y is overwritten rather than scaled.
+
  See the netlib blas interface documentation for more details of the high level
  interface: http://www.netlib.org/lapack/explore-html/db/d58/sgemv_8f.html
 
@@ -72,12 +77,67 @@ typename sb_handle_t::event_t _gemv(
  */
 template <uint32_t local_range, uint32_t cache_line_size,
           gemv_memory_t memory_type, transpose_type trn, typename sb_handle_t,
-          typename index_t, typename element_t, typename container_t0,
+          typename index_t, typename scalar_t, typename container_t0,
           typename container_t1, typename increment_t, typename container_t2>
 typename sb_handle_t::event_t _gemv_impl(
-    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    sb_handle_t& sb_handle, index_t _M, index_t _N, scalar_t _alpha,
     container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
-    element_t _beta, container_t2 _vy, increment_t _incy,
+    scalar_t _beta, container_t2 _vy, increment_t _incy,
+    const typename sb_handle_t::event_t& _dependencies);
+
+/*!
+ * @brief Prototype for the strided batched GEMV. See the documentation of the
+ * blas::_gemv_strided_batched wrapper for details.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t _gemv_strided_batched(
+    sb_handle_t& sb_handle, char _trans, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _mA, index_t _lda, index_t _stride_a,
+    container_1_t _vx, increment_t _incx, index_t _stride_x, element_t _beta,
+    container_2_t _vy, increment_t _incy, index_t _stride_y,
+    index_t _batch_size, const typename sb_handle_t::event_t& _dependencies);
+
+/*!
+ * @brief Prototype for the batched GEMV on arrays of pointers. See the
+ * documentation of the blas::_gemv_batched wrapper for details.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t _gemv_batched(
+    sb_handle_t& sb_handle, char _trans, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _a_array, index_t _lda,
+    container_1_t _x_array, increment_t _incx, element_t _beta,
+    container_2_t _y_array, increment_t _incy, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+/*!
+ * @brief Prototypes for the internal implementation of the batched GEMV. See
+ * documentation in the blas2_interface.hpp file for details.
+ */
+template <uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, transpose_type trn, bool is_pointer_array,
+          typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename sb_handle_t::event_t _gemv_batch_launch(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _stride_a, container_t1 _vx,
+    increment_t _incx, index_t _stride_x, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stride_y, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <uint32_t local_range, transpose_type trn, bool is_pointer_array,
+          typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename sb_handle_t::event_t _gemv_batch_impl(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _stride_a, container_t1 _vx,
+    increment_t _incx, index_t _stride_x, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stride_y, index_t _batch_size,
     const typename sb_handle_t::event_t& _dependencies);
 
 /*!
@@ -191,7 +251,8 @@ typename sb_handle_t::event_t _symv(
  * @param sb_handle SB_handle
  * @param _M Number of rows in matrix A
  * @param _N Number of columns in matrix A
- * @param _alpha Scalar alpha
+ * @param _alpha Scalar alpha, or BufferIterator or USM pointer to it in
+ * device memory
  * @param _vx Input vector having (1 + (_M-1)*abs(_incx)) elements
  * @param _incx Increment for vector X
  * @param _vy, Input vector having having (1 + (_N-1)*abs(_incy)) elements
@@ -622,6 +683,10 @@ typename sb_handle_t::event_t _tpsv_impl(sb_handle_t& sb_handle, index_t _N,
 
  y = alpha*A*x + beta*y
 
+ Alpha and beta are either host scalars or BufferIterators or USM pointers to
+ scalars in device memory. The kernel checks a zero beta in device memory,
+ so that y is overwritten rather than scaled.
+
  See the netlib blas interface documentation for more details of the high level
  interface: http://www.netlib.org/lapack/explore-html/db/d58/sgemv_8f.html
 
@@ -649,10 +714,120 @@ typename sb_handle_t::event_t inline _gemv(
     increment_t _incy,  // The increment for elements in y (nonzero).
     const typename sb_handle_t::event_t& _dependencies = {}  // Vector of events
 ) {
+  auto trace_scope = sb_handle.trace_call("_gemv");
   return internal::_gemv(sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _vx,
                          _incx, _beta, _vy, _incy, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _gemv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+inline size_t _gemv_workspace_size(
+    sb_handle_t& sb_handle, char _trans, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx, element_t _beta, container_2_t _vy, increment_t _incy) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_gemv(sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _vx,
+                           _incx, _beta, _vy, _incy, {});
+  });
+}
+
+/*!
+ * @brief _gemv taking its temporary memory from @p workspace, of at least
+ * _gemv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gemv(
+    sb_handle_t& sb_handle, char _trans, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx, element_t _beta, container_2_t _vy, increment_t _incy,
+    Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_gemv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_gemv(sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _vx,
+                           _incx, _beta, _vy, _incy, _dependencies);
+  });
+}
+
+/*!
+ @brief Strided batched generalised matrix vector product.
+
+ Computes y_i = alpha*op(A_i)*x_i + beta*y_i for i in [0, batch_size), where
+ A_i, x_i and y_i start _stride_a, _stride_x and _stride_y elements after
+ A_{i-1}, x_{i-1} and y_{i-1}. A stride of 0 uses the same matrix or x vector
+ for the whole batch.
+
+ The batch is computed by a single kernel without any temporary memory,
+ several small matrices sharing a work group and the rows of large ones being
+ spread across work groups. Alpha and beta are host scalars.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gemv_strided_batched(
+    sb_handle_t& sb_handle,  // sb_handle_t (sycl, parallel, serial, etc)
+    char _trans,             // The transposition of A ('n', 't', 'c')
+    index_t _M,              // The number of rows of each matrix
+    index_t _N,              // The number of columns of each matrix
+    element_t _alpha,        // Scalar parameter Alpha
+    container_0_t _mA,       // The first matrix of the batch
+    index_t _lda,            // The leading dimension of the matrices
+    index_t _stride_a,       // The stride between two matrices
+    container_1_t _vx,       // The first x vector of the batch
+    increment_t _incx,       // The increment for elements in x (nonzero)
+    index_t _stride_x,       // The stride between two x vectors
+    element_t _beta,         // Scalar parameter Beta
+    container_2_t _vy,       // The first y vector of the batch
+    increment_t _incy,       // The increment for elements in y (nonzero)
+    index_t _stride_y,       // The stride between two y vectors
+    index_t _batch_size,     // The number of matrix vector products
+    const typename sb_handle_t::event_t& _dependencies = {}  // Vector of events
+) {
+  auto trace_scope = sb_handle.trace_call("_gemv_strided_batched");
+  return internal::_gemv_strided_batched(
+      sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx,
+      _stride_x, _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+}
+
+/*!
+ @brief Batched generalised matrix vector product on arrays of pointers.
+
+ Computes y_i = alpha*op(A_i)*x_i + beta*y_i for i in [0, batch_size), where
+ A_i, x_i and y_i are the i-th pointers of the device accessible arrays
+ _a_array, _x_array and _y_array. Only available with USM, and computed by the
+ same kernel as _gemv_strided_batched.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gemv_batched(
+    sb_handle_t& sb_handle,  // sb_handle_t (sycl, parallel, serial, etc)
+    char _trans,             // The transposition of A ('n', 't', 'c')
+    index_t _M,              // The number of rows of each matrix
+    index_t _N,              // The number of columns of each matrix
+    element_t _alpha,        // Scalar parameter Alpha
+    container_0_t _a_array,  // The batch_size pointers to the matrices
+    index_t _lda,            // The leading dimension of the matrices
+    container_1_t _x_array,  // The batch_size pointers to the x vectors
+    increment_t _incx,       // The increment for elements in x (nonzero)
+    element_t _beta,         // Scalar parameter Beta
+    container_2_t _y_array,  // The batch_size pointers to the y vectors
+    increment_t _incy,       // The increment for elements in y (nonzero)
+    index_t _batch_size,     // The number of matrix vector products
+    const typename sb_handle_t::event_t& _dependencies = {}  // Vector of events
+) {
+  auto trace_scope = sb_handle.trace_call("_gemv_batched");
+  return internal::_gemv_batched(sb_handle, _trans, _M, _N, _alpha, _a_array,
+                                 _lda, _x_array, _incx, _beta, _y_array, _incy,
+                                 _batch_size, _dependencies);
+}
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -679,10 +854,43 @@ typename sb_handle_t::event_t inline _trmv(
     increment_t _incx,       // !=0 The increment for the elements of X
     const typename sb_handle_t::event_t& _dependencies = {}  // Vector of events
 ) {
+  auto trace_scope = sb_handle.trace_call("_trmv");
   return internal::_trmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
                          _incx, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _trmv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+inline size_t _trmv_workspace_size(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_trmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
+                           _incx, {});
+  });
+}
+
+/*!
+ * @brief _trmv taking its temporary memory from @p workspace, of at least
+ * _trmv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _trmv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_trmv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_trmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
+                           _incx, _dependencies);
+  });
+}
+
 /**
  * @brief Linear system solver for triangular matrices.
  *
@@ -710,10 +918,43 @@ typename sb_handle_t::event_t inline _trsv(
     sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
     container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_trsv");
   return internal::_trsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
                          _incx, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _trsv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+inline size_t _trsv_workspace_size(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_trsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
+                           _incx, {});
+  });
+}
+
+/*!
+ * @brief _trsv taking its temporary memory from @p workspace, of at least
+ * _trsv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _trsv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_trsv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_trsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
+                           _incx, _dependencies);
+  });
+}
+
 /*!
  @brief Generalised matrix vector product with a rectangular symmetric
  matrix, followed by a vector sum.
@@ -745,10 +986,46 @@ typename sb_handle_t::event_t inline _symv(
     increment_t _incy,       // !=0 The increment for the elements of Y
     const typename sb_handle_t::event_t& _dependencies = {}  // Vector of events
 ) {
+  auto trace_scope = sb_handle.trace_call("_symv");
   return internal::_symv(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx,
                          _beta, _vy, _incy, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _symv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+inline size_t _symv_workspace_size(
+    sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    element_t _beta, container_2_t _vy, increment_t _incy) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_symv(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx,
+                           _beta, _vy, _incy, {});
+  });
+}
+
+/*!
+ * @brief _symv taking its temporary memory from @p workspace, of at least
+ * _symv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _symv(
+    sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    element_t _beta, container_2_t _vy, increment_t _incy, Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_symv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_symv(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx,
+                           _beta, _vy, _incy, _dependencies);
+  });
+}
+
 /*!
  * @brief Generalised vector product followed by a sum with a rectangular
  * non-symmetric matrix.
@@ -766,7 +1043,8 @@ typename sb_handle_t::event_t inline _symv(
  * @param sb_handle SB_handle
  * @param _M Number of rows in matrix A
  * @param _N Number of columns in matrix A
- * @param _alpha Scalar alpha
+ * @param _alpha Scalar alpha, or BufferIterator or USM pointer to it in
+ * device memory
  * @param _vx Input vector having (1 + (_M-1)*abs(_incx)) elements
  * @param _incx Increment for vector X
  * @param _vy, Input vector having having (1 + (_N-1)*abs(_incy)) elements
@@ -783,6 +1061,7 @@ typename sb_handle_t::event_t inline _ger(
     container_0_t _vx, increment_t _incx, container_1_t _vy, increment_t _incy,
     container_2_t _mA, index_t _lda,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_ger");
   return internal::_ger(sb_handle, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA,
                         _lda, _dependencies);
 }
@@ -813,6 +1092,7 @@ typename sb_handle_t::event_t inline _syr(
     index_t _lda,            // >max(1, _N) The first dimension of _mA
     const typename sb_handle_t::event_t& _dependencies = {}  // Vector of events
 ) {
+  auto trace_scope = sb_handle.trace_call("_syr");
   return internal::_syr(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _mA, _lda,
                         _dependencies);
 }
@@ -845,6 +1125,7 @@ typename sb_handle_t::event_t inline _spr(
     sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
     container_0_t _vx, increment_t _incx, container_1_t _mPA,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_spr");
   return internal::_spr(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _mPA,
                         _dependencies);
 }
@@ -881,6 +1162,7 @@ typename sb_handle_t::event_t inline _spr2(
     container_t0 _vx, increment_t _incx, container_t1 _vy, increment_t _incy,
     container_t2 _mPA,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_spr2");
   return internal::_spr2(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy,
                          _mPA, _dependencies);
 }
@@ -915,6 +1197,7 @@ typename sb_handle_t::event_t inline _syr2(
     index_t _lda,            // >max(1, _N) The first dimension of _mA
     const typename sb_handle_t::event_t& _dependencies = {}  // Vector of events
 ) {
+  auto trace_scope = sb_handle.trace_call("_syr2");
   return internal::_syr2(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy,
                          _mA, _lda, _dependencies);
 }
@@ -958,6 +1241,7 @@ typename sb_handle_t::event_t inline _gbmv(
     container_1_t _vx, increment_t _incx, element_t _beta, container_2_t _vy,
     increment_t _incy,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_gbmv");
   return internal::_gbmv(sb_handle, _trans, _M, _N, _KL, _KU, _alpha, _mA, _lda,
                          _vx, _incx, _beta, _vy, _incy, _dependencies);
 }
@@ -996,6 +1280,7 @@ typename sb_handle_t::event_t _sbmv(
     element_t _alpha, container_0_t _mA, index_t _lda, container_1_t _vx,
     increment_t _incx, element_t _beta, container_2_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_sbmv");
   return internal::_sbmv(sb_handle, _Uplo, _N, _K, _alpha, _mA, _lda, _vx,
                          _incx, _beta, _vy, _incy, _dependencies);
 }
@@ -1033,6 +1318,7 @@ typename sb_handle_t::event_t _spmv(
     container_0_t _mA, container_1_t _vx, increment_t _incx, element_t _beta,
     container_2_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_spmv");
   return internal::_spmv(sb_handle, _Uplo, _N, _alpha, _mA, _vx, _incx, _beta,
                          _vy, _incy, _dependencies);
 }
@@ -1068,10 +1354,44 @@ typename sb_handle_t::event_t _tbmv(
     index_t _K, container_0_t _mA, index_t _lda, container_1_t _vx,
     increment_t _incx,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tbmv");
   return internal::_tbmv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
                          _vx, _incx, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _tbmv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+inline size_t _tbmv_workspace_size(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    index_t _K, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_tbmv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
+                           _vx, _incx, {});
+  });
+}
+
+/*!
+ * @brief _tbmv taking its temporary memory from @p workspace, of at least
+ * _tbmv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tbmv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    index_t _K, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx, Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tbmv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_tbmv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
+                           _vx, _incx, _dependencies);
+  });
+}
+
 /**
  * @brief Matrix vector product with triangular packed matrices.
  *
@@ -1100,10 +1420,43 @@ typename sb_handle_t::event_t _tpmv(
     sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
     container_0_t _mA, container_1_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tpmv");
   return internal::_tpmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _vx, _incx,
                          _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _tpmv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+inline size_t _tpmv_workspace_size(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, container_1_t _vx, increment_t _incx) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_tpmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _vx, _incx,
+                           {});
+  });
+}
+
+/*!
+ * @brief _tpmv taking its temporary memory from @p workspace, of at least
+ * _tpmv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tpmv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, container_1_t _vx, increment_t _incx,
+    Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tpmv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_tpmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _vx, _incx,
+                           _dependencies);
+  });
+}
+
 /**
  * @brief Linear system solver for triangular band matrices.
  *
@@ -1134,10 +1487,44 @@ typename sb_handle_t::event_t _tbsv(
     index_t _K, container_0_t _mA, index_t _lda, container_1_t _vx,
     increment_t _incx,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tbsv");
   return internal::_tbsv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
                          _vx, _incx, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _tbsv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+inline size_t _tbsv_workspace_size(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    index_t _K, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_tbsv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
+                           _vx, _incx, {});
+  });
+}
+
+/*!
+ * @brief _tbsv taking its temporary memory from @p workspace, of at least
+ * _tbsv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tbsv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    index_t _K, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx, Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tbsv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_tbsv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
+                           _vx, _incx, _dependencies);
+  });
+}
+
 /**`
  * @brief Linear system solver for triangular packed matrices.
  *
@@ -1165,8 +1552,41 @@ typename sb_handle_t::event_t _tpsv(sb_handle_t& sb_handle, char _Uplo,
                                     container_0_t _mA, container_1_t _vx,
                                     increment_t _incx,
                                     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tpsv");
   return internal::_tpsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _vx, _incx, _dependencies);
 }
+
+/*!
+ * @brief Bytes of Workspace used by _tpsv called with the same arguments.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+inline size_t _tpsv_workspace_size(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, container_1_t _vx, increment_t _incx) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_tpsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _vx, _incx,
+                           {});
+  });
+}
+
+/*!
+ * @brief _tpsv taking its temporary memory from @p workspace, of at least
+ * _tpsv_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tpsv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mA, container_1_t _vx, increment_t _incx,
+    Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_tpsv");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_tpsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _vx, _incx,
+                           _dependencies);
+  });
+}
 }  // namespace blas
 
 #endif  // PORTBLAS_BLAS2_INTERFACE
@@ -27,6 +27,7 @@
 #define PORTBLAS_BLAS3_INTERFACE_H
 
 #include "operations/blas3_trees.h"
+#include "sb_handle/sb_handle_group.h"
 
 namespace blas {
 namespace internal {
@@ -83,6 +84,13 @@ typename sb_handle_t::event_t _symm(
 
 }  // namespace internal
 
+/*!
+ * @brief General matrix-matrix product, C = alpha*op(A)*op(B) + beta*C.
+ * Alpha and beta are either host scalars or BufferIterators or USM pointers to
+ * scalars in device memory. The latter compute op(A)*op(B) into a temporary
+ * M*N matrix, scaled into C by a second kernel which overwrites C when beta is
+ * zero.
+ */
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename sb_handle_t::event_t _gemm(
@@ -90,10 +98,46 @@ typename sb_handle_t::event_t _gemm(
     index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_gemm");
   return internal::_gemm(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_,
                          _lda, b_, _ldb, _beta, _C, _ldc, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _gemm called with the same arguments.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+inline size_t _gemm_workspace_size(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_gemm(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_,
+                           _lda, b_, _ldb, _beta, _C, _ldc, {});
+  });
+}
+
+/*!
+ * @brief _gemm taking its temporary memory from @p workspace, of at least
+ * _gemm_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_gemm");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_gemm(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_,
+                           _lda, b_, _ldb, _beta, _C, _ldc, _dependencies);
+  });
+}
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename sb_handle_t::event_t _gemm_batched(
@@ -103,6 +147,7 @@ typename sb_handle_t::event_t _gemm_batched(
     index_t _ldc, index_t batch_size,
     gemm_batch_type_t batch_type = gemm_batch_type_t::strided,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_gemm_batched");
   return internal::_gemm_batched(sb_handle, _TransA, _TransB, _M, _N, _K,
                                  _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
                                  batch_size, batch_type, _dependencies);
@@ -117,11 +162,67 @@ typename sb_handle_t::event_t _gemm_strided_batched(
     element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
     index_t batch_size,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_gemm_strided_batched");
   return internal::_gemm_strided_batched(
       sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, _stridea, b_,
       _ldb, _strideb, _beta, _C, _ldc, _stridec, batch_size, _dependencies);
 }
 
+/*!
+ * @brief Batched GEMM spread across the queues of a SB_Handle_Group. Each
+ * queue computes a contiguous range of the batch. Interleaved batches cannot be
+ * split and run on the first queue of the group.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename SB_Handle_Group::event_t _gemm_batched(
+    SB_Handle_Group& sb_handle_group, char _TransA, char _TransB, index_t _M,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t batch_size,
+    gemm_batch_type_t batch_type = gemm_batch_type_t::strided,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  if (batch_type != gemm_batch_type_t::strided) {
+    return _gemm_batched(sb_handle_group[0], _TransA, _TransB, _M, _N, _K,
+                         _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                         batch_size, batch_type, _dependencies);
+  }
+  // Same strides as the ones implied by gemm_batch_type_t::strided
+  const index_t stride_a = (tolower(_TransA) != 'n') ? _M * _lda : _K * _lda;
+  const index_t stride_b = (tolower(_TransB) != 'n') ? _ldb * _K : _N * _ldb;
+  const index_t stride_c = _ldc * _N;
+  return sb_handle_group.split_batch(
+      batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _gemm_batched(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha,
+                             a_ + first * stride_a, _lda, b_ + first * stride_b,
+                             _ldb, _beta, _C + first * stride_c, _ldc, count,
+                             gemm_batch_type_t::strided, _dependencies);
+      });
+}
+
+/*!
+ * @brief Strided batched GEMM spread across the queues of a SB_Handle_Group.
+ * Each queue computes a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename SB_Handle_Group::event_t _gemm_strided_batched(
+    SB_Handle_Group& sb_handle_group, char _TransA, char _TransB, index_t _M,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    index_t batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _gemm_strided_batched(
+            sb_handle, _TransA, _TransB, _M, _N, _K, _alpha,
+            a_ + first * _stridea, _lda, _stridea, b_ + first * _strideb, _ldb,
+            _strideb, _beta, _C + first * _stridec, _ldc, _stridec, count,
+            _dependencies);
+      });
+}
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t>
 typename sb_handle_t::event_t inline _trsm(
@@ -129,10 +230,50 @@ typename sb_handle_t::event_t inline _trsm(
     index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
     container_1_t B, index_t ldb,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_trsm");
   return internal::_trsm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
                          lda, B, ldb, _dependencies);
 }
 
+/*!
+ * @brief Bytes of Workspace used by _trsm called with the same arguments.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+inline size_t _trsm_workspace_size(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    container_1_t B, index_t ldb) {
+  return internal::workspace_size(sb_handle, [&]() {
+    return internal::_trsm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
+                           lda, B, ldb, {});
+  });
+}
+
+/*!
+ * @brief _trsm taking its temporary memory from @p workspace, of at least
+ * _trsm_workspace_size bytes, instead of allocating it.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _trsm(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    container_1_t B, index_t ldb, Workspace& workspace,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_trsm");
+  return internal::with_workspace(sb_handle, workspace, [&]() {
+    return internal::_trsm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
+                           lda, B, ldb, _dependencies);
+  });
+}
+
+/*!
+ * @brief Symmetric matrix-matrix product, C = alpha*A*B + beta*C or
+ * C = alpha*B*A + beta*C. Alpha and beta are either host scalars or
+ * BufferIterators or USM pointers to scalars in device memory, the latter
+ * going through a temporary M*N matrix as in _gemm.
+ */
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename sb_handle_t::event_t _symm(
@@ -140,6 +281,7 @@ typename sb_handle_t::event_t _symm(
     element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
     index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_symm");
   return internal::_symm(sb_handle, _side, _uplo, _M, _N, _alpha, a_, _lda, b_,
                          _ldb, _beta, _C, _ldc, _dependencies);
 }
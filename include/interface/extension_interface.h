@@ -27,8 +27,10 @@
 #define PORTBLAS_EXTENSION_INTERFACE_H
 
 #include "operations/extension/reduction.h"
+#include "operations/extension/reduction_batch.h"
 #include "operations/extension/transpose.h"
 #include "sb_handle/portblas_handle.h"
+#include "sb_handle/sb_handle_group.h"
 
 namespace blas {
 
@@ -163,6 +165,77 @@ typename sb_handle_t::event_t _axpy_batch_impl(
     index_t _stride_y, index_t _batch_size,
     const typename sb_handle_t::event_t& _dependencies, index_t global_size);
 
+/**
+ * \brief Reduces each vector of a strided batch, see batch_reduction_t. For
+ * nrm2 and asum, _vy is not read.
+ */
+template <batch_reduction_t reduction, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <batch_reduction_t reduction, int localSize, int maxSubGroupN,
+          typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch_impl(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _axpby(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, element_t _beta, container_1_t _vy, index_t _incy,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _axpy_dot(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, container_1_t _vy, index_t _incy, container_2_t _vz,
+    index_t _incz, container_3_t _rs,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <int localSize, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t,
+          typename container_3_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _axpy_dot_impl(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, container_1_t _vy, index_t _incy, container_2_t _vz,
+    index_t _incz, container_3_t _rs, index_t _number_wg,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rotg_batch(
+    sb_handle_t& sb_handle, container_0_t _a, index_t _stride_a,
+    container_1_t _b, index_t _stride_b, container_2_t _c, index_t _stride_c,
+    container_3_t _s, index_t _stride_s, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rot_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _c, index_t _stride_c, container_3_t _s, index_t _stride_s,
+    index_t _batch_size, const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _rotm_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _param, index_t _stride_param, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
 }  // namespace internal
 
 /**
@@ -189,6 +262,7 @@ typename sb_handle_t::event_t _omatcopy(
     sb_handle_t& sb_handle, char trans, index_t m, index_t n, element_t alpha,
     in_t in_memory, index_t ld_in, out_t out_memory, index_t ld_out,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_omatcopy");
   return internal::_matcopy<false>(
       sb_handle, trans, m, n, alpha, in_memory, ld_in, static_cast<index_t>(1),
       out_memory, ld_out, static_cast<index_t>(1), _dependencies);
@@ -225,6 +299,7 @@ typename sb_handle_t::event_t _omatcopy2(
     in_t in_memory, index_t ld_in, index_t inc_in, out_t out_memory,
     index_t ld_out, index_t inc_out,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_omatcopy2");
   return internal::_matcopy<false>(sb_handle, trans, m, n, alpha, in_memory,
                                    ld_in, inc_in, out_memory, ld_out, inc_out,
                                    _dependencies);
@@ -259,6 +334,7 @@ typename sb_handle_t::event_t _omatadd(
     element_t alpha, container_0_t A, index_t lda, element_t beta,
     container_1_t B, index_t ldb, container_2_t C, index_t ldc,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_omatadd");
   return internal::_omatadd(sb_handle, trans_a, trans_b, m, n, alpha, A, lda,
                             beta, B, ldb, C, ldc, _dependencies);
 }
@@ -288,6 +364,7 @@ typename sb_handle_t::event_t _imatcopy_batch(sb_handle_t& sb_handle,
                                               index_t ld_in, index_t ld_out,
                                               index_t stride,
                                               index_t batch_size) {
+  auto trace_scope = sb_handle.trace_call("_imatcopy_batch");
   return internal::_matcopy_batch<true>(sb_handle, trans, m, n, alpha, memory,
                                         ld_in, stride, memory, ld_out, stride,
                                         batch_size);
@@ -322,6 +399,7 @@ typename sb_handle_t::event_t _omatcopy_batch(
     in_t in_memory, index_t ld_in, index_t stride_in, out_t out_memory,
     index_t ld_out, index_t stride_out, index_t batch_size,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_omatcopy_batch");
   return internal::_matcopy_batch<false>(
       sb_handle, trans, m, n, alpha, in_memory, ld_in, stride_in, out_memory,
       ld_out, stride_out, batch_size, _dependencies);
@@ -361,6 +439,7 @@ typename sb_handle_t::event_t _omatadd_batch(
     element_t beta, container_1_t b, index_t ldb, index_t stride_b,
     container_2_t c, index_t ldc, index_t stride_c, index_t batch_size,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_omatadd_batch");
   return internal::_omatadd_batch(sb_handle, trans_a, trans_b, m, n, alpha, a,
                                   lda, stride_a, beta, b, ldb, stride_b, c, ldc,
                                   stride_c, batch_size, _dependencies);
@@ -389,11 +468,487 @@ typename sb_handle_t::event_t _axpy_batch(
     index_t _incx, index_t _stride_x, container_1_t _vy, index_t _incy,
     index_t _stride_y, index_t _batch_size,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_axpy_batch");
   return internal::_axpy_batch(sb_handle, _N, _alpha, _vx, _incx, _stride_x,
                                _vy, _incy, _stride_y, _batch_size,
                                _dependencies);
 }
 
+/**
+ * \brief Compute a batch of DOT operations all together, in a single launch
+ *
+ * Implements DOT \f$r_i = x_i \cdot y_i\f$ for each vector of the batch
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of each vector
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _vy BufferIterator or USM pointer
+ * @param _incy Increment for the vector Y
+ * @param _stride_y Stride distance of two consecutive vectors in Y
+ * @param _rs BufferIterator or USM pointer of _batch_size contiguous results
+ * @param _batch_size number of dot operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _dot_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_dot_batch");
+  return internal::_reduction_batch<batch_reduction_t::dot>(
+      sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy, _stride_y, _rs,
+      _batch_size, _dependencies);
+}
+
+/**
+ * \brief Compute a batch of NRM2 operations all together, in a single launch
+ *
+ * Implements NRM2 \f$r_i = \|x_i\|_2\f$ for each vector of the batch
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of each vector
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _rs BufferIterator or USM pointer of _batch_size contiguous results
+ * @param _batch_size number of nrm2 operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _nrm2_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_nrm2_batch");
+  return internal::_reduction_batch<batch_reduction_t::nrm2>(
+      sb_handle, _N, _vx, _incx, _stride_x, _vx, _incx, _stride_x, _rs,
+      _batch_size, _dependencies);
+}
+
+/**
+ * \brief Compute a batch of ASUM operations all together, in a single launch
+ *
+ * Implements ASUM \f$r_i = \sum_j |x_{ij}|\f$ for each vector of the batch
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of each vector
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _rs BufferIterator or USM pointer of _batch_size contiguous results
+ * @param _batch_size number of asum operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _asum_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_asum_batch");
+  return internal::_reduction_batch<batch_reduction_t::asum>(
+      sb_handle, _N, _vx, _incx, _stride_x, _vx, _incx, _stride_x, _rs,
+      _batch_size, _dependencies);
+}
+
+/**
+ * \brief Scales and adds two vectors in a single kernel
+ *
+ * Implements AXPBY \f$y = ax + by\f$
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of the vectors
+ * @param _alpha scalar, or BufferIterator or USM pointer to it in device
+ * memory
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _beta scalar, or BufferIterator or USM pointer to it in device
+ * memory
+ * @param _vy BufferIterator or USM pointer
+ * @param _incy Increment for the vector Y
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _axpby(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, element_t _beta, container_1_t _vy, index_t _incy,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_axpby");
+  return internal::_axpby(sb_handle, _N, _alpha, _vx, _incx, _beta, _vy, _incy,
+                          _dependencies);
+}
+
+/**
+ * \brief Updates a vector and computes its dot product with another one in a
+ * single pass over the memory
+ *
+ * Implements \f$y = ax + y\f$ followed by \f$r = y \cdot z\f$, e.g. the
+ * residual update and its squared norm of a conjugate gradient iteration when
+ * _vz is _vy. The result written to _rs replaces its previous value. _vz must
+ * either be _vy with the same increment or not overlap _vy.
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of the vectors
+ * @param _alpha scalar, or BufferIterator or USM pointer to it in device
+ * memory
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator or USM pointer, updated
+ * @param _incy Increment for the vector Y
+ * @param _vz BufferIterator or USM pointer
+ * @param _incz Increment for the vector Z
+ * @param _rs BufferIterator or USM pointer of the dot product
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _axpy_dot(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, container_1_t _vy, index_t _incy, container_2_t _vz,
+    index_t _incz, container_3_t _rs,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_axpy_dot");
+  return internal::_axpy_dot(sb_handle, _N, _alpha, _vx, _incx, _vy, _incy,
+                             _vz, _incz, _rs, _dependencies);
+}
+
+/**
+ * \brief Computes the dot products of _k vectors with the same vector in a
+ * single launch
+ *
+ * Implements \f$r_j = x_j \cdot y\f$ for \f$0 \le j < k\f$, with the
+ * vectors \f$x_j\f$ _stride_x elements apart, e.g. the projections of the
+ * Arnoldi process of GMRES.
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of the vectors
+ * @param _k number of vectors in X
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _vy BufferIterator or USM pointer
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator or USM pointer of _k contiguous results
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _multi_dot(
+    sb_handle_t& sb_handle, index_t _N, index_t _k, container_0_t _vx,
+    index_t _incx, index_t _stride_x, container_1_t _vy, index_t _incy,
+    container_2_t _rs,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_multi_dot");
+  // A batch of dot products sharing y
+  return internal::_reduction_batch<batch_reduction_t::dot>(
+      sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy, static_cast<index_t>(0),
+      _rs, _k, _dependencies);
+}
+
+/**
+ * \brief Computes a batch of Givens rotations all together, in a single launch
+ *
+ * Implements ROTG for each point \f$(a_i, b_i)\f$ of the batch, the i-th
+ * elements of the strided vectors.
+ *
+ * @param sb_handle SB_Handle
+ * @param _a[in, out] BufferIterator or USM pointer. On entry, the
+ * x-coordinates of the points. On exit, the scalars r.
+ * @param _stride_a Stride distance of two consecutive elements of A
+ * @param _b[in, out] BufferIterator or USM pointer. On entry, the
+ * y-coordinates of the points. On exit, the scalars z.
+ * @param _stride_b Stride distance of two consecutive elements of B
+ * @param _c[out] BufferIterator or USM pointer of the parameters c
+ * @param _stride_c Stride distance of two consecutive elements of C
+ * @param _s[out] BufferIterator or USM pointer of the parameters s
+ * @param _stride_s Stride distance of two consecutive elements of S
+ * @param _batch_size number of rotg operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rotg_batch(
+    sb_handle_t& sb_handle, container_0_t _a, index_t _stride_a,
+    container_1_t _b, index_t _stride_b, container_2_t _c, index_t _stride_c,
+    container_3_t _s, index_t _stride_s, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rotg_batch");
+  return internal::_rotg_batch(sb_handle, _a, _stride_a, _b, _stride_b, _c,
+                               _stride_c, _s, _stride_s, _batch_size,
+                               _dependencies);
+}
+
+/**
+ * \brief Applies a batch of plane rotations all together, in a single launch
+ *
+ * Implements ROT \f$(x_i, y_i) = (c_i x_i + s_i y_i, c_i y_i - s_i x_i)\f$
+ * for each pair of vectors of the batch.
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of each vector
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _vy BufferIterator or USM pointer
+ * @param _incy Increment for the vector Y
+ * @param _stride_y Stride distance of two consecutive vectors in Y
+ * @param _c BufferIterator or USM pointer of the cosines of the rotations
+ * @param _stride_c Stride distance of two consecutive cosines, 0 to use the
+ * same one for the whole batch
+ * @param _s BufferIterator or USM pointer of the sines of the rotations
+ * @param _stride_s Stride distance of two consecutive sines, 0 to use the same
+ * one for the whole batch
+ * @param _batch_size number of rot operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rot_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _c, index_t _stride_c, container_3_t _s, index_t _stride_s,
+    index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rot_batch");
+  return internal::_rot_batch(sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy,
+                              _stride_y, _c, _stride_c, _s, _stride_s,
+                              _batch_size, _dependencies);
+}
+
+/**
+ * \brief Applies a batch of modified Givens rotations all together, in a
+ * single launch
+ *
+ * Implements ROTM for each pair of vectors of the batch, the i-th rotation
+ * being given by the five elements starting at \f$i \cdot stride\_param\f$
+ * in _param, with the layout [flag, h11, h21, h12, h22] of rotmg.
+ *
+ * @param sb_handle SB_Handle
+ * @param _N number of elements of each vector
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _vy BufferIterator or USM pointer
+ * @param _incy Increment for the vector Y
+ * @param _stride_y Stride distance of two consecutive vectors in Y
+ * @param _param BufferIterator or USM pointer of the rotations
+ * @param _stride_param Stride distance of two consecutive rotations, 0 to use
+ * the same one for the whole batch
+ * @param _batch_size number of rotm operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _rotm_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _param, index_t _stride_param, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_rotm_batch");
+  return internal::_rotm_batch(sb_handle, _N, _vx, _incx, _stride_x, _vy,
+                               _incy, _stride_y, _param, _stride_param,
+                               _batch_size, _dependencies);
+}
+
+/*!
+ * @brief In-place batched matrix copy spread across the queues of a
+ * SB_Handle_Group. Each queue handles a contiguous range of the batch.
+ */
+template <typename element_t, typename index_t, typename in_out_t>
+typename SB_Handle_Group::event_t _imatcopy_batch(
+    SB_Handle_Group& sb_handle_group, char trans, index_t m, index_t n,
+    element_t alpha, in_out_t memory, index_t ld_in, index_t ld_out,
+    index_t stride, index_t batch_size) {
+  return sb_handle_group.split_batch(
+      batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _imatcopy_batch(sb_handle, trans, m, n, alpha,
+                               memory + first * stride, ld_in, ld_out, stride,
+                               count);
+      });
+}
+
+/*!
+ * @brief Out-of-place batched matrix copy spread across the queues of a
+ * SB_Handle_Group. Each queue handles a contiguous range of the batch.
+ */
+template <typename element_t, typename index_t, typename in_t, typename out_t>
+typename SB_Handle_Group::event_t _omatcopy_batch(
+    SB_Handle_Group& sb_handle_group, char trans, index_t m, index_t n,
+    element_t alpha, in_t in_memory, index_t ld_in, index_t stride_in,
+    out_t out_memory, index_t ld_out, index_t stride_out, index_t batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _omatcopy_batch(sb_handle, trans, m, n, alpha,
+                               in_memory + first * stride_in, ld_in, stride_in,
+                               out_memory + first * stride_out, ld_out,
+                               stride_out, count, _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched matrix addition spread across the queues of a
+ * SB_Handle_Group. Each queue handles a contiguous range of the batch.
+ */
+template <typename element_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename container_2_t>
+typename SB_Handle_Group::event_t _omatadd_batch(
+    SB_Handle_Group& sb_handle_group, char trans_a, char trans_b, index_t m,
+    index_t n, element_t alpha, container_0_t a, index_t lda, index_t stride_a,
+    element_t beta, container_1_t b, index_t ldb, index_t stride_b,
+    container_2_t c, index_t ldc, index_t stride_c, index_t batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _omatadd_batch(sb_handle, trans_a, trans_b, m, n, alpha,
+                              a + first * stride_a, lda, stride_a, beta,
+                              b + first * stride_b, ldb, stride_b,
+                              c + first * stride_c, ldc, stride_c, count,
+                              _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched AXPY spread across the queues of a SB_Handle_Group. Each
+ * queue handles a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t, typename element_t,
+          typename index_t>
+typename SB_Handle_Group::event_t _axpy_batch(
+    SB_Handle_Group& sb_handle_group, index_t _N, element_t _alpha,
+    container_0_t _vx, index_t _incx, index_t _stride_x, container_1_t _vy,
+    index_t _incy, index_t _stride_y, index_t _batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      _batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _axpy_batch(sb_handle, _N, _alpha, _vx + first * _stride_x,
+                           _incx, _stride_x, _vy + first * _stride_y, _incy,
+                           _stride_y, count, _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched DOT spread across the queues of a SB_Handle_Group. Each
+ * queue handles a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename SB_Handle_Group::event_t _dot_batch(
+    SB_Handle_Group& sb_handle_group, index_t _N, container_0_t _vx,
+    index_t _incx, index_t _stride_x, container_1_t _vy, index_t _incy,
+    index_t _stride_y, container_2_t _rs, index_t _batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      _batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _dot_batch(sb_handle, _N, _vx + first * _stride_x, _incx,
+                          _stride_x, _vy + first * _stride_y, _incy, _stride_y,
+                          _rs + first, count, _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched NRM2 spread across the queues of a SB_Handle_Group. Each
+ * queue handles a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t, typename index_t>
+typename SB_Handle_Group::event_t _nrm2_batch(
+    SB_Handle_Group& sb_handle_group, index_t _N, container_0_t _vx,
+    index_t _incx, index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      _batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _nrm2_batch(sb_handle, _N, _vx + first * _stride_x, _incx,
+                           _stride_x, _rs + first, count, _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched ASUM spread across the queues of a SB_Handle_Group. Each
+ * queue handles a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t, typename index_t>
+typename SB_Handle_Group::event_t _asum_batch(
+    SB_Handle_Group& sb_handle_group, index_t _N, container_0_t _vx,
+    index_t _incx, index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      _batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _asum_batch(sb_handle, _N, _vx + first * _stride_x, _incx,
+                           _stride_x, _rs + first, count, _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched ROTG spread across the queues of a SB_Handle_Group. Each
+ * queue handles a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename SB_Handle_Group::event_t _rotg_batch(
+    SB_Handle_Group& sb_handle_group, container_0_t _a, index_t _stride_a,
+    container_1_t _b, index_t _stride_b, container_2_t _c, index_t _stride_c,
+    container_3_t _s, index_t _stride_s, index_t _batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      _batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _rotg_batch(sb_handle, _a + first * _stride_a, _stride_a,
+                           _b + first * _stride_b, _stride_b,
+                           _c + first * _stride_c, _stride_c,
+                           _s + first * _stride_s, _stride_s, count,
+                           _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched ROT spread across the queues of a SB_Handle_Group. Each
+ * queue handles a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename SB_Handle_Group::event_t _rot_batch(
+    SB_Handle_Group& sb_handle_group, index_t _N, container_0_t _vx,
+    index_t _incx, index_t _stride_x, container_1_t _vy, index_t _incy,
+    index_t _stride_y, container_2_t _c, index_t _stride_c, container_3_t _s,
+    index_t _stride_s, index_t _batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      _batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _rot_batch(sb_handle, _N, _vx + first * _stride_x, _incx,
+                          _stride_x, _vy + first * _stride_y, _incy, _stride_y,
+                          _c + first * _stride_c, _stride_c,
+                          _s + first * _stride_s, _stride_s, count,
+                          _dependencies);
+      });
+}
+
+/*!
+ * @brief Batched ROTM spread across the queues of a SB_Handle_Group. Each
+ * queue handles a contiguous range of the batch.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename SB_Handle_Group::event_t _rotm_batch(
+    SB_Handle_Group& sb_handle_group, index_t _N, container_0_t _vx,
+    index_t _incx, index_t _stride_x, container_1_t _vy, index_t _incy,
+    index_t _stride_y, container_2_t _param, index_t _stride_param,
+    index_t _batch_size,
+    const typename SB_Handle_Group::event_t& _dependencies = {}) {
+  return sb_handle_group.split_batch(
+      _batch_size, [&](SB_Handle& sb_handle, index_t first, index_t count) {
+        return _rotm_batch(sb_handle, _N, _vx + first * _stride_x, _incx,
+                           _stride_x, _vy + first * _stride_y, _incy,
+                           _stride_y, _param + first * _stride_param,
+                           _stride_param, count, _dependencies);
+      });
+}
+
 namespace extension {
 /**
  * \brief Transpose a Matrix in-place
@@ -418,6 +973,7 @@ template <typename element_t, typename sb_handle_t, typename index_t,
 typename sb_handle_t::event_t _transpose(
     sb_handle_t& sb_handle, index_t m, index_t n, in_t A, index_t ld_in,
     index_t ld_out, const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_transpose");
   return blas::internal::_transpose<true, element_t>(sb_handle, m, n, A, ld_in,
                                                      A, ld_out, _dependencies);
 }
@@ -446,6 +1002,7 @@ template <typename element_t, typename sb_handle_t, typename index_t,
 typename sb_handle_t::event_t _transpose(
     sb_handle_t& sb_handle, index_t m, index_t n, in_t A, index_t ld_a, out_t B,
     index_t ld_b, const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_transpose");
   return blas::internal::_transpose<false, element_t>(sb_handle, m, n, A, ld_a,
                                                       B, ld_b, _dependencies);
 }
@@ -456,6 +1013,7 @@ typename sb_handle_t::event_t _reduction(
     sb_handle_t& sb_handle, input_t buffer_in, index_t ld, output_t buffer_out,
     index_t rows, index_t cols, reduction_dim_t reduction_dim,
     const typename sb_handle_t::event_t& _dependencies = {}) {
+  auto trace_scope = sb_handle.trace_call("_reduction");
   return blas::internal::_reduction<operator_t, element_t>(
       sb_handle, buffer_in, ld, buffer_out, rows, cols, reduction_dim,
       _dependencies);
@@ -27,8 +27,10 @@
 #define PORTBLAS_BLAS1_TREES_H
 #include "operations/blas_constants.h"
 #include "operations/blas_operators.h"
+#include <cstdint>
 #include <stdexcept>
 #include <sycl/sycl.hpp>
+#include <type_traits>
 #include <vector>
 
 namespace blas {
@@ -51,6 +53,31 @@ struct Join {
   void adjust_access_displacement();
 };
 
+/** FusedOp.
+ * @brief Evaluates two independent trees in a single kernel, as Join does,
+ * but each side can be disabled at launch time and keeps its own bound check.
+ * Chains of FusedOp are built by SB_Handle::execute_fused so that a group of
+ * trees compiles into one kernel, and the subset that can safely run together
+ * is selected at runtime by toggling lhs_active_ / rhs_active_.
+ */
+template <typename lhs_t, typename rhs_t>
+struct FusedOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = typename rhs_t::value_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  bool lhs_active_;
+  bool rhs_active_;
+
+  FusedOp(lhs_t &_l, rhs_t _r);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+};
+
 /** Assign.
  */
 template <typename lhs_t, typename rhs_t>
@@ -225,6 +252,41 @@ struct WGAtomicReduction {
   void adjust_access_displacement();
 };
 
+/*! SinglePassReduction.
+ * @brief Reduction of a subexpression tree into the scalar lhs in a single
+ * kernel. Each work group writes its partial result to partials, then takes a
+ * ticket from an atomic counter: the last work group to take one reduces the
+ * partial results of all the groups and resets the counter to zero.
+ *
+ * The class is constructed using the make_single_pass_reduction function
+ * below. The counter must be zero when the kernel starts.
+ */
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+struct SinglePassReduction {
+  using value_t = typename ResolveReturnType<operator_t, rhs_t>::type::value_t;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  partials_t partials_;
+  ticket_t ticket_;
+  index_t local_num_thread_;   // block  size
+  index_t global_num_thread_;  // grid  size
+  SinglePassReduction(lhs_t &_l, rhs_t &_r, partials_t &_p, ticket_t &_t,
+                      index_t _blqS, index_t _grdS);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  template <typename sharedT>
+  static value_t reduce_work_group(sharedT scratch, sycl::nd_item<1> ndItem,
+                                   value_t val);
+};
+
 /**
  * @brief Generic implementation for operators that require a
  * reduction inside kernel code for computing index of max/min value within the
@@ -255,8 +317,71 @@ struct IndexMaxMin {
   void adjust_access_displacement();
 };
 
+/*! PackedIndexKey.
+ * @brief Packs the absolute value of an element and its index into a 64-bit
+ * key, so that iamax and iamin reduce to the maximum of the keys. The bits of
+ * the absolute value are in the upper half, ordered as unsigned integers, and
+ * the index in the lower half, complemented so that the first index wins the
+ * ties. The keys of iamin are complemented as a whole. The key 0 never comes
+ * from an element, NaN elements being mapped to it so that they are skipped.
+ *
+ * Only supported for the types whose bits fit in 32 bits.
+ */
+template <typename scalar_t>
+struct PackedIndexKey {
+  static constexpr bool is_supported = false;
+};
+
+template <>
+struct PackedIndexKey<float> {
+  static constexpr bool is_supported = true;
+  using bits_t = uint32_t;
+};
+
+template <>
+struct PackedIndexKey<sycl::half> {
+  static constexpr bool is_supported = true;
+  using bits_t = uint16_t;
+};
+
+/*! PackedIndexMaxMin.
+ * @brief Single kernel iamax / iamin. Each work group reduces the packed keys
+ * (see PackedIndexKey) of its elements with reduce_over_group, then combines
+ * its key into keys[0] with a 64-bit atomic max and takes a ticket from the
+ * counter keys[1]: the last work group to take one unpacks the index of the
+ * result into lhs and resets both keys to zero.
+ *
+ * The class is constructed using the make_packed_index_max_min function below.
+ * Both keys must be zero when the kernel starts, and the size of rhs must fit
+ * in 32 bits.
+ *
+ * @tparam is_max Whether the operator is iamax or iamin
+ * @tparam lhs_t Buffer or USM memory object type for the output index
+ * @tparam rhs_t Buffer or USM memory object type for the input vector
+ * @tparam keys_t Buffer or USM memory object type for the two 64-bit keys
+ */
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+struct PackedIndexMaxMin {
+  using value_t = typename rhs_t::value_t;
+  using index_t = typename rhs_t::index_t;
+  using key_t = uint64_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  keys_t keys_;
+  PackedIndexMaxMin(lhs_t &_l, rhs_t &_r, keys_t &_k);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  void eval(sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+  static key_t pack(value_t val, index_t idx);
+  static index_t unpack_index(key_t key);
+};
+
 /*! Rotg.
- * @brief Implements the rotg (blas level 1 api)
+ * @brief Implements the rotg (blas level 1 api), computing one rotation per
+ * element of the views
  */
 template <typename operand_t>
 struct Rotg {
@@ -312,12 +437,33 @@ make_wg_atomic_reduction(lhs_t &lhs_, rhs_t &rhs_) {
   return WGAtomicReduction<operator_t, usmManagedMem, lhs_t, rhs_t>(lhs_, rhs_);
 }
 
+template <typename operator_t, bool usmManagedMem = false, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t,
+          typename index_t>
+inline SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                           ticket_t>
+make_single_pass_reduction(lhs_t &lhs_, rhs_t &rhs_, partials_t &partials_,
+                           ticket_t &ticket_, index_t local_num_thread_,
+                           index_t global_num_thread_) {
+  return SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t,
+                             partials_t, ticket_t>(
+      lhs_, rhs_, partials_, ticket_, local_num_thread_, global_num_thread_);
+}
+
 template <bool is_max, bool is_step0, typename lhs_t, typename rhs_t>
 inline IndexMaxMin<is_max, is_step0, lhs_t, rhs_t> make_index_max_min(
     lhs_t &lhs_, rhs_t &rhs_) {
   return IndexMaxMin<is_max, is_step0, lhs_t, rhs_t>(lhs_, rhs_);
 }
 
+template <bool is_max, bool usmManagedMem = false, typename lhs_t,
+          typename rhs_t, typename keys_t>
+inline PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>
+make_packed_index_max_min(lhs_t &lhs_, rhs_t &rhs_, keys_t &keys_) {
+  return PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>(
+      lhs_, rhs_, keys_);
+}
+
 /*!
 @brief Template function for constructing operation nodes based on input
 template and function arguments. Non-specialized case for N reference operands.
@@ -374,6 +520,21 @@ inline TupleOp<rhs_t> make_tuple_op(rhs_t &rhs_) {
   return TupleOp<rhs_t>(rhs_);
 }
 
+/*!
+@brief Converts the elements of the tree rhs_ to value_t with
+UnaryOp<CastOperator>, e.g. so that a reduction over a 16-bit vector
+accumulates in float. rhs_ is returned as is if it already is of type value_t.
+*/
+template <typename value_t, typename rhs_t>
+inline auto make_cast_op(rhs_t &rhs_) {
+  using rhs_value_t = typename std::remove_const<typename rhs_t::value_t>::type;
+  if constexpr (std::is_same<value_t, rhs_value_t>::value) {
+    return rhs_;
+  } else {
+    return make_op<UnaryOp, CastOperator<value_t>>(rhs_);
+  }
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_H
@@ -137,6 +137,107 @@ SumMatrixColumns<rhs_t> make_sum_matrix_columns(rhs_t &rhs_) {
   return SumMatrixColumns<rhs_t>(rhs_);
 }
 
+/*!
+ * @brief GemvBatch computes a batch of independent GEMV operations in a single
+ * kernel, writing alpha*op(A)*x + beta*y straight to each y without any
+ * temporary memory.
+ *
+ * The local range is split into matrices_per_group slices, each slice working
+ * on its own matrix of the batch, so that small matrices do not leave most of
+ * a work group idle. When matrices_per_group is 1, the elements of y of a
+ * large matrix are instead spread across groups_per_matrix work groups.
+ * Each element of y is computed by dot_split work items. When dot_split is 1,
+ * a work item computes whole dot products, one element of y at a time.
+ * Otherwise each work item sums every dot_split-th product of a dot product,
+ * and the partial sums are reduced in local memory, so that long dot products
+ * of batches with few elements of y still occupy the device.
+ *
+ * @tparam local_range  number of work items per work group
+ * @tparam matrices_per_group  number of matrices computed by a work group,
+ *                             dividing local_range
+ * @tparam dot_split  number of work items sharing each dot product, a power
+ *                    of two dividing local_range / matrices_per_group
+ * @tparam is_transposed  whether op(A) is the transpose of A
+ * @tparam is_pointer_array  whether the views hold arrays of pointers to the
+ *                           matrices and vectors of the batch, rather than
+ *                           the whole strided batch
+ * @param lhs_  the y vectors
+ * @param matrix_a_  the A matrices (column major)
+ * @param vector_x_  the x vectors
+ * @param groups_per_matrix  number of work groups computing each matrix
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+struct GemvBatch {
+  // The value type of a view of pointers is the pointer type
+  using value_t = typename std::remove_cv<
+      typename std::remove_pointer<typename std::remove_cv<
+          typename vector_t::value_t>::type>::type>::type;
+  using index_t = typename vector_t::index_t;
+  static_assert(local_range % matrices_per_group == 0,
+                "matrices_per_group must divide local_range");
+  static constexpr index_t threads_per_matrix =
+      local_range / matrices_per_group;
+  static_assert(dot_split > 0 && (dot_split & (dot_split - 1)) == 0 &&
+                    threads_per_matrix % dot_split == 0,
+                "dot_split must be a power of two dividing the slices");
+  // Number of elements of y computed at once by the slice of a matrix
+  static constexpr index_t rows_per_pass = threads_per_matrix / dot_split;
+
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  index_t m_, n_, lda_, stride_a_, incx_, stride_x_, incy_, stride_y_;
+  value_t alpha_, beta_;
+  index_t batch_size_, groups_per_matrix_;
+
+  GemvBatch(lhs_t _lhs, matrix_t _matrix, vector_t _vector, index_t _M,
+            index_t _N, value_t _alpha, index_t _lda, index_t _stride_a,
+            index_t _incx, index_t _stride_x, value_t _beta, index_t _incy,
+            index_t _stride_y, index_t _batch_size,
+            index_t _groups_per_matrix);
+  index_t get_num_groups() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  value_t eval(sycl::nd_item<1> ndItem);
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Constructs a GemvBatch tree.
+ */
+template <uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array,
+          typename lhs_t, typename matrix_t, typename vector_t>
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed, is_pointer_array>
+make_gemv_batch(lhs_t lhs_, matrix_t matrix_, vector_t vector_,
+                typename vector_t::index_t m_, typename vector_t::index_t n_,
+                typename GemvBatch<lhs_t, matrix_t, vector_t, local_range,
+                                   matrices_per_group, dot_split,
+                                   is_transposed, is_pointer_array>::value_t
+                    alpha_,
+                typename vector_t::index_t lda_,
+                typename vector_t::index_t stride_a_,
+                typename vector_t::index_t incx_,
+                typename vector_t::index_t stride_x_,
+                typename GemvBatch<lhs_t, matrix_t, vector_t, local_range,
+                                   matrices_per_group, dot_split,
+                                   is_transposed, is_pointer_array>::value_t
+                    beta_,
+                typename vector_t::index_t incy_,
+                typename vector_t::index_t stride_y_,
+                typename vector_t::index_t batch_size_,
+                typename vector_t::index_t groups_per_matrix_) {
+  return GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+                   dot_split, is_transposed, is_pointer_array>(
+      lhs_, matrix_, vector_, m_, n_, alpha_, lda_, stride_a_, incx_,
+      stride_x_, beta_, incy_, stride_y_, batch_size_, groups_per_matrix_);
+}
+
 /**
  * @struct GemvCol
  * @brief Tree node representing a Gemv, with parallel expressed across columns
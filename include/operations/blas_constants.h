@@ -188,6 +188,14 @@ struct constant<IndexValueTuple<index_t, value_t>, const_val::collapse> {
   }
 };
 
+template <typename value_t, int packet_size, const_val Indicator>
+struct constant<sycl::vec<value_t, packet_size>, Indicator> {
+  constexpr static PORTBLAS_INLINE sycl::vec<value_t, packet_size> value() {
+    return sycl::vec<value_t, packet_size>(
+        constant<value_t, Indicator>::value());
+  }
+};
+
 #ifdef BLAS_ENABLE_COMPLEX
 template <typename value_t, const_val Indicator>
 struct constant<complex_sycl<value_t>, Indicator> {
@@ -238,6 +246,48 @@ template <>
 struct constant<sycl::half, const_val::collapse>
     : constant<float, const_val::collapse> {};
 
+#ifdef BLAS_ENABLE_BFLOAT16
+template <>
+struct constant<bfloat16, const_val::zero>
+    : constant<float, const_val::zero> {};
+
+template <>
+struct constant<bfloat16, const_val::one>
+    : constant<float, const_val::one> {};
+
+template <>
+struct constant<bfloat16, const_val::m_one>
+    : constant<float, const_val::m_one> {};
+
+template <>
+struct constant<bfloat16, const_val::two>
+    : constant<float, const_val::two> {};
+
+template <>
+struct constant<bfloat16, const_val::m_two>
+    : constant<float, const_val::m_two> {};
+
+template <>
+struct constant<bfloat16, const_val::max>
+    : constant<float, const_val::max> {};
+
+template <>
+struct constant<bfloat16, const_val::min>
+    : constant<float, const_val::min> {};
+
+template <>
+struct constant<bfloat16, const_val::abs_max>
+    : constant<float, const_val::abs_max> {};
+
+template <>
+struct constant<bfloat16, const_val::abs_min>
+    : constant<float, const_val::abs_min> {};
+
+template <>
+struct constant<bfloat16, const_val::collapse>
+    : constant<float, const_val::collapse> {};
+#endif  // BLAS_ENABLE_BFLOAT16
+
 template <typename iv_type, const_val IndexIndicator, const_val ValueIndicator>
 struct constant_pair {
   constexpr static PORTBLAS_INLINE iv_type value() {
@@ -45,8 +45,17 @@ struct ResolveReturnType<CollapseIndexTupleOperator, rhs_t> {
   using type = typename rhs_t::value_t;
 };
 
+// The cast operator returns the type it converts to, see CastOperator
+template <typename value_t>
+struct CastOperator;
+template <typename value_t, typename rhs_t>
+struct ResolveReturnType<CastOperator<value_t>, rhs_t> {
+  using type = CastOperator<value_t>;
+};
+
 struct AddOperator;
 struct ProductOperator;
+struct StrongZeroProductOperator;
 struct DivisionOperator;
 struct MaxOperator;
 struct MinOperator;
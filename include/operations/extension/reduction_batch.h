@@ -0,0 +1,97 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename reduction_batch.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_EXTENSION_REDUCTION_BATCH_H
+#define PORTBLAS_EXTENSION_REDUCTION_BATCH_H
+
+#include <sycl/sycl.hpp>
+
+namespace blas {
+
+/*!
+ * @brief Reduction computed for each vector of a batch by Reduction_batch
+ *
+ * - dot: sum of the products of the elements of x and y
+ * - nrm2: square root of the sum of the squares of the elements of x
+ * - asum: sum of the absolute values of the elements of x
+ */
+enum class batch_reduction_t : int { dot = 0, nrm2 = 1, asum = 2 };
+
+/*!
+ * This class holds the kernel implementation of dot_batch, nrm2_batch and
+ * asum_batch, reducing every vector of a strided batch in a single launch.
+ *
+ * subGroupPerBatch selects how the vectors are mapped onto the device: one
+ * vector per sub-group for short vectors, so that a work group reduces several
+ * vectors at once, or one vector per work group otherwise. In both cases the
+ * kernel loops over the batch, so that the number of work groups can be
+ * smaller than the batch size.
+ *
+ * The result of the i-th vector is written to the i-th element of lhs. For
+ * nrm2 and asum, rhs_2 is not read.
+ */
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+struct Reduction_batch {
+  using value_t = typename lhs_t::value_t;
+  using index_t = typename rhs_1_t::index_t;
+
+  lhs_t lhs_;
+  rhs_1_t rhs_1_;
+  rhs_2_t rhs_2_;
+  index_t n_, inc_1_, stride_1_, inc_2_, stride_2_, batch_size_;
+
+  Reduction_batch(lhs_t _lhs, rhs_1_t _rhs_1, rhs_2_t _rhs_2, index_t _N,
+                  index_t _inc_1, index_t _stride_1, index_t _inc_2,
+                  index_t _stride_2, index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  value_t eval(sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  value_t partial_reduction(index_t batch, index_t first, index_t step);
+  static value_t get_final_value(value_t val);
+};
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>
+make_reduction_batch(lhs_t _lhs, rhs_1_t _rhs_1, rhs_2_t _rhs_2,
+                     typename rhs_1_t::index_t _N,
+                     typename rhs_1_t::index_t _inc_1,
+                     typename rhs_1_t::index_t _stride_1,
+                     typename rhs_1_t::index_t _inc_2,
+                     typename rhs_1_t::index_t _stride_2,
+                     typename rhs_1_t::index_t _batch_size) {
+  return Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                         rhs_2_t>(_lhs, _rhs_1, _rhs_2, _N, _inc_1, _stride_1,
+                                  _inc_2, _stride_2, _batch_size);
+}
+
+}  // namespace blas
+
+#endif  // PORTBLAS_EXTENSION_REDUCTION_BATCH_H
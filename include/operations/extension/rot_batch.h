@@ -0,0 +1,125 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename rot_batch.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_EXTENSION_ROT_BATCH_H
+#define PORTBLAS_EXTENSION_ROT_BATCH_H
+
+#include <sycl/sycl.hpp>
+
+namespace blas {
+
+/*!
+ * This class holds the kernel implementation of rot_batch, applying a plane
+ * rotation to every pair of vectors of a strided batch in a single launch.
+ *
+ * Each work item updates one pair of elements: the global id is split into
+ * the index of the pair of vectors in the batch and the index of the element
+ * in the vectors. The rotation of the i-th pair of vectors is read from the
+ * i-th elements of the strided c and s vectors, and a stride of 0 applies the
+ * same rotation to the whole batch.
+ */
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+struct Rot_batch {
+  using value_t = typename lhs_1_t::value_t;
+  using index_t = typename lhs_1_t::index_t;
+
+  lhs_1_t lhs_1_;
+  lhs_2_t lhs_2_;
+  rhs_1_t rhs_1_;
+  rhs_2_t rhs_2_;
+  index_t n_, inc_1_, stride_1_, inc_2_, stride_2_, stride_c_, stride_s_,
+      batch_size_;
+
+  Rot_batch(lhs_1_t _lhs_1, lhs_2_t _lhs_2, rhs_1_t _rhs_1, rhs_2_t _rhs_2,
+            index_t _N, index_t _inc_1, index_t _stride_1, index_t _inc_2,
+            index_t _stride_2, index_t _stride_c, index_t _stride_s,
+            index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  value_t eval(sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * This class holds the kernel implementation of rotm_batch, applying a
+ * modified Givens rotation to every pair of vectors of a strided batch in a
+ * single launch.
+ *
+ * The work items are mapped as in Rot_batch. The rotation of the i-th pair of
+ * vectors is read from the five elements [flag, h11, h21, h12, h22] starting
+ * at i * stride_param in rhs, with the layout given by rotmg.
+ */
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+struct Rotm_batch {
+  using value_t = typename lhs_1_t::value_t;
+  using index_t = typename lhs_1_t::index_t;
+
+  lhs_1_t lhs_1_;
+  lhs_2_t lhs_2_;
+  rhs_t rhs_;
+  index_t n_, inc_1_, stride_1_, inc_2_, stride_2_, stride_param_,
+      batch_size_;
+
+  Rotm_batch(lhs_1_t _lhs_1, lhs_2_t _lhs_2, rhs_t _rhs, index_t _N,
+             index_t _inc_1, index_t _stride_1, index_t _inc_2,
+             index_t _stride_2, index_t _stride_param, index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  value_t eval(sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t> make_rot_batch(
+    lhs_1_t _lhs_1, lhs_2_t _lhs_2, rhs_1_t _rhs_1, rhs_2_t _rhs_2,
+    typename lhs_1_t::index_t _N, typename lhs_1_t::index_t _inc_1,
+    typename lhs_1_t::index_t _stride_1, typename lhs_1_t::index_t _inc_2,
+    typename lhs_1_t::index_t _stride_2, typename lhs_1_t::index_t _stride_c,
+    typename lhs_1_t::index_t _stride_s,
+    typename lhs_1_t::index_t _batch_size) {
+  return Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>(
+      _lhs_1, _lhs_2, _rhs_1, _rhs_2, _N, _inc_1, _stride_1, _inc_2, _stride_2,
+      _stride_c, _stride_s, _batch_size);
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+Rotm_batch<lhs_1_t, lhs_2_t, rhs_t> make_rotm_batch(
+    lhs_1_t _lhs_1, lhs_2_t _lhs_2, rhs_t _rhs, typename lhs_1_t::index_t _N,
+    typename lhs_1_t::index_t _inc_1, typename lhs_1_t::index_t _stride_1,
+    typename lhs_1_t::index_t _inc_2, typename lhs_1_t::index_t _stride_2,
+    typename lhs_1_t::index_t _stride_param,
+    typename lhs_1_t::index_t _batch_size) {
+  return Rotm_batch<lhs_1_t, lhs_2_t, rhs_t>(_lhs_1, _lhs_2, _rhs, _N, _inc_1,
+                                              _stride_1, _inc_2, _stride_2,
+                                              _stride_param, _batch_size);
+}
+
+}  // namespace blas
+
+#endif  // PORTBLAS_EXTENSION_ROT_BATCH_H
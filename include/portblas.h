@@ -27,12 +27,18 @@
 
 #include "blas_meta.h"
 
+#include "container/small_vector.h"
+
 #include "container/sycl_iterator.h"
 
 #include "sb_handle/portblas_handle.h"
 
 #include "sb_handle/kernel_constructor.h"
 
+#include "sb_handle/fusion.h"
+
+#include "sb_handle/sb_handle_group.h"
+
 #include "interface/blas1_interface.h"
 
 #include "interface/blas2_interface.h"
@@ -56,6 +62,8 @@
 #include "operations/extension/matcopy_batch.h"
 
 #include "operations/extension/axpy_batch.h"
+#include "operations/extension/reduction_batch.h"
+#include "operations/extension/rot_batch.h"
 
 #include "operations/blas_constants.h"
 
@@ -27,6 +27,7 @@
 
 #include "blas_meta.h"
 #include "container/sycl_iterator.h"
+#include "sb_handle/device_capabilities.h"
 #include <sycl/sycl.hpp>
 
 namespace blas {
@@ -112,22 +113,16 @@ typename std::enable_if<std::is_same<
 enqueue_deallocate(std::vector<sycl::event>, container_t mem, sycl::queue q) {}
 
 inline bool has_local_memory(sycl::queue &q) {
-  return (
-      q.get_device().template get_info<sycl::info::device::local_mem_type>() ==
-      sycl::info::local_mem_type::local);
+  return Device_Capabilities::get(q.get_device()).has_local_memory;
 }
 // Force the system not to set this to bigger than 256. Using work group size
 // bigger than 256 may cause out of resource error on different platforms.
 inline size_t get_work_group_size(sycl::queue &q) {
-  return std::min(
-      size_t(256),
-      q.get_device()
-          .template get_info<sycl::info::device::max_work_group_size>());
+  return Device_Capabilities::get(q.get_device()).work_group_size;
 }
 
 inline size_t get_num_compute_units(sycl::queue &q) {
-  return q.get_device()
-      .template get_info<sycl::info::device::max_compute_units>();
+  return Device_Capabilities::get(q.get_device()).compute_units;
 }
 
 /* @brief Copying the data back to device
@@ -236,17 +231,8 @@ inline bool is_malloc_shared(sb_handle_t &sb_handle, const containerT _rs) {
 template <typename sb_handle_t>
 inline void throw_unsupported_intel_dGPU(const sb_handle_t &sb_handle,
                                          std::string &&operator_name) {
-  const auto device = sb_handle.get_queue().get_device();
-  if (device.is_gpu()) {
-    const std::string vendor =
-        device.template get_info<sycl::info::device::vendor>();
-    if (vendor.find("Intel") != vendor.npos) {
-      const std::string name =
-          device.template get_info<sycl::info::device::name>();
-      if (name.find("Arc") != name.npos || name.find("GPU Max") != name.npos) {
-        throw unsupported_exception(operator_name);
-      }
-    }
+  if (sb_handle.get_device_capabilities().is_intel_dgpu) {
+    throw unsupported_exception(operator_name);
   }
 }
 
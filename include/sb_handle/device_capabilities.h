@@ -0,0 +1,182 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename device_capabilities.h
+ *
+ **************************************************************************/
+
+
+#ifndef PORTBLAS_DEVICE_CAPABILITIES_H
+#define PORTBLAS_DEVICE_CAPABILITIES_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sycl/sycl.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace blas {
+
+/*! Device_Capabilities.
+ * @brief Properties of a device used by the dispatch of the operations,
+ * queried once per device and per process (see Device_Capabilities::get), so
+ * that creating a SB_Handle or selecting a kernel does not query the device.
+ */
+struct Device_Capabilities {
+  std::string vendor;
+  std::string name;
+  bool is_gpu;
+  bool is_cpu;
+  // Vendor matches, from the vendor string
+  bool is_intel;
+  bool is_nvidia;
+  bool is_amd;
+  // Intel discrete GPU (Arc or Data Center GPU Max)
+  bool is_intel_dgpu;
+
+  size_t max_work_group_size;
+  // Work group size used by default, capped to 256 as larger sizes may run
+  // out of resources on some platforms
+  size_t work_group_size;
+  size_t compute_units;
+  // Supported sub-group sizes, in increasing order
+  std::vector<size_t> sub_group_sizes;
+  size_t min_sub_group_size;
+  size_t max_sub_group_size;
+
+  // Whether the device has dedicated local memory
+  bool has_local_memory;
+  size_t local_mem_size;
+  size_t global_mem_cache_size;
+  size_t global_mem_cache_line_size;
+
+  bool has_fp64;
+  bool has_fp16;
+  // Preferred number of elements of the vectors of each type
+  size_t preferred_vector_width_float;
+  size_t preferred_vector_width_double;
+  size_t preferred_vector_width_half;
+
+  // Whether the device supports acquire-release atomics of device scope, as
+  // used by the single pass reductions
+  bool has_device_atomics;
+  // Whether the device supports 64-bit atomics, as used by the single kernel
+  // iamax and iamin
+  bool has_atomic64;
+
+  // Whether the joint matrix GEMM kernels are requested with the
+  // SB_ENABLE_JOINT_MATRIX environment variable
+  bool use_joint_matrix;
+
+  /*!
+   * @brief Capabilities of @p device, queried on the first call for this
+   * device and shared by all the callers afterwards.
+   */
+  static inline const Device_Capabilities& get(const sycl::device& device) {
+    static std::mutex mutex;
+    static std::unordered_map<sycl::device,
+                              std::unique_ptr<const Device_Capabilities>>
+        cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& caps = cache[device];
+    if (!caps) {
+      caps.reset(new Device_Capabilities(query(device)));
+    }
+    return *caps;
+  }
+
+ private:
+  static inline Device_Capabilities query(const sycl::device& device) {
+    using namespace sycl::info;
+    Device_Capabilities caps;
+    caps.vendor = device.get_info<device::vendor>();
+    caps.name = device.get_info<device::name>();
+    caps.is_gpu = device.is_gpu();
+    caps.is_cpu = device.is_cpu();
+    caps.is_intel = caps.vendor.find("Intel") != std::string::npos;
+    caps.is_nvidia = caps.vendor.find("NVIDIA") != std::string::npos;
+    caps.is_amd = caps.vendor.find("AMD") != std::string::npos ||
+                  caps.vendor.find("Advanced Micro Devices") !=
+                      std::string::npos;
+    caps.is_intel_dgpu =
+        caps.is_gpu && caps.is_intel &&
+        (caps.name.find("Arc") != std::string::npos ||
+         caps.name.find("GPU Max") != std::string::npos);
+
+    caps.max_work_group_size = device.get_info<device::max_work_group_size>();
+    caps.work_group_size = std::min(size_t(256), caps.max_work_group_size);
+    caps.compute_units = device.get_info<device::max_compute_units>();
+    caps.sub_group_sizes = device.get_info<device::sub_group_sizes>();
+    std::sort(caps.sub_group_sizes.begin(), caps.sub_group_sizes.end());
+    if (caps.sub_group_sizes.empty()) {
+      caps.sub_group_sizes.push_back(1);
+    }
+    caps.min_sub_group_size = caps.sub_group_sizes.front();
+    caps.max_sub_group_size = caps.sub_group_sizes.back();
+
+    caps.has_local_memory =
+        device.get_info<device::local_mem_type>() == local_mem_type::local;
+    caps.local_mem_size = device.get_info<device::local_mem_size>();
+    caps.global_mem_cache_size =
+        device.get_info<device::global_mem_cache_size>();
+    caps.global_mem_cache_line_size =
+        device.get_info<device::global_mem_cache_line_size>();
+
+    caps.has_fp64 = device.has(sycl::aspect::fp64);
+    caps.has_fp16 = device.has(sycl::aspect::fp16);
+    caps.preferred_vector_width_float =
+        device.get_info<device::preferred_vector_width_float>();
+    caps.preferred_vector_width_double =
+        device.get_info<device::preferred_vector_width_double>();
+    caps.preferred_vector_width_half =
+        device.get_info<device::preferred_vector_width_half>();
+    caps.has_device_atomics = query_device_atomics(device);
+    caps.has_atomic64 = device.has(sycl::aspect::atomic64);
+
+    const char* joint_matrix = std::getenv("SB_ENABLE_JOINT_MATRIX");
+    caps.use_joint_matrix = joint_matrix != nullptr && *joint_matrix == '1';
+    return caps;
+  }
+
+  static inline bool query_device_atomics(const sycl::device& device) {
+    using namespace sycl::info;
+    try {
+      const auto orders =
+          device.get_info<device::atomic_memory_order_capabilities>();
+      const auto scopes =
+          device.get_info<device::atomic_memory_scope_capabilities>();
+      return std::find(orders.begin(), orders.end(),
+                       sycl::memory_order::acq_rel) != orders.end() &&
+             std::find(scopes.begin(), scopes.end(),
+                       sycl::memory_scope::device) != scopes.end();
+    } catch (sycl::exception&) {
+      // The implementation does not report the atomic capabilities
+      return false;
+    }
+  }
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_DEVICE_CAPABILITIES_H
@@ -0,0 +1,267 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename execution_plan.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_EXECUTION_PLAN_H
+#define PORTBLAS_EXECUTION_PLAN_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <sycl/sycl.hpp>
+#include <vector>
+
+#include "container/small_vector.h"
+
+namespace blas {
+
+/*!
+ * @brief Mechanism used by an Execution_Plan to replay the captured kernels.
+ */
+enum class plan_backend_t : int {
+  // SYCL command graph when the implementation provides it, command groups
+  // otherwise
+  automatic = 0,
+  // Pre-built command group functions re-submitted to the queue
+  command_group = 1,
+  // sycl_ext_oneapi_graph executable graph
+  sycl_graph = 2
+};
+
+/*! Execution_Plan.
+ * @brief Records the kernels submitted by a SB_Handle between begin_capture
+ * and end_capture, and replays them without going again through the host side
+ * dispatch, view and tree construction of the captured calls.
+ *
+ * The plan binds the memory and scalars used at capture time: to run it on new
+ * data, update the content of the captured buffers or USM allocations.
+ * Temporary memory acquired by the captured calls is kept alive until the plan
+ * is destroyed, so a plan must not outlive the SB_Handle (and memory pool) it
+ * was captured with.
+ *
+ * Only the device work submitted through the SB_Handle is recorded, that is
+ * its kernels and the fills done with SB_Handle::fill: commands submitted
+ * directly to the queue are not replayed, and calls synchronizing with the
+ * host (such as the scalar returning _dot) cannot be captured. With the
+ * sycl_graph backend the queue is in recording mode during the capture, hence
+ * the events returned by the captured calls must not be waited on, and the
+ * captured calls must not depend on events from outside the capture.
+ */
+class Execution_Plan {
+  using queue_t = sycl::queue;
+  using event_t = event_vector_t;
+  using submit_t = std::function<sycl::event(queue_t, const event_t&)>;
+
+  struct submission_t {
+    submit_t submit;
+    // Indices of the recorded submissions this one depends on
+    std::vector<size_t> dependencies;
+    // Whether it depended on events produced outside the capture
+    bool external_dependencies;
+  };
+
+ public:
+  Execution_Plan(plan_backend_t backend = plan_backend_t::automatic)
+      : backend_(backend), capturing_(false), q_(nullptr) {}
+  Execution_Plan(const Execution_Plan& h) = delete;
+  Execution_Plan operator=(Execution_Plan) = delete;
+
+  ~Execution_Plan() {
+    if (q_ != nullptr) {
+      q_->wait();
+    }
+    for (auto& release : deferred_releases_) {
+      release();
+    }
+  }
+
+  /*!
+   * @brief Starts recording the kernels submitted to @p q. Called by
+   * SB_Handle::begin_capture.
+   */
+  inline void begin_capture(queue_t q) {
+    if (capturing_) {
+      throw std::runtime_error("Execution_Plan is already capturing");
+    }
+    submissions_.clear();
+    capture_events_.clear();
+    q_ = std::make_unique<queue_t>(q);
+    capturing_ = true;
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    if (backend_ != plan_backend_t::command_group) {
+      try {
+        graph_ = std::make_unique<modifiable_graph_t>(q.get_context(),
+                                                      q.get_device());
+        graph_->begin_recording(q);
+        backend_ = plan_backend_t::sycl_graph;
+        return;
+      } catch (sycl::exception&) {
+        // The device does not support command graphs
+        graph_.reset();
+        if (backend_ == plan_backend_t::sycl_graph) {
+          capturing_ = false;
+          throw;
+        }
+      }
+    }
+#else
+    if (backend_ == plan_backend_t::sycl_graph) {
+      capturing_ = false;
+      throw std::runtime_error(
+          "SYCL command graphs are not supported by this SYCL implementation");
+    }
+#endif
+    backend_ = plan_backend_t::command_group;
+  }
+
+  /*!
+   * @brief Stops recording and finalizes the plan.
+   */
+  inline void end_capture() {
+    if (!capturing_) {
+      throw std::runtime_error("Execution_Plan is not capturing");
+    }
+    capturing_ = false;
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    if (backend_ == plan_backend_t::sycl_graph) {
+      graph_->end_recording(*q_);
+      exec_graph_ = std::make_unique<executable_graph_t>(graph_->finalize());
+    }
+#endif
+    capture_events_.clear();
+  }
+
+  /*!
+   * @brief Whether the kernels must be recorded as command group functions
+   * by the SB_Handle.
+   */
+  inline bool records_command_groups() const {
+    return capturing_ && backend_ == plan_backend_t::command_group;
+  }
+
+  inline bool is_capturing() const { return capturing_; }
+
+  inline plan_backend_t get_backend() const { return backend_; }
+
+  /*!
+   * @brief Number of kernels recorded with the command_group backend.
+   */
+  inline size_t size() const { return submissions_.size(); }
+
+  /*!
+   * @brief Records a kernel submission. @p event is the event returned by the
+   * submission made at capture time, and is used to resolve the dependencies
+   * of the following submissions.
+   */
+  inline void record(submit_t submit, const event_t& dependencies,
+                     sycl::event event) {
+    submission_t submission{std::move(submit), {}, false};
+    for (const auto& dep : dependencies) {
+      auto found =
+          std::find(capture_events_.begin(), capture_events_.end(), dep);
+      if (found != capture_events_.end()) {
+        submission.dependencies.push_back(
+            static_cast<size_t>(found - capture_events_.begin()));
+      } else {
+        submission.external_dependencies = true;
+      }
+    }
+    submissions_.push_back(std::move(submission));
+    capture_events_.push_back(event);
+  }
+
+  /*!
+   * @brief Keeps some temporary memory alive until the plan is destroyed.
+   * @param release Function releasing the memory.
+   */
+  inline void defer_release(std::function<void()> release) {
+    deferred_releases_.push_back(std::move(release));
+  }
+
+  /*!
+   * @brief Replays the captured kernels.
+   * @param dependencies Events the captured calls that depended on work
+   * submitted outside the capture (and the graph, for the sycl_graph backend)
+   * must wait for.
+   * @return The events of the replayed kernels no other replayed kernel
+   * depends on.
+   */
+  inline event_t replay(const event_t& dependencies = {}) {
+    if (capturing_ || q_ == nullptr) {
+      throw std::runtime_error("Execution_Plan has not been captured");
+    }
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    if (backend_ == plan_backend_t::sycl_graph) {
+      auto& exec_graph = *exec_graph_;
+      return {q_->submit([&](sycl::handler& cgh) {
+        for (const auto& dep : dependencies) {
+          cgh.depends_on(dep);
+        }
+        cgh.ext_oneapi_graph(exec_graph);
+      })};
+    }
+#endif
+    std::vector<sycl::event> events(submissions_.size());
+    std::vector<bool> is_sink(submissions_.size(), true);
+    event_t submission_dependencies;
+    for (size_t i = 0; i < submissions_.size(); ++i) {
+      const auto& submission = submissions_[i];
+      submission_dependencies.clear();
+      if (submission.external_dependencies) {
+        submission_dependencies = dependencies;
+      }
+      for (const auto dep : submission.dependencies) {
+        submission_dependencies.push_back(events[dep]);
+        is_sink[dep] = false;
+      }
+      events[i] = submission.submit(*q_, submission_dependencies);
+    }
+    event_t sinks;
+    for (size_t i = 0; i < events.size(); ++i) {
+      if (is_sink[i]) sinks.push_back(events[i]);
+    }
+    return sinks;
+  }
+
+ private:
+  plan_backend_t backend_;
+  bool capturing_;
+  std::unique_ptr<queue_t> q_;
+  std::vector<submission_t> submissions_;
+  std::vector<sycl::event> capture_events_;
+  std::vector<std::function<void()>> deferred_releases_;
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+  using modifiable_graph_t = sycl::ext::oneapi::experimental::command_graph<
+      sycl::ext::oneapi::experimental::graph_state::modifiable>;
+  using executable_graph_t = sycl::ext::oneapi::experimental::command_graph<
+      sycl::ext::oneapi::experimental::graph_state::executable>;
+  std::unique_ptr<modifiable_graph_t> graph_;
+  std::unique_ptr<executable_graph_t> exec_graph_;
+#endif
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_EXECUTION_PLAN_H
@@ -0,0 +1,184 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename fusion.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_FUSION_H
+#define PORTBLAS_FUSION_H
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "operations/blas1_trees.h"
+#include "sb_handle/portblas_handle.h"
+#include "views/view.h"
+
+namespace blas {
+namespace fusion {
+
+/*! view_access_t.
+ * @brief Memory footprint of a single vector view used by a tree.
+ * USM views are identified by their address range. Buffer views are bound
+ * through placeholder accessors which cannot be compared on the host, so they
+ * are only described by their displacement, stride and size and are assumed
+ * to alias every other buffer view.
+ */
+struct view_access_t {
+  bool is_usm;
+  std::uintptr_t base;
+  std::ptrdiff_t stride;
+  std::ptrdiff_t size;
+  std::size_t elem_size;
+  bool write;
+};
+
+/*! tree_footprint_t.
+ * @brief The set of views read and written by a tree. A tree containing a
+ * node whose accesses are not known (reductions, matrix views, ...) is
+ * flagged as opaque and is never fused with another tree.
+ */
+struct tree_footprint_t {
+  std::vector<view_access_t> accesses;
+  bool opaque = false;
+};
+
+template <typename tree_t>
+void collect_access(const tree_t &, tree_footprint_t &, bool);
+
+template <typename container_t, typename index_t, typename increment_t>
+void collect_access(const VectorView<container_t, index_t, increment_t> &,
+                    tree_footprint_t &, bool);
+
+template <typename scalar_t, int dim, sycl::access_mode acc_mode_t,
+          sycl::target access_t, sycl::access::placeholder place_holder_t,
+          typename index_t, typename increment_t>
+void collect_access(
+    const VectorView<sycl::accessor<scalar_t, dim, acc_mode_t, access_t,
+                                    place_holder_t>,
+                     index_t, increment_t> &,
+    tree_footprint_t &, bool);
+
+template <typename lhs_t, typename rhs_t>
+void collect_access(const Join<lhs_t, rhs_t> &, tree_footprint_t &, bool);
+
+template <typename lhs_t, typename rhs_t>
+void collect_access(const Assign<lhs_t, rhs_t> &, tree_footprint_t &, bool);
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+void collect_access(const DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t> &,
+                    tree_footprint_t &, bool);
+
+template <typename operator_t, typename scalar_t, typename rhs_t>
+void collect_access(const ScalarOp<operator_t, scalar_t, rhs_t> &,
+                    tree_footprint_t &, bool);
+
+template <typename operator_t, typename rhs_t>
+void collect_access(const UnaryOp<operator_t, rhs_t> &, tree_footprint_t &,
+                    bool);
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+void collect_access(const BinaryOp<operator_t, lhs_t, rhs_t> &,
+                    tree_footprint_t &, bool);
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+void collect_access(const BinaryOpConst<operator_t, lhs_t, rhs_t> &,
+                    tree_footprint_t &, bool);
+
+template <typename rhs_t>
+void collect_access(const TupleOp<rhs_t> &, tree_footprint_t &, bool);
+
+/*!
+ * @brief Returns the footprint of a whole tree.
+ */
+template <typename tree_t>
+tree_footprint_t make_footprint(const tree_t &tree);
+
+/*!
+ * @brief Returns true if evaluating @p second after @p first element by
+ * element in the same kernel could observe a different result than running
+ * the two trees one after the other, i.e. if a view written by one of them
+ * overlaps a view of the other one with a different access pattern.
+ */
+inline bool has_hazard(const tree_footprint_t &first,
+                       const tree_footprint_t &second);
+
+}  // namespace fusion
+
+/*! Lazy_Fusion.
+ * @brief Accumulates BLAS1 expression trees without launching them. Each call
+ * to defer returns a new Lazy_Fusion holding one more tree, and flush hands the
+ * whole group to SB_Handle::execute_fused, which merges the trees that do not
+ * depend on each other into a single kernel.
+ *
+ * @code
+ * auto events = make_lazy_fusion(sb_handle)
+ *                   .defer(axpy_tree)
+ *                   .defer(scal_tree)
+ *                   .flush();
+ * @endcode
+ */
+template <typename... trees_t>
+class Lazy_Fusion {
+ public:
+  using event_t = typename SB_Handle::event_t;
+
+  Lazy_Fusion(SB_Handle &sb_handle, std::tuple<trees_t...> trees,
+              const event_t &dependencies);
+
+  /*!
+   * @brief Adds a tree to the group. The tree is not launched until flush is
+   * called.
+   * @param tree Expression tree to defer.
+   * @param dependencies Additional events the group must wait for.
+   */
+  template <typename tree_t>
+  Lazy_Fusion<trees_t..., tree_t> defer(tree_t tree,
+                                        const event_t &dependencies = {}) const;
+
+  /*!
+   * @brief Launches the deferred trees.
+   */
+  event_t flush() const;
+
+  inline std::size_t size() const { return sizeof...(trees_t); }
+
+ private:
+  SB_Handle &sb_handle_;
+  std::tuple<trees_t...> trees_;
+  event_t dependencies_;
+};
+
+/*!
+ * @brief Creates an empty Lazy_Fusion group for the given SB_Handle.
+ */
+inline Lazy_Fusion<> make_lazy_fusion(
+    SB_Handle &sb_handle,
+    const typename SB_Handle::event_t &dependencies = {}) {
+  return Lazy_Fusion<>(sb_handle, std::tuple<>(), dependencies);
+}
+
+}  // namespace blas
+
+#endif  // PORTBLAS_FUSION_H
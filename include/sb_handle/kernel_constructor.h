@@ -28,6 +28,8 @@
 
 #include <sycl/sycl.hpp>
 
+#include "container/small_vector.h"
+
 namespace blas {
 
 /*!using_local_memory.
@@ -121,7 +123,7 @@ template <int using_local_memory, typename queue_t, typename expression_tree_t>
 static sycl::event execute_tree(queue_t q, expression_tree_t t,
                                 size_t _localSize, size_t _globalSize,
                                 size_t _shMem,
-                                std::vector<sycl::event> dependencies = {});
+                                const event_vector_t& dependencies = {});
 
 }  // namespace blas
 
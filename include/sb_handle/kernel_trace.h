@@ -0,0 +1,228 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename kernel_trace.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_KERNEL_TRACE_H
+#define PORTBLAS_KERNEL_TRACE_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <sycl/sycl.hpp>
+#include <typeinfo>
+#include <vector>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace blas {
+
+/*! Kernel_Trace.
+ * @brief Records the kernels submitted by the SB_Handles it is attached to
+ * (see SB_Handle::set_trace) and exports them in the Chrome trace event
+ * format, which can be loaded in chrome://tracing or Perfetto.
+ *
+ * Each record holds the expression tree type, the nd_range, the local memory
+ * size, the BLAS call that submitted the kernel and its event. The device
+ * timestamps are read from the events when exporting, and are only available
+ * if the queue was created with the enable_profiling property. Otherwise the
+ * kernels are placed at their host submission time, without duration.
+ */
+class Kernel_Trace {
+  using clock_t = std::chrono::steady_clock;
+
+ public:
+  struct record_t {
+    // Mangled type name of the expression tree
+    const char* tree;
+    // BLAS call that submitted the kernel, nullptr if none
+    const char* call;
+    size_t global_size;
+    size_t local_size;
+    size_t local_memory;
+    // Host submission time, in microseconds since the trace creation
+    double host_submit_us;
+    sycl::event event;
+  };
+
+  Kernel_Trace() : origin_(clock_t::now()) {}
+  Kernel_Trace(const Kernel_Trace& h) = delete;
+  Kernel_Trace operator=(Kernel_Trace) = delete;
+
+  /*!
+   * @brief Records a kernel submission. Called by the SB_Handle.
+   */
+  template <typename expression_tree_t>
+  inline void record(const char* call, size_t global_size, size_t local_size,
+                     size_t local_memory, sycl::event event) {
+    const double submit_us =
+        std::chrono::duration<double, std::micro>(clock_t::now() - origin_)
+            .count();
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.push_back({typeid(expression_tree_t).name(), call, global_size,
+                        local_size, local_memory, submit_us, event});
+  }
+
+  inline size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return records_.size();
+  }
+
+  inline std::vector<record_t> get_records() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return records_;
+  }
+
+  inline void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.clear();
+  }
+
+  /*!
+   * @brief Human readable name of the expression tree of a record.
+   */
+  static inline std::string tree_name(const record_t& record) {
+#if defined(__GNUG__)
+    int status = 0;
+    std::unique_ptr<char, void (*)(void*)> demangled(
+        abi::__cxa_demangle(record.tree, nullptr, nullptr, &status),
+        std::free);
+    if (status == 0) {
+      return demangled.get();
+    }
+#endif
+    return record.tree;
+  }
+
+  /*!
+   * @brief Tree name without namespace and template arguments, e.g. "Gemm".
+   */
+  static inline std::string short_tree_name(const record_t& record) {
+    std::string name = tree_name(record);
+    name = name.substr(0, name.find('<'));
+    const auto scope = name.rfind("::");
+    return scope == std::string::npos ? name : name.substr(scope + 2);
+  }
+
+  /*!
+   * @brief Writes the trace as Chrome trace event JSON. Waits for the recorded
+   * kernels to complete.
+   */
+  inline void export_chrome_trace(std::ostream& os) const {
+    auto records = get_records();
+    struct timing_t {
+      bool profiled;
+      uint64_t submit, start, end;
+    };
+    std::vector<timing_t> timings(records.size(), {false, 0, 0, 0});
+    uint64_t device_origin = UINT64_MAX;
+    for (size_t i = 0; i < records.size(); ++i) {
+      auto& event = records[i].event;
+      event.wait();
+      try {
+        using namespace sycl::info;
+        timings[i].submit =
+            event.get_profiling_info<event_profiling::command_submit>();
+        timings[i].start =
+            event.get_profiling_info<event_profiling::command_start>();
+        timings[i].end =
+            event.get_profiling_info<event_profiling::command_end>();
+        timings[i].profiled = true;
+        device_origin = std::min(device_origin, timings[i].submit);
+      } catch (sycl::exception&) {
+        // The queue does not have the enable_profiling property
+      }
+    }
+
+    os << "{\"traceEvents\":[";
+    for (size_t i = 0; i < records.size(); ++i) {
+      const auto& record = records[i];
+      const auto& timing = timings[i];
+      os << (i == 0 ? "\n" : ",\n") << "{\"name\":\""
+         << escape(short_tree_name(record)) << "\",\"cat\":\""
+         << (record.call != nullptr ? record.call : "portblas")
+         << "\",\"pid\":0,\"tid\":0,";
+      if (timing.profiled) {
+        os << "\"ph\":\"X\",\"ts\":"
+           << static_cast<double>(timing.start - device_origin) / 1000.0
+           << ",\"dur\":"
+           << static_cast<double>(timing.end - timing.start) / 1000.0 << ",";
+      } else {
+        os << "\"ph\":\"i\",\"s\":\"t\",\"ts\":" << record.host_submit_us
+           << ",";
+      }
+      os << "\"args\":{\"call\":\""
+         << (record.call != nullptr ? record.call : "") << "\",\"tree\":\""
+         << escape(tree_name(record))
+         << "\",\"global_size\":" << record.global_size
+         << ",\"local_size\":" << record.local_size
+         << ",\"local_memory\":" << record.local_memory;
+      if (timing.profiled) {
+        os << ",\"queued_us\":"
+           << static_cast<double>(timing.start - timing.submit) / 1000.0;
+      }
+      os << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  }
+
+  /*!
+   * @brief Writes the trace as Chrome trace event JSON into @p file_name.
+   */
+  inline void export_chrome_trace(const std::string& file_name) const {
+    std::ofstream file(file_name);
+    if (!file) {
+      throw std::runtime_error("Unable to open trace file " + file_name);
+    }
+    export_chrome_trace(file);
+  }
+
+ private:
+  static inline std::string escape(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str) {
+      if (c == '"' || c == '\\') {
+        escaped.push_back('\\');
+      }
+      escaped.push_back(c);
+    }
+    return escaped;
+  }
+
+  const clock_t::time_point origin_;
+  mutable std::mutex mutex_;
+  std::vector<record_t> records_;
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_KERNEL_TRACE_H
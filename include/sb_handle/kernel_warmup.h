@@ -0,0 +1,166 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename kernel_warmup.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_KERNEL_WARMUP_H
+#define PORTBLAS_KERNEL_WARMUP_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <sycl/sycl.hpp>
+#include <typeindex>
+#include <vector>
+
+namespace blas {
+
+class SB_Handle;
+
+/*!
+ * @brief Call of an operation on the SB_Handle it is given, with the types
+ * and sizes of the calls to warm up, see SB_Handle::warmup.
+ */
+using Warmup_Op = std::function<void(SB_Handle&)>;
+
+/*! Kernel_Warmup_Config.
+ * @brief Options of a Kernel_Warmup.
+ */
+struct Kernel_Warmup_Config {
+  // Directory where the SYCL runtime persists the built kernels, so that the
+  // next processes load them instead of compiling them again. Left to the
+  // runtime defaults if empty. As the runtime reads it once, it only applies
+  // if set before the first kernel of the process is built.
+  std::string cache_dir;
+};
+
+/*! Kernel_Warmup.
+ * @brief Kernels resolved by SB_Handle::warmup and their executable kernel
+ * bundles, built ahead of the first calls to avoid their JIT compilation
+ * latency.
+ *
+ * The warmup runs the dispatch of each operation without submitting any
+ * command, so the kernels are the ones the same calls select, for the device
+ * of the handle. The bundles are kept alive by the Kernel_Warmup, in addition
+ * to the caches of the SYCL runtime.
+ *
+ * With AdaptiveCpp, whose kernels are compiled when first launched, the
+ * kernels are resolved but no bundle is built: cache_dir sets the application
+ * database where AdaptiveCpp persists them.
+ */
+class Kernel_Warmup {
+ public:
+  explicit Kernel_Warmup(
+      const Kernel_Warmup_Config& config = Kernel_Warmup_Config())
+      : config_(config) {
+    if (!config_.cache_dir.empty()) {
+      set_cache_dir(config_.cache_dir);
+    }
+  }
+  Kernel_Warmup(const Kernel_Warmup& h) = delete;
+  Kernel_Warmup operator=(Kernel_Warmup) = delete;
+
+  inline const Kernel_Warmup_Config& get_config() const { return config_; }
+
+  /*!
+   * @brief Records a kernel selected by an operation. Called by the
+   * SB_Handle.
+   * @tparam kernel_t Type of the kernel functor, also the kernel name.
+   */
+  template <typename kernel_t>
+  inline void record() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::type_index type(typeid(kernel_t));
+    if (std::find(types_.begin(), types_.end(), type) != types_.end()) {
+      return;
+    }
+    types_.push_back(type);
+#ifndef __ADAPTIVECPP__
+    pending_ids_.push_back(sycl::get_kernel_id<kernel_t>());
+#endif
+  }
+
+  /*!
+   * @brief Builds the executable bundle of the kernels recorded since the
+   * last build, for the device and context of @p q.
+   */
+  inline void build(const sycl::queue& q) {
+    std::lock_guard<std::mutex> lock(mutex_);
+#ifndef __ADAPTIVECPP__
+    if (pending_ids_.empty()) {
+      return;
+    }
+    bundles_.push_back(sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+        q.get_context(), {q.get_device()}, pending_ids_));
+    pending_ids_.clear();
+#endif
+  }
+
+  /*!
+   * @brief Number of distinct kernels recorded.
+   */
+  inline size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return types_.size();
+  }
+
+#ifndef __ADAPTIVECPP__
+  inline std::vector<sycl::kernel_bundle<sycl::bundle_state::executable>>
+  get_kernel_bundles() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bundles_;
+  }
+#endif
+
+ private:
+  static inline void set_env(const char* name, const std::string& value) {
+#ifdef _WIN32
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 1);
+#endif
+  }
+
+  static inline void set_cache_dir(const std::string& dir) {
+#ifdef __ADAPTIVECPP__
+    set_env("ACPP_APPDB_DIR", dir);
+#else
+    set_env("SYCL_CACHE_PERSISTENT", "1");
+    set_env("SYCL_CACHE_DIR", dir);
+#endif
+  }
+
+  const Kernel_Warmup_Config config_;
+  mutable std::mutex mutex_;
+  std::vector<std::type_index> types_;
+#ifndef __ADAPTIVECPP__
+  std::vector<sycl::kernel_id> pending_ids_;
+  std::vector<sycl::kernel_bundle<sycl::bundle_state::executable>> bundles_;
+#endif
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_KERNEL_WARMUP_H
@@ -0,0 +1,122 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename pending_release_list.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_PENDING_RELEASE_LIST_H
+#define PORTBLAS_PENDING_RELEASE_LIST_H
+
+#include <mutex>
+#include <sycl/sycl.hpp>
+#include <utility>
+#include <vector>
+
+#include "container/small_vector.h"
+
+namespace blas {
+
+/*! Pending_Release_List.
+ * @brief Memory blocks released while commands may still be using them, each
+ * with the events of these commands. The blocks are handed back once their
+ * events are complete, which is checked by polling the event status instead
+ * of submitting a host_task per release.
+ *
+ * @tparam block_t Type of the blocks, e.g. a pointer or a buffer.
+ */
+template <typename block_t>
+class Pending_Release_List {
+ public:
+  using event_t = event_vector_t;
+
+  Pending_Release_List() = default;
+  Pending_Release_List(const Pending_Release_List& h) = delete;
+  Pending_Release_List operator=(Pending_Release_List) = delete;
+
+  inline void push(block_t block, const event_t& events) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.emplace_back(std::move(block), events);
+  }
+
+  /*!
+   * @brief Calls @p reclaim(block) for the blocks whose events are complete.
+   * Returns immediately if another thread is already polling.
+   */
+  template <typename reclaim_t>
+  inline void poll(reclaim_t reclaim) {
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock() || pending_.empty()) {
+      return;
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < pending_.size(); ++i) {
+      if (is_complete(pending_[i].second)) {
+        reclaim(std::move(pending_[i].first));
+      } else {
+        if (kept != i) {
+          pending_[kept] = std::move(pending_[i]);
+        }
+        ++kept;
+      }
+    }
+    pending_.erase(pending_.begin() + kept, pending_.end());
+  }
+
+  /*!
+   * @brief Waits for all the events and calls @p reclaim(block) for all the
+   * blocks.
+   */
+  template <typename reclaim_t>
+  inline void drain(reclaim_t reclaim) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& pending : pending_) {
+      for (auto& event : pending.second) {
+        event.wait();
+      }
+      reclaim(std::move(pending.first));
+    }
+    pending_.clear();
+  }
+
+  inline size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+  }
+
+ private:
+  static inline bool is_complete(const event_t& events) {
+    for (const auto& event : events) {
+      if (event.get_info<sycl::info::event::command_execution_status>() !=
+          sycl::info::event_command_status::complete) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  mutable std::mutex mutex_;
+  std::vector<std::pair<block_t, event_t>> pending_;
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_PENDING_RELEASE_LIST_H
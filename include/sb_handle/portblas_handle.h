@@ -25,13 +25,26 @@
 
 #ifndef PORTBLAS_HANDLE_H
 #define PORTBLAS_HANDLE_H
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+
 #include "blas_meta.h"
+#include "container/small_vector.h"
+#include "device_capabilities.h"
+#include "execution_plan.h"
+#include "kernel_trace.h"
+#include "kernel_warmup.h"
 #include "operations/blas1_trees.h"
 #include "operations/blas2_trees.h"
 #include "operations/blas3_trees.h"
 #include "operations/extension/reduction.h"
+#include "pending_release_list.h"
 #include "portblas_helper.h"
+#include "scalar_future.h"
 #include "temp_memory_pool.h"
+#include "workspace.h"
 
 namespace blas {
 
@@ -47,26 +60,51 @@ class SB_Handle {
   using queue_t = sycl::queue;
 
  public:
-  using event_t = std::vector<sycl::event>;
+  using event_t = event_vector_t;
   inline SB_Handle(queue_t q)
-      :
-#ifndef __ADAPTIVECPP__
-        tempMemPool_(nullptr),
+      : tempMemPool_(nullptr),
+#ifdef SB_ENABLE_USM
+        pendingFrees_(make_pending_frees(q)),
 #endif
         q_(q),
-        workGroupSize_(helper::get_work_group_size(q)),
-        localMemorySupport_(helper::has_local_memory(q)),
-        computeUnits_(helper::get_num_compute_units(q)) {
+        deviceCaps_(&Device_Capabilities::get(q.get_device())),
+        workGroupSize_(deviceCaps_->work_group_size),
+        localMemorySupport_(deviceCaps_->has_local_memory),
+        computeUnits_(deviceCaps_->compute_units),
+        inOrderFastPath_(q.is_in_order()),
+        recentEventsNext_(0),
+        singlePassReduction_(deviceCaps_->has_device_atomics),
+        reproducible_(false),
+        plan_(nullptr),
+        trace_(nullptr),
+        traceCall_(nullptr),
+        workspace_(nullptr),
+        warmup_(nullptr),
+        reductionLaunch_(0, 0),
+        hostSlots_(std::make_shared<Host_Slot_Pool>(q)) {
   }
 
-#ifndef __ADAPTIVECPP__
   inline SB_Handle(Temp_Mem_Pool* tmp)
       : tempMemPool_(tmp),
-        q_(tmp->get_queue()),
-        workGroupSize_(helper::get_work_group_size(q_)),
-        localMemorySupport_(helper::has_local_memory(q_)),
-        computeUnits_(helper::get_num_compute_units(q_)) {}
+#ifdef SB_ENABLE_USM
+        pendingFrees_(make_pending_frees(tmp->get_queue())),
 #endif
+        q_(tmp->get_queue()),
+        deviceCaps_(&Device_Capabilities::get(q_.get_device())),
+        workGroupSize_(deviceCaps_->work_group_size),
+        localMemorySupport_(deviceCaps_->has_local_memory),
+        computeUnits_(deviceCaps_->compute_units),
+        inOrderFastPath_(q_.is_in_order()),
+        recentEventsNext_(0),
+        singlePassReduction_(deviceCaps_->has_device_atomics),
+        reproducible_(false),
+        plan_(nullptr),
+        trace_(nullptr),
+        traceCall_(nullptr),
+        workspace_(nullptr),
+        warmup_(nullptr),
+        reductionLaunch_(0, 0),
+        hostSlots_(std::make_shared<Host_Slot_Pool>(q_)) {}
 
   template <helper::AllocType alloc, typename value_t>
   typename std::enable_if<
@@ -112,6 +150,26 @@ class SB_Handle {
   event_t execute(expression_tree_t tree, index_t localSize, index_t globalSize,
                   index_t local_memory_size, const event_t& dependencies = {});
 
+  /*!
+   * @brief Executes a group of element-wise trees, merging into a single
+   * kernel the consecutive trees that do not depend on each other.
+   * Trees are evaluated in the given order. See Lazy_Fusion for the deferred
+   * interface.
+   */
+  template <typename... expression_tree_t>
+  event_t execute_fused(const event_t& dependencies,
+                        expression_tree_t... trees);
+
+  /*!
+   * @brief Fills the first @p size elements of @p container with @p value.
+   * Unlike helper::fill on the queue, the fill is recorded in the
+   * Execution_Plan being captured and done again when the plan is replayed.
+   */
+  template <typename container_t>
+  event_t fill(container_t container,
+               typename ValueType<container_t>::type value, size_t size,
+               const event_t& dependencies = {});
+
   template <typename operator_t, typename lhs_t, typename rhs_t>
   event_t execute(AssignReduction<operator_t, lhs_t, rhs_t>,
                   const event_t& dependencies = {});
@@ -172,11 +230,235 @@ class SB_Handle {
 
   inline size_t get_num_compute_units() const { return computeUnits_; }
 
-  inline void wait() { q_.wait(); }
+  /*!
+   * @brief Fixes the work group size and the number of work groups of the
+   * one-pass reductions (_dot, _nrm2 and _asum) of the default backend,
+   * instead of planning them from the device and the vector size. Zero keeps
+   * the planned value.
+   */
+  inline void set_reduction_launch(size_t local_size, size_t number_WG) {
+    reductionLaunch_ = {local_size, number_WG};
+  }
+
+  /*!
+   * @brief Work group size and number of work groups set by
+   * set_reduction_launch, zero when planned.
+   */
+  inline std::pair<size_t, size_t> get_reduction_launch() const {
+    return reductionLaunch_;
+  }
+
+  /*!
+   * @brief Capabilities of the device of the queue, shared by all the handles
+   * on this device.
+   */
+  inline const Device_Capabilities& get_device_capabilities() const {
+    return *deviceCaps_;
+  }
+
+  /*!
+   * @brief Pool of the host slots holding the results of the asynchronous
+   * scalar-returning operations, shared by the copies of the handle.
+   */
+  inline const std::shared_ptr<Host_Slot_Pool>& get_host_slot_pool() const {
+    return hostSlots_;
+  }
+
+  /*!
+   * @brief Whether the handle relies on the queue ordering instead of the
+   * dependency lists. Enabled by default when the queue is in-order: the
+   * kernels are then submitted without depends_on when their dependencies are
+   * all among the last events submitted by the handle, and the handle only
+   * keeps the last event of the kernel sequences it runs. Other dependencies,
+   * such as events of other queues, are still waited on.
+   */
+  inline bool is_in_order_fast_path() const { return inOrderFastPath_; }
+
+  /*!
+   * @brief Enables or disables the in-order fast path. It cannot be enabled
+   * for an out-of-order queue.
+   */
+  inline void set_in_order_fast_path(bool enable) {
+    inOrderFastPath_ = enable && q_.is_in_order();
+  }
+
+  /*!
+   * @brief Whether the reductions executed with execute(AssignReduction) run
+   * in a single kernel, the last work group reducing the partial results of
+   * the others (see SinglePassReduction), instead of one kernel per pass.
+   * On devices with 64-bit atomics, it also selects the single kernel
+   * _iamax and _iamin of float and half vectors (see PackedIndexMaxMin).
+   * Enabled by default when the device supports acquire-release atomics of
+   * device scope.
+   */
+  inline bool is_single_pass_reduction() const { return singlePassReduction_; }
+
+  /*!
+   * @brief Enables or disables the single pass reductions. They cannot be
+   * enabled if the device lacks the atomics they need.
+   */
+  inline void set_single_pass_reduction(bool enable) {
+    singlePassReduction_ = enable && deviceCaps_->has_device_atomics;
+  }
+
+  /*!
+   * @brief Whether the reductions (_dot, _sdsdot, _asum, _nrm2 and _axpy_dot)
+   * are bitwise reproducible: they then combine the partial results of the
+   * work groups in a fixed order with execute(AssignReduction), instead of
+   * the atomic additions of WGAtomicReduction whose order changes from run to
+   * run. The results only depend on the device, the size of the vectors and
+   * is_single_pass_reduction(). Disabled by default.
+   */
+  inline bool is_reproducible() const { return reproducible_; }
+
+  inline void set_reproducible(bool enable) { reproducible_ = enable; }
+
+  /*!
+   * @brief Starts recording the kernels submitted by this handle into
+   * @p plan, see Execution_Plan.
+   */
+  inline void begin_capture(Execution_Plan& plan) {
+    plan.begin_capture(q_);
+    plan_ = &plan;
+  }
+
+  /*!
+   * @brief Stops recording. The plan can then be replayed.
+   */
+  inline void end_capture() {
+    if (plan_ != nullptr) {
+      plan_->end_capture();
+      plan_ = nullptr;
+    }
+  }
+
+  inline bool is_capturing() const { return plan_ != nullptr; }
+
+  /*!
+   * @brief Records the kernels submitted by this handle into @p trace, see
+   * Kernel_Trace. Passing nullptr disables the tracing.
+   */
+  inline void set_trace(Kernel_Trace* trace) { trace_ = trace; }
+
+  inline Kernel_Trace* get_trace() const { return trace_; }
 
-  inline void wait(std::vector<sycl::event> evs) { sycl::event::wait(evs); }
+  /*! trace_scope_t.
+   * @brief Labels the kernels traced while it is alive with the name of the
+   * BLAS call submitting them. Nested scopes keep the outermost label.
+   */
+  class trace_scope_t {
+   public:
+    trace_scope_t(SB_Handle* sb_handle, const char* call)
+        : sb_handle_(sb_handle != nullptr && sb_handle->traceCall_ == nullptr
+                         ? sb_handle
+                         : nullptr) {
+      if (sb_handle_ != nullptr) {
+        sb_handle_->traceCall_ = call;
+      }
+    }
+    trace_scope_t(const trace_scope_t&) = delete;
+    trace_scope_t& operator=(const trace_scope_t&) = delete;
+    ~trace_scope_t() {
+      if (sb_handle_ != nullptr) {
+        sb_handle_->traceCall_ = nullptr;
+      }
+    }
 
-  inline void wait(sycl::event ev) { sycl::event::wait({ev}); }
+   private:
+    SB_Handle* sb_handle_;
+  };
+
+  /*!
+   * @brief Opens a trace_scope_t for the BLAS call @p call. Does nothing
+   * when tracing is disabled.
+   */
+  inline trace_scope_t trace_call(const char* call) {
+    return trace_scope_t(trace_ != nullptr ? this : nullptr, call);
+  }
+
+  /*! workspace_scope_t.
+   * @brief Makes the operations submitted while it is alive take their
+   * temporary memory from a Workspace, see the overloads of the operations
+   * taking one. The previous workspace, if any, is restored when it ends.
+   */
+  class workspace_scope_t {
+   public:
+    workspace_scope_t(SB_Handle* sb_handle, Workspace& workspace)
+        : sb_handle_(sb_handle), previous_(sb_handle->workspace_) {
+      if (previous_ != &workspace) {
+        workspace.reset();
+      }
+      sb_handle_->workspace_ = &workspace;
+    }
+    workspace_scope_t(const workspace_scope_t&) = delete;
+    workspace_scope_t& operator=(const workspace_scope_t&) = delete;
+    ~workspace_scope_t() { sb_handle_->workspace_ = previous_; }
+
+   private:
+    SB_Handle* sb_handle_;
+    Workspace* previous_;
+  };
+
+  /*!
+   * @brief Opens a workspace_scope_t for @p workspace. With a query
+   * workspace, the kernels are not submitted and the workspace counts the
+   * temporary memory they would use.
+   */
+  inline workspace_scope_t use_workspace(Workspace& workspace) {
+    return workspace_scope_t(this, workspace);
+  }
+
+  /*!
+   * @brief Whether the handle is running a workspace size query, in which
+   * case the operations must not submit any command.
+   */
+  inline bool is_workspace_query() const {
+    return workspace_ != nullptr && workspace_->is_query();
+  }
+
+  /*!
+   * @brief Resolves the kernels that the operations @p ops select on this
+   * handle and builds them into @p kernels, see Kernel_Warmup.
+   *
+   * The operations run as a workspace size query: nothing is allocated or
+   * submitted, so their containers may be placeholders (e.g. null USM
+   * pointers) as long as their types, sizes and options are the ones of the
+   * calls to warm up.
+   */
+  inline void warmup(Kernel_Warmup& kernels,
+                     const std::vector<Warmup_Op>& ops) {
+    Workspace query;
+    {
+      auto workspace_scope = use_workspace(query);
+      Kernel_Warmup* previous = warmup_;
+      warmup_ = &kernels;
+      try {
+        for (const auto& op : ops) {
+          op(*this);
+        }
+      } catch (...) {
+        warmup_ = previous;
+        throw;
+      }
+      warmup_ = previous;
+    }
+    kernels.build(q_);
+  }
+
+  inline void wait() {
+    q_.wait();
+#ifdef SB_ENABLE_USM
+    pendingFrees_->poll([this](void* mem) { sycl::free(mem, q_); });
+#endif
+  }
+
+  inline void wait(const event_t& evs) {
+    for (auto ev : evs) {
+      ev.wait();
+    }
+  }
+
+  inline void wait(sycl::event ev) { ev.wait(); }
 
   /*  @brief waiting for a list of sycl events
  @param first_event  and next_events are instances of sycl::event
@@ -190,13 +472,96 @@ class SB_Handle {
   }
 
  private:
+  /*!
+   * @brief Submits a tree through execute_tree, recording it in the
+   * Execution_Plan being captured and in the Kernel_Trace if any.
+   */
+  template <int using_local_memory, typename expression_tree_t>
+  sycl::event submit_tree(expression_tree_t tree, size_t localSize,
+                          size_t globalSize, size_t shMem,
+                          const event_t& dependencies);
+
+  /*!
+   * @brief Dependencies to attach to a command group: none when the queue
+   * ordering already guarantees them, that is on the in-order fast path when
+   * they were all submitted by this handle.
+   */
+  inline const event_t& effective_dependencies(
+      const event_t& dependencies) const {
+    static const event_t no_dependencies{};
+    if (!inOrderFastPath_) {
+      return dependencies;
+    }
+    for (const auto& dep : dependencies) {
+      if (std::find(recentEvents_.begin(), recentEvents_.end(), dep) ==
+          recentEvents_.end()) {
+        return dependencies;
+      }
+    }
+    return no_dependencies;
+  }
+
+  /*!
+   * @brief Remembers an event submitted to q_ by this handle, so that the
+   * in-order fast path can drop the dependencies on it.
+   */
+  inline void record_submitted(const sycl::event& event) {
+    if (inOrderFastPath_) {
+      recentEvents_[recentEventsNext_] = event;
+      recentEventsNext_ = (recentEventsNext_ + 1) % recentEvents_.size();
+    }
+  }
+
+  /*!
+   * @brief Events to wait for once @p next, submitted after @p events, is
+   * complete: only @p next on the in-order fast path.
+   */
+  inline event_t chain_events(const event_t& events,
+                              const event_t& next) const {
+    return inOrderFastPath_ ? next : concatenate_vectors(events, next);
+  }
+
+#ifdef SB_ENABLE_USM
+  using pending_frees_t = Pending_Release_List<void*>;
+
+  /*!
+   * @brief List of the temporary USM allocations to free once their commands
+   * are complete, when there is no memory pool. Shared by the copies of the
+   * handle, the remaining allocations are freed with the last copy.
+   */
+  static inline std::shared_ptr<pending_frees_t> make_pending_frees(
+      const queue_t& q) {
+    sycl::context context = q.get_context();
+    return std::shared_ptr<pending_frees_t>(
+        new pending_frees_t(), [context](pending_frees_t* pending) {
+          pending->drain([&](void* mem) { sycl::free(mem, context); });
+          delete pending;
+        });
+  }
+#endif
+
   queue_t q_;
+  const Device_Capabilities* deviceCaps_;
   const size_t workGroupSize_;
   const bool localMemorySupport_;
   const size_t computeUnits_;
-#ifndef __ADAPTIVECPP__
   Temp_Mem_Pool* tempMemPool_;
+  bool inOrderFastPath_;
+  // Last events submitted to q_ by this handle, see effective_dependencies
+  std::array<sycl::event, 8> recentEvents_;
+  size_t recentEventsNext_;
+  bool singlePassReduction_;
+  bool reproducible_;
+  Execution_Plan* plan_;
+  Kernel_Trace* trace_;
+  const char* traceCall_;
+  Workspace* workspace_;
+  Kernel_Warmup* warmup_;
+  std::pair<size_t, size_t> reductionLaunch_;
+#ifdef SB_ENABLE_USM
+  std::shared_ptr<pending_frees_t> pendingFrees_;
 #endif
+  std::shared_ptr<Host_Slot_Pool> hostSlots_;
 };
 
 }  // namespace blas
@@ -0,0 +1,171 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename sb_handle_group.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_SB_HANDLE_GROUP_H
+#define PORTBLAS_SB_HANDLE_GROUP_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "sb_handle/portblas_handle.h"
+
+namespace blas {
+
+/*! SB_Handle_Group.
+ * @brief Owns one SB_Handle per queue, typically one per sub-device of a
+ * partitioned CPU device, and spreads the batched operations across them.
+ *
+ * The batched calls taking a SB_Handle_Group (_gemm_batched,
+ * _gemm_strided_batched, _axpy_batch, _dot_batch, _nrm2_batch, _asum_batch,
+ * _rotg_batch, _rot_batch, _rotm_batch, _omatcopy_batch, _imatcopy_batch and
+ * _omatadd_batch) split the batch into contiguous ranges of batch indices, one
+ * per queue, and return the events of all the parts. Every part waits for the
+ * dependencies given to the call.
+ *
+ * The memory must be usable from all the queues: buffers, or USM allocations
+ * made in the context of the group (see get_context). Parts writing to the
+ * same buffer are serialized by the SYCL runtime, so USM memory is needed for
+ * the parts to run concurrently.
+ */
+class SB_Handle_Group {
+ public:
+  using event_t = event_vector_t;
+
+  explicit SB_Handle_Group(const std::vector<sycl::queue>& queues) {
+    if (queues.empty()) {
+      throw std::runtime_error("SB_Handle_Group requires at least one queue");
+    }
+    handles_.reserve(queues.size());
+    for (const auto& q : queues) {
+      handles_.emplace_back(q);
+    }
+  }
+
+  /*!
+   * @brief Creates a group with one queue per sub-device of @p device
+   * partitioned by affinity domain (e.g. one per NUMA node). Falls back to a
+   * single queue on @p device if it cannot be partitioned.
+   */
+  static inline SB_Handle_Group create_by_affinity_domain(
+      const sycl::device& device,
+      sycl::info::partition_affinity_domain domain =
+          sycl::info::partition_affinity_domain::next_partitionable,
+      const sycl::property_list& properties = {}) {
+    std::vector<sycl::device> sub_devices;
+    try {
+      sub_devices = device.create_sub_devices<
+          sycl::info::partition_property::partition_by_affinity_domain>(domain);
+    } catch (sycl::exception&) {
+      // The device does not support this partitioning
+    }
+    return from_devices(sub_devices.empty() ? std::vector<sycl::device>{device}
+                                            : sub_devices,
+                        properties);
+  }
+
+  /*!
+   * @brief Creates a group with @p count queues on sub-devices of @p device
+   * sharing its compute units equally. Falls back to a single queue on
+   * @p device if it cannot be partitioned.
+   */
+  static inline SB_Handle_Group create_equally(
+      const sycl::device& device, size_t count,
+      const sycl::property_list& properties = {}) {
+    const size_t compute_units =
+        Device_Capabilities::get(device).compute_units;
+    std::vector<sycl::device> sub_devices;
+    if (count > 1 && count <= compute_units) {
+      try {
+        sub_devices = device.create_sub_devices<
+            sycl::info::partition_property::partition_equally>(compute_units /
+                                                               count);
+        sub_devices.resize(std::min(sub_devices.size(), count));
+      } catch (sycl::exception&) {
+        // The device does not support this partitioning
+      }
+    }
+    return from_devices(sub_devices.empty() ? std::vector<sycl::device>{device}
+                                            : sub_devices,
+                        properties);
+  }
+
+  inline size_t size() const { return handles_.size(); }
+
+  inline SB_Handle& operator[](size_t i) { return handles_[i]; }
+
+  inline sycl::context get_context() const {
+    return handles_.front().get_queue().get_context();
+  }
+
+  inline void wait() {
+    for (auto& sb_handle : handles_) {
+      sb_handle.wait();
+    }
+  }
+
+  inline void wait(const event_t& evs) { handles_.front().wait(evs); }
+
+  /*!
+   * @brief Splits [0, batch_size) into one contiguous range per handle and
+   * calls @p submit_part(sb_handle, first_batch, batch_count) for each
+   * non-empty range.
+   * @return The concatenated events of the parts.
+   */
+  template <typename index_t, typename submit_part_t>
+  inline event_t split_batch(index_t batch_size, submit_part_t submit_part) {
+    event_t events;
+    const index_t parts = static_cast<index_t>(handles_.size());
+    const index_t base = batch_size / parts;
+    const index_t remainder = batch_size % parts;
+    index_t first = 0;
+    for (index_t p = 0; p < parts; ++p) {
+      const index_t count = base + (p < remainder ? 1 : 0);
+      if (count == 0) break;
+      append_vector(events, submit_part(handles_[p], first, count));
+      first += count;
+    }
+    return events;
+  }
+
+ private:
+  static inline SB_Handle_Group from_devices(
+      const std::vector<sycl::device>& devices,
+      const sycl::property_list& properties) {
+    sycl::context context(devices);
+    std::vector<sycl::queue> queues;
+    queues.reserve(devices.size());
+    for (const auto& device : devices) {
+      queues.emplace_back(context, device, properties);
+    }
+    return SB_Handle_Group(queues);
+  }
+
+  std::vector<SB_Handle> handles_;
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_SB_HANDLE_GROUP_H
@@ -0,0 +1,239 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename scalar_future.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_SCALAR_FUTURE_H
+#define PORTBLAS_SCALAR_FUTURE_H
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "container/small_vector.h"
+#include "pending_release_list.h"
+
+namespace blas {
+
+/*! Host_Slot_Pool.
+ * @brief Pool of small host memory slots receiving the results of the
+ * asynchronous scalar-returning operations (_dot_async, _nrm2_async, ...).
+ *
+ * The slots are carved out of slabs of slots_per_slab slots, allocated with
+ * sycl::malloc_host when USM is enabled so that the device can copy the
+ * results to them directly, and with new otherwise. The slabs are only freed
+ * with the pool. A slot released while the copy of a result to it may still
+ * be running is kept pending until the events of the copy are complete.
+ */
+class Host_Slot_Pool {
+ public:
+  using event_t = event_vector_t;
+
+  // Size of a slot, large enough for any scalar result
+  static constexpr size_t slot_byte_size = 16;
+  static constexpr size_t slots_per_slab = 64;
+
+  explicit Host_Slot_Pool(sycl::queue q) : q_(q) {}
+  Host_Slot_Pool(const Host_Slot_Pool& h) = delete;
+  Host_Slot_Pool operator=(Host_Slot_Pool) = delete;
+
+  ~Host_Slot_Pool() {
+    pending_.drain([](void*) {});
+    for (auto slab : slabs_) {
+#ifdef SB_ENABLE_USM
+      sycl::free(slab, q_);
+#else
+      delete[] static_cast<int8_t*>(slab);
+#endif
+    }
+  }
+
+  /*!
+   * @brief Takes a free slot, allocating a new slab if there is none.
+   */
+  inline void* acquire() {
+    pending_.poll([this](void* slot) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_.push_back(slot);
+    });
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty()) {
+      allocate_slab();
+    }
+    void* slot = free_.back();
+    free_.pop_back();
+    return slot;
+  }
+
+  /*!
+   * @brief Hands @p slot back to the pool once @p events are complete.
+   */
+  inline void release(void* slot, const event_t& events) {
+    if (events.empty()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_.push_back(slot);
+    } else {
+      pending_.push(slot, events);
+    }
+  }
+
+  inline sycl::queue get_queue() const { return q_; }
+
+  // Number of slots allocated, free or in use
+  inline size_t allocated_slots() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return slabs_.size() * slots_per_slab;
+  }
+
+ private:
+  inline void allocate_slab() {
+    constexpr size_t slab_byte_size = slot_byte_size * slots_per_slab;
+#ifdef SB_ENABLE_USM
+    void* slab = sycl::malloc_host(slab_byte_size, q_);
+    if (slab == nullptr) {
+      throw std::bad_alloc();
+    }
+#else
+    void* slab = new int8_t[slab_byte_size];
+#endif
+    slabs_.push_back(slab);
+    for (size_t i = slots_per_slab; i > 0; --i) {
+      free_.push_back(static_cast<int8_t*>(slab) + (i - 1) * slot_byte_size);
+    }
+  }
+
+  sycl::queue q_;
+  mutable std::mutex mutex_;
+  std::vector<void*> slabs_;
+  std::vector<void*> free_;
+  Pending_Release_List<void*> pending_;
+};
+
+/*! Scalar_Future.
+ * @brief Result of an asynchronous scalar-returning operation, returned
+ * before the operation is complete. Holds a slot of a Host_Slot_Pool, which
+ * the device writes the result to, and the events of this write.
+ *
+ * Only get and wait block the host. The slot goes back to the pool when the
+ * future is destroyed, without waiting for the operation: a future can be
+ * dropped, or depended on through get_event only.
+ *
+ * @tparam value_t Type of the result
+ */
+template <typename value_t>
+class Scalar_Future {
+  static_assert(sizeof(value_t) <= Host_Slot_Pool::slot_byte_size,
+                "The result does not fit in a host slot");
+  static_assert(std::is_trivially_copyable<value_t>::value,
+                "The result must be trivially copyable");
+
+ public:
+  using event_t = event_vector_t;
+
+  Scalar_Future() : slot_(nullptr) {}
+
+  Scalar_Future(std::shared_ptr<Host_Slot_Pool> pool, void* slot,
+                const event_t& events)
+      : pool_(std::move(pool)), slot_(slot), events_(events) {}
+
+  Scalar_Future(const Scalar_Future&) = delete;
+  Scalar_Future& operator=(const Scalar_Future&) = delete;
+
+  Scalar_Future(Scalar_Future&& other)
+      : pool_(std::move(other.pool_)),
+        slot_(other.slot_),
+        events_(std::move(other.events_)) {
+    other.slot_ = nullptr;
+  }
+
+  Scalar_Future& operator=(Scalar_Future&& other) {
+    if (this != &other) {
+      release();
+      pool_ = std::move(other.pool_);
+      slot_ = other.slot_;
+      events_ = std::move(other.events_);
+      other.slot_ = nullptr;
+    }
+    return *this;
+  }
+
+  ~Scalar_Future() { release(); }
+
+  inline bool valid() const { return slot_ != nullptr; }
+
+  /*!
+   * @brief Events of the write of the result, to make other commands depend
+   * on the operation without blocking the host.
+   */
+  inline const event_t& get_event() const { return events_; }
+
+  /*!
+   * @brief Whether the result is available, without blocking.
+   */
+  inline bool is_ready() const {
+    for (const auto& event : events_) {
+      if (event.get_info<sycl::info::event::command_execution_status>() !=
+          sycl::info::event_command_status::complete) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  inline void wait() {
+    for (auto& event : events_) {
+      event.wait_and_throw();
+    }
+    events_.clear();
+  }
+
+  /*!
+   * @brief Waits for the operation and returns its result. Can be called
+   * several times.
+   */
+  inline value_t get() {
+    wait();
+    value_t result;
+    std::memcpy(&result, slot_, sizeof(value_t));
+    return result;
+  }
+
+ private:
+  inline void release() {
+    if (slot_ != nullptr) {
+      pool_->release(slot_, events_);
+      slot_ = nullptr;
+    }
+  }
+
+  std::shared_ptr<Host_Slot_Pool> pool_;
+  void* slot_;
+  event_t events_;
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_SCALAR_FUTURE_H
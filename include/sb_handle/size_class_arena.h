@@ -0,0 +1,382 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename size_class_arena.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_SIZE_CLASS_ARENA_H
+#define PORTBLAS_SIZE_CLASS_ARENA_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+/*! Size_Class_Arena.
+ * @brief Free lists of memory blocks sorted in power-of-two size classes. It
+ * only stores the blocks, allocating and freeing them is left to the owner
+ * (see Temp_Mem_Pool).
+ *
+ * A request is only served by a block of its own class, so a block is less
+ * than twice as large as the request it serves. Each class has its own lock.
+ *
+ * The small classes (up to 64KB) also keep a few blocks in a cache per thread
+ * and per arena, so that a thread releasing and acquiring blocks of a small
+ * size does not take any lock. When a thread cache is full, half of it is
+ * handed over to the shared list of the class, and the whole cache is handed
+ * over when the thread exits. The small classes are never
+ * trimmed, while the large classes hold at most max_large_bytes, the blocks
+ * released beyond that being handed back to the owner to be freed. The large
+ * blocks can also be trimmed, least recently released first.
+ *
+ * @tparam block_t Type of the blocks, e.g. a pointer or a buffer.
+ */
+template <typename block_t>
+class Size_Class_Arena {
+ public:
+  using clock_t = std::chrono::steady_clock;
+  // log2 of the size in bytes of the smallest class
+  static constexpr size_t min_class_log2 = 8;
+  static constexpr size_t num_classes = 48;
+  // Classes up to 64KB are small
+  static constexpr size_t num_small_classes = 9;
+  // Maximum number of blocks of a small class in a thread cache
+  static constexpr size_t thread_cache_depth = 8;
+
+  explicit Size_Class_Arena(size_t max_large_bytes)
+      : id_(next_id()),
+        max_large_bytes_(max_large_bytes),
+        large_bytes_(0),
+        shared_bytes_(0),
+        thread_caches_(std::make_shared<thread_caches_t>(this)) {}
+  Size_Class_Arena(const Size_Class_Arena& h) = delete;
+  Size_Class_Arena operator=(Size_Class_Arena) = delete;
+
+  ~Size_Class_Arena() {
+    // The threads exiting from now on drop their cache instead of handing
+    // it over
+    std::lock_guard<std::mutex> lock(thread_caches_->mutex);
+    thread_caches_->arena = nullptr;
+  }
+
+  static constexpr size_t class_byte_size(size_t size_class) {
+    return size_t{1} << (size_class + min_class_log2);
+  }
+
+  /*!
+   * @brief Smallest class holding @p byte_size bytes.
+   */
+  static inline size_t size_class(size_t byte_size) {
+    size_t size_class = 0;
+    while (class_byte_size(size_class) < byte_size) {
+      if (++size_class == num_classes) {
+        throw std::bad_alloc();
+      }
+    }
+    return size_class;
+  }
+
+  static constexpr bool is_small(size_t size_class) {
+    return size_class < num_small_classes;
+  }
+
+  /*!
+   * @brief Takes a free block of the given class, if any.
+   */
+  inline std::optional<block_t> acquire(size_t size_class) {
+    const size_t byte_size = class_byte_size(size_class);
+    if (is_small(size_class)) {
+      auto& cache = thread_cache();
+      auto& cached = cache.lists[size_class];
+      if (!cached.empty()) {
+        std::optional<block_t> block(std::move(cached.back()));
+        cached.pop_back();
+        cache.byte_size.fetch_sub(byte_size, std::memory_order_relaxed);
+        return block;
+      }
+    }
+    auto& list = classes_[size_class];
+    std::lock_guard<std::mutex> lock(list.mutex);
+    if (list.blocks.empty()) {
+      return std::nullopt;
+    }
+    // Most recently released first
+    std::optional<block_t> block(std::move(list.blocks.back().block));
+    list.blocks.pop_back();
+    shared_bytes_ -= byte_size;
+    if (!is_small(size_class)) {
+      large_bytes_ -= byte_size;
+    }
+    return block;
+  }
+
+  /*!
+   * @brief Gives a block back to the arena.
+   * @return false if the block was not kept because of the limit on the large
+   * classes, in which case the caller frees it.
+   */
+  inline bool release(size_t size_class, block_t block) {
+    const size_t byte_size = class_byte_size(size_class);
+    if (is_small(size_class)) {
+      auto& cache = thread_cache();
+      auto& cached = cache.lists[size_class];
+      if (cached.size() == thread_cache_depth) {
+        auto half = cached.begin() + thread_cache_depth / 2;
+        const size_t moved_bytes = (cached.end() - half) * byte_size;
+        auto& list = classes_[size_class];
+        std::lock_guard<std::mutex> lock(list.mutex);
+        const auto now = clock_t::now();
+        for (auto it = half; it != cached.end(); ++it) {
+          list.blocks.push_back({std::move(*it), now});
+        }
+        cached.erase(half, cached.end());
+        cache.byte_size.fetch_sub(moved_bytes, std::memory_order_relaxed);
+        shared_bytes_ += moved_bytes;
+      }
+      cached.push_back(std::move(block));
+      cache.byte_size.fetch_add(byte_size, std::memory_order_relaxed);
+      return true;
+    }
+    if (large_bytes_.fetch_add(byte_size) + byte_size > max_large_bytes_) {
+      large_bytes_ -= byte_size;
+      return false;
+    }
+    auto& list = classes_[size_class];
+    std::lock_guard<std::mutex> lock(list.mutex);
+    list.blocks.push_back({std::move(block), clock_t::now()});
+    shared_bytes_ += byte_size;
+    return true;
+  }
+
+  /*!
+   * @brief Adds a new block of a small class to the shared list, e.g. a block
+   * carved out of a slab.
+   */
+  inline void add(size_t size_class, block_t block) {
+    auto& list = classes_[size_class];
+    std::lock_guard<std::mutex> lock(list.mutex);
+    list.blocks.push_back({std::move(block), clock_t::now()});
+    shared_bytes_ += class_byte_size(size_class);
+  }
+
+  /*!
+   * @brief Frees large blocks, least recently released first, until at least
+   * @p min_byte_size bytes are freed and no remaining large block was
+   * released before @p released_before.
+   * @param free_block Called with each block removed from the arena.
+   * @return The number of bytes freed.
+   */
+  template <typename free_block_t>
+  inline size_t trim(clock_t::time_point released_before,
+                     size_t min_byte_size, free_block_t free_block) {
+    size_t freed = 0;
+    while (true) {
+      // Class of the least recently released large block
+      size_t oldest_class = num_classes;
+      clock_t::time_point oldest = clock_t::time_point::max();
+      for (size_t c = num_small_classes; c < num_classes; ++c) {
+        auto& list = classes_[c];
+        std::lock_guard<std::mutex> lock(list.mutex);
+        if (!list.blocks.empty() && list.blocks.front().released < oldest) {
+          oldest = list.blocks.front().released;
+          oldest_class = c;
+        }
+      }
+      if (oldest_class == num_classes ||
+          (freed >= min_byte_size && oldest >= released_before)) {
+        return freed;
+      }
+      std::optional<block_t> block;
+      {
+        auto& list = classes_[oldest_class];
+        std::lock_guard<std::mutex> lock(list.mutex);
+        if (list.blocks.empty()) {
+          // Acquired meanwhile
+          continue;
+        }
+        block.emplace(std::move(list.blocks.front().block));
+        list.blocks.pop_front();
+        shared_bytes_ -= class_byte_size(oldest_class);
+        large_bytes_ -= class_byte_size(oldest_class);
+      }
+      free_block(std::move(*block));
+      freed += class_byte_size(oldest_class);
+    }
+  }
+
+  /*!
+   * @brief Bytes held in the shared lists and in the caches of all the
+   * threads.
+   */
+  inline size_t cached_byte_size() {
+    size_t byte_size = shared_bytes_;
+    std::lock_guard<std::mutex> lock(thread_caches_->mutex);
+    for (const auto& cache : thread_caches_->caches) {
+      byte_size += cache.second->byte_size.load(std::memory_order_relaxed);
+    }
+    return byte_size;
+  }
+
+ private:
+  struct entry_t {
+    block_t block;
+    clock_t::time_point released;
+  };
+
+  struct class_list_t {
+    std::mutex mutex;
+    // Ordered by release time
+    std::deque<entry_t> blocks;
+  };
+
+  struct thread_cache_t {
+    thread_cache_t() : byte_size(0) {
+      for (auto& cached : lists) {
+        cached.reserve(thread_cache_depth);
+      }
+    }
+    std::array<std::vector<block_t>, num_small_classes> lists;
+    // Only modified by the owning thread
+    std::atomic<size_t> byte_size;
+  };
+
+  // Caches of the threads using the arena, outliving it while a thread
+  // hands its cache over
+  struct thread_caches_t {
+    explicit thread_caches_t(Size_Class_Arena* owner) : arena(owner) {}
+    std::mutex mutex;
+    // Null once the arena is destroyed
+    Size_Class_Arena* arena;
+    std::unordered_map<std::thread::id, std::unique_ptr<thread_cache_t>>
+        caches;
+
+    // Hands the cache of the calling thread over to the arena, if any
+    inline void flush_thread() {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = caches.find(std::this_thread::get_id());
+      if (it == caches.end()) {
+        return;
+      }
+      if (arena != nullptr) {
+        arena->flush_cache(*it->second);
+      }
+      caches.erase(it);
+    }
+  };
+
+  // Caches of the calling thread, one per arena it used, handed over to
+  // their arena when the thread exits
+  struct thread_local_lookup_t {
+    struct entry_t {
+      uint64_t arena_id;
+      std::weak_ptr<thread_caches_t> thread_caches;
+      thread_cache_t* cache;
+    };
+    std::vector<entry_t> entries;
+
+    ~thread_local_lookup_t() {
+      for (auto& entry : entries) {
+        if (auto thread_caches = entry.thread_caches.lock()) {
+          thread_caches->flush_thread();
+        }
+      }
+    }
+  };
+
+  // Identifies the arena in the thread local lookup, never reused so that a
+  // new arena allocated at the address of a destroyed one is not confused
+  // with it.
+  static inline uint64_t next_id() {
+    static std::atomic<uint64_t> counter{0};
+    return ++counter;
+  }
+
+  inline thread_cache_t& thread_cache() {
+    // Found without locking once the thread has used the arena
+    static thread_local thread_local_lookup_t lookup;
+    for (const auto& entry : lookup.entries) {
+      if (entry.arena_id == id_) {
+        return *entry.cache;
+      }
+    }
+    // Forget the arenas destroyed since
+    lookup.entries.erase(
+        std::remove_if(lookup.entries.begin(), lookup.entries.end(),
+                       [](const auto& entry) {
+                         return entry.thread_caches.expired();
+                       }),
+        lookup.entries.end());
+    std::lock_guard<std::mutex> lock(thread_caches_->mutex);
+    auto& cache = thread_caches_->caches[std::this_thread::get_id()];
+    if (!cache) {
+      cache.reset(new thread_cache_t());
+    }
+    lookup.entries.push_back({id_, thread_caches_, cache.get()});
+    return *cache;
+  }
+
+  // Moves the blocks of a thread cache to the shared lists
+  inline void flush_cache(thread_cache_t& cache) {
+    const auto now = clock_t::now();
+    for (size_t c = 0; c < num_small_classes; ++c) {
+      auto& cached = cache.lists[c];
+      if (cached.empty()) {
+        continue;
+      }
+      const size_t moved_bytes = cached.size() * class_byte_size(c);
+      auto& list = classes_[c];
+      std::lock_guard<std::mutex> lock(list.mutex);
+      for (auto& block : cached) {
+        list.blocks.push_back({std::move(block), now});
+      }
+      cached.clear();
+      cache.byte_size.fetch_sub(moved_bytes, std::memory_order_relaxed);
+      shared_bytes_ += moved_bytes;
+    }
+  }
+
+  const uint64_t id_;
+  const size_t max_large_bytes_;
+  // Bytes held in the large classes
+  std::atomic<size_t> large_bytes_;
+  // Bytes held in the shared lists, small and large classes
+  std::atomic<size_t> shared_bytes_;
+  std::array<class_list_t, num_classes> classes_;
+  std::shared_ptr<thread_caches_t> thread_caches_;
+};
+
+}  // namespace blas
+
+#endif  // PORTBLAS_SIZE_CLASS_ARENA_H
@@ -25,95 +25,229 @@
 #ifndef TEMP_MEMORY_POOL_H
 #define TEMP_MEMORY_POOL_H
 
-#ifndef __ADAPTIVECPP__
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
+
+#include "container/small_vector.h"
+#include "pending_release_list.h"
+#include "size_class_arena.h"
 
 namespace blas {
+
+/*! Temp_Mem_Pool_Config.
+ * @brief Limits and trimming policy of a Temp_Mem_Pool.
+ */
+struct Temp_Mem_Pool_Config {
+  // Maximum bytes of free large blocks (above 64KB) kept by each of the USM
+  // and buffer paths. The blocks released beyond it are freed.
+  size_t max_cached_bytes = 1e9;
+  // Maximum bytes allocated by the pool, in use or free. An allocation that
+  // would exceed it first frees the least recently used free large blocks,
+  // and throws std::bad_alloc if that is not enough.
+  size_t max_allocated_bytes = std::numeric_limits<size_t>::max();
+  // Temp_Mem_Pool::trim frees the large blocks unused for longer than this
+  std::chrono::milliseconds trim_idle_time = std::chrono::seconds(1);
+};
+
+/*! Temp_Mem_Pool_Stats.
+ * @brief Statistics of a Temp_Mem_Pool since its creation, for both the USM
+ * and the buffer paths.
+ */
+struct Temp_Mem_Pool_Stats {
+  // Acquisitions served by a free block
+  size_t hits;
+  // Acquisitions that allocated memory
+  size_t misses;
+  // Bytes of the free blocks
+  size_t bytes_cached;
+  // Bytes allocated by the pool, in use or free
+  size_t bytes_allocated;
+  // Maximum of bytes_allocated
+  size_t high_water_mark;
+  // Bytes freed because of the limits or by trim
+  size_t bytes_trimmed;
+  // Average and maximum duration of an acquisition, in microseconds
+  double avg_acquire_us;
+  double max_acquire_us;
+};
+
+/*! Temp_Mem_Pool.
+ * @brief Pool of temporary memory for the scratch space of the operations,
+ * with a USM and a buffer path.
+ *
+ * The requests are rounded up to power-of-two size classes held by a
+ * Size_Class_Arena. The USM blocks of the small classes are carved out of
+ * slabs of slab_byte_size_ bytes, which are only freed with the pool. The
+ * larger USM blocks and all the buffers are allocated individually, as blocks
+ * carved from a shared buffer would make the SYCL runtime serialize the
+ * kernels using them.
+ *
+ * A block released with the events of the commands using it is kept pending
+ * until these events are complete. The pending blocks are polled, without
+ * blocking, on each acquire and on trim.
+ */
 class Temp_Mem_Pool {
   using queue_t = sycl::queue;
-  using event_t = std::vector<sycl::event>;
-  using temp_usm_map_t = std::multimap<size_t, void*>;
-  using temp_usm_size_map_t = std::map<void*, size_t>;
-  using temp_buffer_map_t = std::multimap<size_t, sycl::buffer<int8_t, 1>>;
+  using event_t = event_vector_t;
+  using clock_t = std::chrono::steady_clock;
+  using temp_buffer_t = sycl::buffer<int8_t, 1>;
+  using buffer_arena_t = Size_Class_Arena<temp_buffer_t>;
+#ifdef SB_ENABLE_USM
+  using usm_arena_t = Size_Class_Arena<void*>;
+  struct usm_allocation_t {
+    size_t byte_size;
+    size_t size_class;
+  };
+  // USM allocations (slabs and large blocks) sorted by address
+  using usm_allocation_map_t = std::map<const int8_t*, usm_allocation_t>;
+#endif
 
  public:
-  Temp_Mem_Pool(queue_t q)
+  Temp_Mem_Pool(queue_t q,
+                const Temp_Mem_Pool_Config& config = Temp_Mem_Pool_Config())
       : q_(q),
+        config_(config),
 #ifdef SB_ENABLE_USM
-        temp_usm_map_tot_byte_size_(0),
+        usm_arena_(config.max_cached_bytes),
 #endif
-        temp_buffer_map_tot_byte_size_(0) {
+        buffer_arena_(config.max_cached_bytes),
+        hits_(0),
+        misses_(0),
+        allocated_bytes_(0),
+        high_water_mark_(0),
+        trimmed_bytes_(0),
+        acquire_ns_(0),
+        max_acquire_ns_(0) {
   }
   Temp_Mem_Pool(const Temp_Mem_Pool& h) = delete;
   Temp_Mem_Pool operator=(Temp_Mem_Pool) = delete;
 
   ~Temp_Mem_Pool() {
-    // Wait for the completion of all the host tasks
+    // Wait for the completion of the commands using the pending blocks
     q_.wait();
 
 #ifdef VERBOSE
     std::cout << "# buffers destroyed on memory pool destruction: "
-              << temp_buffer_map_.size() << " ("
-              << temp_buffer_map_tot_byte_size_ << " bytes)" << std::endl;
+              << buffer_arena_.cached_byte_size() << " bytes" << std::endl;
 #endif
 
 #ifdef SB_ENABLE_USM
 #ifdef VERBOSE
+    size_t usm_tot_byte_size = 0;
+    for (const auto& p : usm_allocations_) {
+      usm_tot_byte_size += p.second.byte_size;
+    }
     std::cout << "# USM allocations freed on memory pool destruction: "
-              << temp_usm_map_.size() << " (" << temp_usm_map_tot_byte_size_
+              << usm_allocations_.size() << " (" << usm_tot_byte_size
               << " bytes)" << std::endl;
 #endif
-    for (const temp_usm_map_t::value_type& p : temp_usm_map_)
-      sycl::free(p.second, q_);
+    for (const auto& p : usm_allocations_)
+      sycl::free(const_cast<int8_t*>(p.first), q_);
 #endif
   }
 
   inline queue_t get_queue() const { return q_; }
 
+  inline const Temp_Mem_Pool_Config& get_config() const { return config_; }
+
+  inline Temp_Mem_Pool_Stats get_stats();
+
+  /*!
+   * @brief Gives the pending blocks whose commands are complete back to the
+   * pool, without waiting for the others, then frees the large blocks unused
+   * for longer than the trim_idle_time of the configuration.
+   * @return The number of bytes freed.
+   */
+  inline size_t trim();
+
   template <typename value_t>
   typename helper::AllocHelper<value_t, helper::AllocType::buffer>::type
   acquire_buff_mem(size_t size);
 
+  /*!
+   * @brief Releases a buffer once the commands of @p dependencies are
+   * complete. No command is submitted, the returned list is empty.
+   */
   template <typename container_t>
   typename Temp_Mem_Pool::event_t release_buff_mem(
       const typename Temp_Mem_Pool::event_t&, const container_t&);
 
+  /*!
+   * @brief Gives a buffer back to the pool immediately. No pending command
+   * may use it anymore.
+   */
+  template <typename container_t>
+  void reclaim_buff_mem(const container_t& mem) {
+    reclaim_buffer_(
+        mem.get_buffer().template reinterpret<temp_buffer_t::value_type>(
+            sycl::range<1>(mem.get_buffer().byte_size() /
+                           sizeof(temp_buffer_t::value_type))));
+  }
+
 #ifdef SB_ENABLE_USM
   template <typename value_t>
   typename helper::AllocHelper<value_t, helper::AllocType::usm>::type
   acquire_usm_mem(size_t size);
 
+  /*!
+   * @brief Releases a USM allocation once the commands of @p dependencies are
+   * complete. No command is submitted, the returned list is empty.
+   */
   template <typename container_t>
   typename Temp_Mem_Pool::event_t release_usm_mem(
       const typename Temp_Mem_Pool::event_t&, const container_t&);
+
+  /*!
+   * @brief Gives a USM allocation back to the pool immediately. No pending
+   * command may use it anymore.
+   */
+  template <typename container_t>
+  void reclaim_usm_mem(const container_t& mem);
 #endif
 
  private:
-  static_assert(sizeof(temp_buffer_map_t::mapped_type::value_type) == 1);
+  static_assert(sizeof(temp_buffer_t::value_type) == 1);
 
-  static constexpr size_t max_size_temp_mem_ = 1e9;
+  static constexpr size_t slab_byte_size_ = size_t{1} << 22;
   queue_t q_;
-
-  std::mutex temp_buffer_map_mutex_;
-  size_t temp_buffer_map_tot_byte_size_;
-  temp_buffer_map_t temp_buffer_map_;
-
-  template <typename container_t>
-  void release_buff_mem_(const container_t& mem);
+  const Temp_Mem_Pool_Config config_;
 
 #ifdef SB_ENABLE_USM
-  std::mutex temp_usm_map_mutex_;
-  size_t temp_usm_map_tot_byte_size_;
-  temp_usm_map_t temp_usm_map_;
-  temp_usm_size_map_t temp_usm_size_map_;
+  usm_arena_t usm_arena_;
+  Pending_Release_List<void*> pending_usm_;
+  std::shared_mutex usm_allocations_mutex_;
+  usm_allocation_map_t usm_allocations_;
 
-  template <typename container_t>
-  void release_usm_mem_(const container_t& mem);
+  inline void* allocate_usm_block_(size_t size_class);
+  inline void free_usm_block_(void* mem);
 #endif  // SB_ENABLE_USM
+
+  buffer_arena_t buffer_arena_;
+  Pending_Release_List<temp_buffer_t> pending_buffers_;
+
+  inline void reclaim_buffer_(temp_buffer_t buff);
+
+  // Accounts for a new allocation, within the max_allocated_bytes limit
+  inline void reserve_bytes_(size_t byte_size);
+  // Accounts for the end of an acquisition started at start
+  inline void record_acquire_(clock_t::time_point start, bool hit);
+  // Frees least recently used large blocks until at least byte_size bytes
+  // are freed or no free large block is left
+  inline size_t trim_lru_(clock_t::time_point released_before,
+                          size_t byte_size);
+
+  std::atomic<size_t> hits_;
+  std::atomic<size_t> misses_;
+  std::atomic<size_t> allocated_bytes_;
+  std::atomic<size_t> high_water_mark_;
+  std::atomic<size_t> trimmed_bytes_;
+  std::atomic<uint64_t> acquire_ns_;
+  std::atomic<uint64_t> max_acquire_ns_;
 };
 }  // namespace blas
 
-#endif  // __ADAPTIVECPP__
-
 #endif
@@ -0,0 +1,217 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename workspace.h
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_WORKSPACE_H
+#define PORTBLAS_WORKSPACE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <sycl/sycl.hpp>
+
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include "portblas_helper.h"
+
+namespace blas {
+
+/*! Workspace.
+ * @brief Caller-owned device memory holding the temporary memory of an
+ * operation, instead of the allocations of the SB_Handle or its
+ * Temp_Mem_Pool. The operations needing temporary memory have an overload
+ * taking a Workspace, and a _xxx_workspace_size query returning the number of
+ * bytes it must hold for given arguments.
+ *
+ * The temporary containers of a call are carved out of the workspace one after
+ * the other and are not reused within the call, so that the kernels of the
+ * call need no extra dependency. A call starts again at the beginning of the
+ * workspace: the caller makes the next call using the same workspace depend on
+ * the events of the previous one, as for any memory it owns.
+ *
+ * A USM workspace serves the operations on USM pointers, a buffer workspace
+ * the operations on buffers.
+ */
+class Workspace {
+ public:
+  // Alignment of the containers carved out of the workspace, in bytes
+  static constexpr size_t alignment = 256;
+
+  /*!
+   * @brief Workspace of a size query: nothing is allocated or submitted, the
+   * workspace only counts the bytes requested.
+   */
+  Workspace()
+      : is_query_(true),
+        byte_size_(0),
+        usm_(nullptr),
+        buffer_(sycl::range<1>(1)),
+        offset_(0),
+        required_byte_size_(0) {}
+
+#ifdef SB_ENABLE_USM
+  /*!
+   * @brief Workspace in the USM device allocation @p mem of @p byte_size
+   * bytes, aligned to at least Workspace::alignment bytes.
+   */
+  Workspace(void* mem, size_t byte_size)
+      : is_query_(false),
+        byte_size_(byte_size),
+        usm_(static_cast<int8_t*>(mem)),
+        buffer_(sycl::range<1>(1)),
+        offset_(0),
+        required_byte_size_(0) {}
+#endif
+
+  /*!
+   * @brief Workspace in the buffer @p buffer.
+   */
+  explicit Workspace(sycl::buffer<int8_t, 1> buffer)
+      : is_query_(false),
+        byte_size_(buffer.byte_size()),
+        usm_(nullptr),
+        buffer_(buffer),
+        offset_(0),
+        required_byte_size_(0) {}
+
+  inline bool is_query() const { return is_query_; }
+
+  inline size_t byte_size() const { return byte_size_; }
+
+  /*!
+   * @brief Largest number of bytes used by a call since the creation of the
+   * workspace, a multiple of Workspace::alignment.
+   */
+  inline size_t required_byte_size() const { return required_byte_size_; }
+
+  /*!
+   * @brief Makes the whole workspace available again. Called by the SB_Handle
+   * at the beginning of each operation.
+   */
+  inline void reset() { offset_ = 0; }
+
+  template <helper::AllocType alloc, typename value_t>
+  typename std::enable_if<
+      alloc == helper::AllocType::buffer,
+      typename helper::AllocHelper<value_t, alloc>::type>::type
+  acquire(size_t size) {
+    const size_t offset = carve<value_t>(size);
+    if (is_query_) {
+      // Never accessed, the kernels are not submitted
+      return {};
+    }
+    if (usm_ != nullptr) {
+      throw std::invalid_argument(
+          "Operations on buffers require a buffer workspace");
+    }
+    if (byte_size_ % sizeof(value_t) != 0) {
+      throw std::invalid_argument(
+          "The workspace size is not a multiple of the element size");
+    }
+    return blas::BufferIterator<value_t>{
+        buffer_.template reinterpret<value_t>(
+            sycl::range<1>(byte_size_ / sizeof(value_t))),
+        static_cast<std::ptrdiff_t>(offset / sizeof(value_t))};
+  }
+
+#ifdef SB_ENABLE_USM
+  template <helper::AllocType alloc, typename value_t>
+  typename std::enable_if<
+      alloc == helper::AllocType::usm,
+      typename helper::AllocHelper<value_t, alloc>::type>::type
+  acquire(size_t size) {
+    const size_t offset = carve<value_t>(size);
+    if (is_query_) {
+      return nullptr;
+    }
+    if (usm_ == nullptr) {
+      throw std::invalid_argument(
+          "Operations on USM pointers require a USM workspace");
+    }
+    return reinterpret_cast<value_t*>(usm_ + offset);
+  }
+#endif
+
+ private:
+  /*!
+   * @brief Reserves @p size elements after the containers already carved.
+   * @return Their offset in bytes.
+   */
+  template <typename value_t>
+  inline size_t carve(size_t size) {
+    const size_t offset =
+        roundUp<size_t>(roundUp<size_t>(offset_, alignment), sizeof(value_t));
+    const size_t end = offset + size * sizeof(value_t);
+    if (!is_query_ && end > byte_size_) {
+      throw std::bad_alloc();
+    }
+    offset_ = end;
+    required_byte_size_ =
+        std::max(required_byte_size_, roundUp<size_t>(end, alignment));
+    return offset;
+  }
+
+  const bool is_query_;
+  const size_t byte_size_;
+  int8_t* const usm_;
+  sycl::buffer<int8_t, 1> buffer_;
+  size_t offset_;
+  size_t required_byte_size_;
+};
+
+namespace internal {
+
+/*!
+ * @brief Runs @p operation, a call of an operation on @p sb_handle, with a
+ * query workspace.
+ * @return The number of bytes of Workspace the operation requires.
+ */
+template <typename sb_handle_t, typename operation_t>
+inline size_t workspace_size(sb_handle_t& sb_handle, operation_t operation) {
+  Workspace query;
+  {
+    auto workspace_scope = sb_handle.use_workspace(query);
+    operation();
+  }
+  return query.required_byte_size();
+}
+
+/*!
+ * @brief Runs @p operation, a call of an operation on @p sb_handle, taking
+ * its temporary memory from @p workspace.
+ */
+template <typename sb_handle_t, typename operation_t>
+inline typename sb_handle_t::event_t with_workspace(sb_handle_t& sb_handle,
+                                                    Workspace& workspace,
+                                                    operation_t operation) {
+  auto workspace_scope = sb_handle.use_workspace(workspace);
+  return operation();
+}
+
+}  // namespace internal
+
+}  // namespace blas
+
+#endif  // PORTBLAS_WORKSPACE_H
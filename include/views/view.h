@@ -27,7 +27,9 @@
 #define PORTBLAS_VIEW_H
 
 #include "blas_meta.h"
+#include <cstdint>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace blas {
@@ -130,6 +132,100 @@ struct VectorView {
   }
 };
 
+/*! VectorPacketSize
+@brief Number of elements of value_t packed in a sycl::vec by the contiguous
+BLAS1 trees, 16 bytes worth of elements. Types that cannot be packed in a
+sycl::vec (e.g. complex) have a packet size of 1 and are never packed.
+*/
+template <typename value_t>
+struct VectorPacketSize {
+  static constexpr int value = 1;
+};
+
+template <>
+struct VectorPacketSize<float> {
+  static constexpr int value = 4;
+};
+
+template <>
+struct VectorPacketSize<double> {
+  static constexpr int value = 2;
+};
+
+template <>
+struct VectorPacketSize<sycl::half> {
+  static constexpr int value = 8;
+};
+
+/*! VectorPacketView
+@brief Contiguous view over a unit stride VectorView, where the element i is
+the sycl::vec packet of the elements [i * packet_size, (i + 1) * packet_size)
+of the vector. The trees built on top of it evaluate a whole packet per
+work item, the remaining size % packet_size elements being left to a scalar
+tree (see make_vector_packet_view).
+The packets are read and written with sycl::vec::load and store, which only
+require the alignment of the elements, so the view is correct whatever the
+alignment of the memory behind a buffer. It is only faster when the data is
+aligned to the size of a packet (see is_packet_aligned).
+The Assign nodes write to it with store, as eval returns a copy of a packet.
+@tparam vector_view_t Type of the unit stride VectorView.
+@tparam packet_size Number of elements in a packet.
+*/
+template <typename vector_view_t, int packet_size>
+struct VectorPacketView {
+  using scalar_t = typename std::remove_const<
+      typename vector_view_t::value_t>::type;
+  using value_t = sycl::vec<scalar_t, packet_size>;
+  using index_t = typename vector_view_t::index_t;
+  using container_t = typename vector_view_t::container_t;
+  using self_t = VectorPacketView<vector_view_t, packet_size>;
+  using address_t = sycl::access::address_space;
+
+  vector_view_t view_;
+  // Number of packets
+  index_t size_;
+
+  VectorPacketView(vector_view_t view, index_t size)
+      : view_(view), size_(size) {}
+
+  PORTBLAS_INLINE index_t get_size() const { return size_; }
+
+  PORTBLAS_INLINE void bind(sycl::handler &h) { view_.bind(h); }
+
+  PORTBLAS_INLINE void adjust_access_displacement() {
+    view_.adjust_access_displacement();
+  }
+
+  /**** EVALUATING ****/
+  PORTBLAS_INLINE value_t eval(index_t i) const {
+    value_t packet;
+    packet.template load<address_t::global_space>(
+        i, sycl::multi_ptr<const scalar_t, address_t::global_space>(
+               view_.get_pointer()));
+    return packet;
+  }
+
+  PORTBLAS_INLINE value_t eval(sycl::nd_item<1> ndItem) const {
+    return eval(ndItem.get_global_id(0));
+  }
+
+  /*!
+   * @brief Writes @p packet as the element i of the view.
+   */
+  PORTBLAS_INLINE void store(index_t i, const value_t &packet) {
+    packet.template store<address_t::global_space>(
+        i, sycl::multi_ptr<scalar_t, address_t::global_space>(
+               view_.get_pointer()));
+  }
+};
+
+template <typename view_t>
+struct is_vector_packet_view : std::false_type {};
+
+template <typename vector_view_t, int packet_size>
+struct is_vector_packet_view<VectorPacketView<vector_view_t, packet_size>>
+    : std::true_type {};
+
 /*! MatrixView
 @brief Represents a Matrix on the given Container.
 @tparam value_t Value type of the container.
@@ -379,6 +475,89 @@ static PORTBLAS_INLINE auto make_vector_view(const value_t *usm_ptr,
   return leaf_node_t{usm_ptr, inc, sz};
 }
 
+/*!
+ * @brief Makes the VectorPacketView of the first size * packet_size elements of
+ * the unit stride view @p view.
+ */
+template <int packet_size, typename vector_view_t, typename index_t>
+static PORTBLAS_INLINE auto make_vector_packet_view(vector_view_t view,
+                                                     index_t size) {
+  return VectorPacketView<vector_view_t, packet_size>{view, size};
+}
+
+/*!
+ * @brief Whether the first element of @p buff is aligned to a packet of
+ * packet_size elements, assuming the buffer allocation itself is. The actual
+ * alignment of a buffer is only known by the kernels, hence VectorPacketView
+ * does not rely on it.
+ */
+template <int packet_size, typename value_t>
+static PORTBLAS_INLINE bool is_packet_aligned(BufferIterator<value_t> buff) {
+  return buff.get_offset() % packet_size == 0;
+}
+
+/*!
+ * @brief Whether @p usm_ptr is aligned to a packet of packet_size elements.
+ */
+template <int packet_size, typename value_t>
+static PORTBLAS_INLINE bool is_packet_aligned(value_t *usm_ptr) {
+  return reinterpret_cast<std::uintptr_t>(usm_ptr) %
+             (packet_size * sizeof(value_t)) ==
+         0;
+}
+
+/*! is_device_scalar.
+ * @brief Whether a scalar argument (alpha, beta, ...) of an operation is a
+ * BufferIterator or a USM pointer to a scalar in device memory, read by the
+ * kernels, rather than a host value.
+ */
+template <typename scalar_t>
+struct is_device_scalar : std::is_pointer<scalar_t> {};
+
+template <typename value_t>
+struct is_device_scalar<BufferIterator<value_t>> : std::true_type {};
+
+/*!
+ * @brief Makes the scalar operand of a ScalarOp node for the scalar argument
+ * @p scalar: the value itself for a host scalar, or a one element view that
+ * the kernel reads it from for a device scalar.
+ */
+template <typename index_t, typename scalar_t>
+static PORTBLAS_INLINE auto make_scalar_operand(scalar_t scalar) {
+  if constexpr (is_device_scalar<scalar_t>::value) {
+    return make_vector_view(scalar, index_t{1}, index_t{1});
+  } else {
+    return scalar;
+  }
+}
+
+/*!
+ * @brief Whether the scalar argument @p scalar is known on the host to be
+ * zero. Always false for a device scalar, whose value is only read by the
+ * kernels.
+ */
+template <typename scalar_t>
+static PORTBLAS_INLINE bool is_host_zero(scalar_t scalar) {
+  if constexpr (is_device_scalar<scalar_t>::value) {
+    return false;
+  } else {
+    return scalar == scalar_t{0};
+  }
+}
+
+struct ProductOperator;
+struct StrongZeroProductOperator;
+
+/*!
+ * @brief Operator of the ScalarOp nodes multiplying by a scalar argument of
+ * type scalar_t. A device scalar that is zero must give zero even for a NaN
+ * operand, which the kernels check as the host does not know its value.
+ */
+template <typename scalar_t>
+using scalar_product_operator_t =
+    typename std::conditional<is_device_scalar<scalar_t>::value,
+                              StrongZeroProductOperator,
+                              ProductOperator>::type;
 
 template <typename access_layout_t, typename value_t, typename index_t,
           bool has_inc = false>
@@ -34,10 +34,12 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _asum(
     sb_handle_t& sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const typename sb_handle_t::event_t& _dependencies) {
-  constexpr int localSize = 8;
-  constexpr index_t number_WG = 16;
-  return blas::internal::_asum_impl<localSize, 0>(
-      sb_handle, _N, _vx, _incx, _rs, number_WG, _dependencies);
+  const auto launch = blas::internal::plan_reduction_launch(sb_handle, _N);
+  return blas::internal::dispatch_reduction_local_size(
+      launch.local_size, [&](auto local_size) {
+        return blas::internal::_asum_impl<decltype(local_size)::value, 0>(
+            sb_handle, _N, _vx, _incx, _rs, launch.number_WG, _dependencies);
+      });
 }
 }  // namespace backend
 }  // namespace asum
@@ -122,10 +124,12 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _nrm2(
     sb_handle_t& sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const typename sb_handle_t::event_t& _dependencies) {
-  constexpr int localSize = 8;
-  constexpr index_t number_WG = 16;
-  return blas::internal::_nrm2_impl<localSize, 0>(
-      sb_handle, _N, _vx, _incx, _rs, number_WG, _dependencies);
+  const auto launch = blas::internal::plan_reduction_launch(sb_handle, _N);
+  return blas::internal::dispatch_reduction_local_size(
+      launch.local_size, [&](auto local_size) {
+        return blas::internal::_nrm2_impl<decltype(local_size)::value, 0>(
+            sb_handle, _N, _vx, _incx, _rs, launch.number_WG, _dependencies);
+      });
 }
 }  // namespace backend
 }  // namespace nrm2
@@ -138,10 +142,13 @@ typename sb_handle_t::event_t _dot(
     sb_handle_t& sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs,
     const typename sb_handle_t::event_t& _dependencies) {
-  constexpr int localSize = 8;
-  constexpr index_t number_WG = 16;
-  return blas::internal::_dot_impl<localSize, 0>(
-      sb_handle, _N, _vx, _incx, _vy, _incy, _rs, number_WG, _dependencies);
+  const auto launch = blas::internal::plan_reduction_launch(sb_handle, _N);
+  return blas::internal::dispatch_reduction_local_size(
+      launch.local_size, [&](auto local_size) {
+        return blas::internal::_dot_impl<decltype(local_size)::value, 0>(
+            sb_handle, _N, _vx, _incx, _vy, _incy, _rs, launch.number_WG,
+            _dependencies);
+      });
 }
 }  // namespace backend
 }  // namespace dot
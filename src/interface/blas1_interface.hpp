@@ -27,7 +27,11 @@
 #define PORTBLAS_BLAS1_INTERFACE_HPP
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include "blas_meta.h"
@@ -42,6 +46,98 @@
 
 namespace blas {
 namespace internal {
+/**
+ * \brief Executes an elementwise tree over vectors of stride 1.
+ *
+ * When the vectors hold the same type, which can be packed in a sycl::vec, and
+ * are aligned to the size of a packet, the tree is built over
+ * VectorPacketView, so that each work item loads and stores a packet of
+ * VectorPacketSize elements. The remaining _N % packet_size elements are
+ * evaluated by the same tree over scalar views, fused in the same kernel.
+ * Otherwise the tree is built over scalar views of stride 1.
+ *
+ * @tparam increment_t Increment type of the views
+ * @param _N Number of elements of the vectors
+ * @param build_tree Called with a view of each vector, as lvalues, returns the
+ * tree to execute. It is called for both the packet and the scalar views.
+ * @param _vs BufferIterators or USM pointers of the vectors
+ */
+template <typename increment_t, typename sb_handle_t, typename index_t,
+          typename tree_builder_t, typename... container_t>
+typename sb_handle_t::event_t _execute_unit_stride(
+    sb_handle_t &sb_handle, index_t _N, tree_builder_t build_tree,
+    const typename sb_handle_t::event_t &_dependencies, container_t... _vs) {
+  using first_value_t = typename ValueType<
+      typename std::tuple_element<0, std::tuple<container_t...>>::type>::type;
+  constexpr int packet_size = VectorPacketSize<first_value_t>::value;
+  constexpr bool same_value_t =
+      (std::is_same<first_value_t,
+                    typename ValueType<container_t>::type>::value &&
+       ...);
+  const increment_t one = static_cast<increment_t>(1);
+  if constexpr (packet_size > 1 && same_value_t) {
+    if ((is_packet_aligned<packet_size>(_vs) && ...)) {
+      const index_t num_packets = _N / packet_size;
+      const index_t tail_offset = num_packets * packet_size;
+      std::tuple<decltype(make_vector_packet_view<packet_size>(
+          make_vector_view(_vs, one, tail_offset), num_packets))...>
+          packet_views(make_vector_packet_view<packet_size>(
+              make_vector_view(_vs, one, tail_offset), num_packets)...);
+      std::tuple<typename VectorViewType<container_t, index_t,
+                                         increment_t>::type...>
+          tail_views(
+              make_vector_view(_vs + tail_offset, one, _N - tail_offset)...);
+      auto packetOp = std::apply(build_tree, packet_views);
+      auto tailOp = std::apply(build_tree, tail_views);
+      auto fusedOp = make_op<FusedOp>(packetOp, tailOp);
+      return sb_handle.execute(fusedOp, _dependencies);
+    }
+  }
+  std::tuple<
+      typename VectorViewType<container_t, index_t, increment_t>::type...>
+      views(make_vector_view(_vs, one, _N)...);
+  auto op = std::apply(build_tree, views);
+  return sb_handle.execute(op, _dependencies);
+}
+
+/**
+ * \brief Runs a reduction into the single element _rs through a temporary
+ * element of the accumulator type of _rs (see AccumulatorType), so that the
+ * reductions over half or bfloat16 vectors accumulate in float while their
+ * loads stay 16-bit. The temporary is initialized with the value of _rs and
+ * converted back into _rs once the reduction is done.
+ *
+ * @param _rs BufferIterator or USM pointer of the result
+ * @param reduce Called with the temporary container and the events to depend
+ * on, runs the reduction into it and returns its events.
+ */
+template <typename index_t, typename increment_t, typename sb_handle_t,
+          typename container_t, typename reduce_t>
+typename sb_handle_t::event_t _reduce_with_accumulator(
+    sb_handle_t &sb_handle, container_t _rs, reduce_t reduce,
+    const typename sb_handle_t::event_t &_dependencies) {
+  using element_t = typename ValueType<container_t>::type;
+  using acc_t = typename AccumulatorType<element_t>::type;
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  auto acc = sb_handle.template acquire_temp_mem < is_usm
+                 ? helper::AllocType::usm
+                 : helper::AllocType::buffer,
+       acc_t > (1);
+  auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
+                             static_cast<index_t>(1));
+  auto vacc = make_vector_view(acc, static_cast<increment_t>(1),
+                               static_cast<index_t>(1));
+  auto loadOp = make_op<UnaryOp, CastOperator<acc_t>>(rs);
+  auto assignLoad = make_op<Assign>(vacc, loadOp);
+  auto ret0 = sb_handle.execute(assignLoad, _dependencies);
+  auto ret1 = reduce(acc, ret0);
+  auto storeOp = make_op<UnaryOp, CastOperator<element_t>>(vacc);
+  auto assignStore = make_op<Assign>(rs, storeOp);
+  auto ret2 = sb_handle.execute(assignStore, ret1);
+  sb_handle.release_temp_mem(ret2, acc);
+  return blas::concatenate_vectors(ret1, ret2);
+}
+
 /**
  * \brief AXPY constant times a vector plus a vector.
  *
@@ -60,13 +156,21 @@ typename sb_handle_t::event_t _axpy(
     sb_handle_t &sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies) {
+  auto alpha = make_scalar_operand<index_t>(_alpha);
+  auto axpy_tree = [&](auto &vx, auto &vy) {
+    auto scalOp =
+        make_op<ScalarOp, scalar_product_operator_t<element_t>>(alpha, vx);
+    auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+    return make_op<Assign>(vy, addOp);
+  };
+  if (_incx == increment_t(1) && _incy == increment_t(1)) {
+    return _execute_unit_stride<increment_t>(sb_handle, _N, axpy_tree,
+                                             _dependencies, _vx, _vy);
+  }
   typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
       make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
-
-  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
-  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
-  auto assignOp = make_op<Assign>(vy, addOp);
+  auto assignOp = axpy_tree(vx, vy);
   auto ret = sb_handle.execute(assignOp, _dependencies);
   return ret;
 }
@@ -87,10 +191,15 @@ typename sb_handle_t::event_t _copy(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies) {
+  auto copy_tree = [](auto &vx, auto &vy) { return make_op<Assign>(vy, vx); };
+  if (_incx == increment_t(1) && _incy == increment_t(1)) {
+    return _execute_unit_stride<increment_t>(sb_handle, _N, copy_tree,
+                                             _dependencies, _vx, _vy);
+  }
   typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
       make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
-  auto assignOp2 = make_op<Assign>(vy, vx);
+  auto assignOp2 = copy_tree(vx, vy);
   auto ret = sb_handle.execute(assignOp2, _dependencies);
   return ret;
 }
@@ -120,8 +229,31 @@ typename sb_handle_t::event_t _dot(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs,
     const typename sb_handle_t::event_t &_dependencies) {
-  return blas::dot::backend::_dot(sb_handle, _N, _vx, _incx, _vy, _incy, _rs,
-                                  _dependencies);
+  using element_t = typename ValueType<container_2_t>::type;
+  if constexpr (!std::is_same<typename AccumulatorType<element_t>::type,
+                              element_t>::value) {
+    return _reduce_with_accumulator<index_t, increment_t>(
+        sb_handle, _rs,
+        [&](auto acc, const typename sb_handle_t::event_t &deps) {
+          return blas::internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy,
+                                      acc, deps);
+        },
+        _dependencies);
+  } else {
+    if (sb_handle.is_reproducible() && _N > 0) {
+      auto vx = make_vector_view(_vx, _incx, _N);
+      auto vy = make_vector_view(_vy, _incy, _N);
+      auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
+                                 static_cast<index_t>(1));
+      auto cx = make_cast_op<element_t>(vx);
+      auto cy = make_cast_op<element_t>(vy);
+      auto prdOp = make_op<BinaryOpConst, ProductOperator>(cx, cy);
+      return _reproducible_reduction<AddOperator>(sb_handle, _N, rs, prdOp,
+                                                  _dependencies);
+    }
+    return blas::dot::backend::_dot(sb_handle, _N, _vx, _incx, _vy, _incy,
+                                    _rs, _dependencies);
+  }
 }
 
 /**
@@ -154,16 +286,12 @@ typename sb_handle_t::event_t _sdsdot(
 #ifndef __ADAPTIVECPP__
   if (!_N) {
     using element_t = typename ValueType<container_2_t>::type;
-    sb_handle.wait(_dependencies);
-    auto ret = blas::helper::copy_to_device(
-        sb_handle.get_queue(), reinterpret_cast<element_t *>(&sb), _rs, 1);
-    sb_handle.wait(ret);
-    return {ret};
+    return sb_handle.fill(_rs, static_cast<element_t>(sb), 1, _dependencies);
   } else {
     auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
                                static_cast<index_t>(1));
-    auto dotOp = blas::dot::backend::_dot(sb_handle, _N, _vx, _incx, _vy, _incy,
-                                          _rs, _dependencies);
+    auto dotOp = blas::internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy,
+                                      _rs, _dependencies);
     auto addOp = make_op<ScalarOp, AddOperator>(sb, rs);
     auto assignOp2 = make_op<Assign>(rs, addOp);
     auto ret = sb_handle.execute(assignOp2, dotOp);
@@ -189,6 +317,14 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _asum(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const typename sb_handle_t::event_t &_dependencies) {
+  if (sb_handle.is_reproducible() && _N > 0) {
+    typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
+        make_vector_view(_vx, _incx, _N);
+    auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
+                               static_cast<index_t>(1));
+    return _reproducible_reduction<AbsoluteAddOperator>(sb_handle, _N, rs, vx,
+                                                        _dependencies);
+  }
   return blas::asum::backend::_asum(sb_handle, _N, _vx, _incx, _rs,
                                     _dependencies);
 }
@@ -282,6 +418,19 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const index_t _nWG,
     const typename sb_handle_t::event_t &_dependencies) {
+#ifndef __ADAPTIVECPP__
+  using value_t = typename ValueType<container_0_t>::type;
+  if constexpr (!single && PackedIndexKey<value_t>::is_supported) {
+    // The two steps are replaced by a single kernel when the device has the
+    // atomics it needs and the indices fit in the packed keys
+    if (sb_handle.is_single_pass_reduction() &&
+        sb_handle.get_device_capabilities().has_atomic64 &&
+        static_cast<uint64_t>(_N) <= std::numeric_limits<uint32_t>::max()) {
+      return _iamax_iamin_packed<localSize, is_max>(
+          sb_handle, _N, _vx, _incx, _rs, _nWG, _dependencies);
+    }
+  }
+#endif
   typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
       make_vector_view(_vx, _incx, _N);
   auto rs = make_vector_view<index_t>(_rs, static_cast<increment_t>(1),
@@ -291,11 +440,9 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
   if constexpr (single) {
     auto op = make_index_max_min<is_max, false>(rs, tupOp);
     if constexpr (localMemSize == 0) {
-      auto q = sb_handle.get_queue();
       // get the minimum supported sub_group size
       const index_t min_sg_size = static_cast<index_t>(
-          q.get_device()
-              .template get_info<sycl::info::device::sub_group_sizes>()[0]);
+          sb_handle.get_device_capabilities().min_sub_group_size);
       ret = sb_handle.execute(op, min_sg_size, min_sg_size, _dependencies);
     } else {
       ret = sb_handle.execute(
@@ -306,11 +453,9 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
     using scalar_t = typename ValueType<container_0_t>::type;
     using tuple_t = IndexValueTuple<index_t, scalar_t>;
     constexpr bool is_usm = std::is_pointer<container_0_t>::value;
-    auto q = sb_handle.get_queue();
     // get the minimum supported sub_group size
     const index_t min_sg_size = static_cast<index_t>(
-        q.get_device()
-            .template get_info<sycl::info::device::sub_group_sizes>()[0]);
+        sb_handle.get_device_capabilities().min_sub_group_size);
     // if using no local memory, every sub_group writes one intermediate output,
     // in case if sub_group size is not known at allocation time, than allocate
     // extra memory using min supported sub_group size.
@@ -333,13 +478,11 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
                                   : std::numeric_limits<scalar_t>::max();
       const index_t idx = std::numeric_limits<index_t>::max();
       tuple_t init{idx, val};
-      const std::vector<tuple_t> init_vec(memory_size, init);
       // initialize the intermediate memory so that in case the
       // min_sub_group size is not the same as the actual sub_group
       // size used at runtime, the implementation does not use
       // garbage values to effect the correctness of the output.
-      ret = typename sb_handle_t::event_t{helper::copy_to_device(
-          q, init_vec.data(), gpu_res, memory_size, _dependencies)};
+      ret = sb_handle.fill(gpu_res, init, memory_size, _dependencies);
       ret = concatenate_vectors(
           ret, sb_handle.execute(step0, static_cast<index_t>(localSize),
                                  _nWG * static_cast<index_t>(localSize), ret));
@@ -360,6 +503,60 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
   return ret;
 }
 
+/**
+ * _iamax_iamin_packed.
+ * Single kernel implementation of backend specific iamax or iamin operator,
+ * used by _iamax_iamin_impl instead of its two steps when the device supports
+ * 64-bit atomics. Each work group reduces the absolute values of its elements
+ * packed with their indices into 64-bit keys (see PackedIndexKey), and
+ * combines its key with an atomic max. The last work group to finish writes
+ * the index of the result to _rs.
+ *
+ * @tparam localSize value to indicate work group size
+ * @tparam is_max boolean variable to indicate if required operation is
+ * iamax or not
+ * @param sb_handle sb_handle
+ * @param _N size of the input vector, at most 2^32 - 1
+ * @param _vx input vector
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _rs output variable
+ * @param _nWG no. of work groups required for the reduction
+ * @param _dependencies Vector of events
+ */
+template <int localSize, bool is_max, typename sb_handle_t,
+          typename container_0_t, typename container_1_t, typename index_t,
+          typename increment_t>
+typename sb_handle_t::event_t _iamax_iamin_packed(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _rs, const index_t _nWG,
+    const typename sb_handle_t::event_t &_dependencies) {
+  typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
+      make_vector_view(_vx, _incx, _N);
+  auto rs = make_vector_view<index_t>(_rs, static_cast<increment_t>(1),
+                                      static_cast<index_t>(1));
+  constexpr bool is_usm = std::is_pointer<container_0_t>::value;
+  // The result key followed by the ticket counting the finished work groups
+  auto keys = sb_handle.template acquire_temp_mem < is_usm
+                  ? helper::AllocType::usm
+                  : helper::AllocType::buffer,
+       uint64_t > (2);
+  auto vkeys = make_vector_view(keys, static_cast<increment_t>(1),
+                                static_cast<index_t>(2));
+  typename sb_handle_t::event_t ret;
+  if (!sb_handle.is_workspace_query()) {
+    // The kernel leaves the keys at zero, so that they are only reset once
+    // per call and not when replaying an Execution_Plan
+    ret.push_back(helper::fill(sb_handle.get_queue(), keys, uint64_t{0}, 2,
+                               _dependencies));
+  }
+  auto op = make_packed_index_max_min<is_max, is_usm>(rs, vx, vkeys);
+  ret = sb_handle.execute(op, static_cast<index_t>(localSize),
+                          _nWG * static_cast<index_t>(localSize),
+                          ret.empty() ? _dependencies : ret);
+  sb_handle.release_temp_mem(ret, keys);
+  return ret;
+}
+
 /**
  * \brief IAMAX finds the index of the first element having maximum
  * @param _vx  BufferIterator or USM pointer
@@ -374,8 +571,7 @@ typename sb_handle_t::event_t _iamax(
     ContainerI _rs, const typename sb_handle_t::event_t &_dependencies) {
   if (_incx < 0 || _N < 0) {
     index_t out = 0;
-    return typename sb_handle_t::event_t{
-        helper::fill(sb_handle.get_queue(), _rs, out, 1, _dependencies)};
+    return sb_handle.fill(_rs, out, 1, _dependencies);
   } else {
     return blas::iamax::backend::_iamax(sb_handle, _N, _vx, _incx, _rs,
                                         _dependencies);
@@ -396,8 +592,7 @@ typename sb_handle_t::event_t _iamin(
     ContainerI _rs, const typename sb_handle_t::event_t &_dependencies) {
   if (_incx < 0 || _N < 0) {
     index_t out = 0;
-    return typename sb_handle_t::event_t{
-        helper::fill(sb_handle.get_queue(), _rs, out, 1, _dependencies)};
+    return sb_handle.fill(_rs, out, 1, _dependencies);
   } else {
     return blas::iamin::backend::_iamin(sb_handle, _N, _vx, _incx, _rs,
                                         _dependencies);
@@ -420,9 +615,16 @@ typename sb_handle_t::event_t _swap(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies) {
+  auto swap_tree = [](auto &vx, auto &vy) {
+    return make_op<DoubleAssign>(vy, vx, vx, vy);
+  };
+  if (_incx == increment_t(1) && _incy == increment_t(1)) {
+    return _execute_unit_stride<increment_t>(sb_handle, _N, swap_tree,
+                                             _dependencies, _vx, _vy);
+  }
   auto vx = make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
-  auto swapOp = make_op<DoubleAssign>(vy, vx, vx, vy);
+  auto swapOp = swap_tree(vx, vy);
   auto ret = sb_handle.execute(swapOp, _dependencies);
 
   return ret;
@@ -440,15 +642,33 @@ template <typename sb_handle_t, typename element_t, typename container_0_t,
 typename sb_handle_t::event_t _scal(
     sb_handle_t &sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, const typename sb_handle_t::event_t &_dependencies) {
-  auto vx = make_vector_view(_vx, _incx, _N);
-  if (_alpha == element_t{0}) {
-    auto zeroOp = make_op<UnaryOp, AdditionIdentity>(vx);
-    auto assignOp = make_op<Assign>(vx, zeroOp);
+  if (is_host_zero(_alpha)) {
+    auto zero_tree = [](auto &vx) {
+      auto zeroOp = make_op<UnaryOp, AdditionIdentity>(vx);
+      return make_op<Assign>(vx, zeroOp);
+    };
+    if (_incx == increment_t(1)) {
+      return _execute_unit_stride<increment_t>(sb_handle, _N, zero_tree,
+                                               _dependencies, _vx);
+    }
+    auto vx = make_vector_view(_vx, _incx, _N);
+    auto assignOp = zero_tree(vx);
     auto ret = sb_handle.execute(assignOp, _dependencies);
     return ret;
   } else {
-    auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
-    auto assignOp = make_op<Assign>(vx, scalOp);
+    auto alpha = make_scalar_operand<index_t>(_alpha);
+    // A zero alpha in device memory also sets NaN elements to zero
+    auto scal_tree = [&](auto &vx) {
+      auto scalOp =
+          make_op<ScalarOp, scalar_product_operator_t<element_t>>(alpha, vx);
+      return make_op<Assign>(vx, scalOp);
+    };
+    if (_incx == increment_t(1)) {
+      return _execute_unit_stride<increment_t>(sb_handle, _N, scal_tree,
+                                               _dependencies, _vx);
+    }
+    auto vx = make_vector_view(_vx, _incx, _N);
+    auto assignOp = scal_tree(vx);
     auto ret = sb_handle.execute(assignOp, _dependencies);
     return ret;
   }
@@ -519,8 +739,33 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _nrm2(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const typename sb_handle_t::event_t &_dependencies) {
-  return blas::nrm2::backend::_nrm2(sb_handle, _N, _vx, _incx, _rs,
-                                    _dependencies);
+  using element_t = typename ValueType<container_1_t>::type;
+  if constexpr (!std::is_same<typename AccumulatorType<element_t>::type,
+                              element_t>::value) {
+    return _reduce_with_accumulator<index_t, increment_t>(
+        sb_handle, _rs,
+        [&](auto acc, const typename sb_handle_t::event_t &deps) {
+          return blas::internal::_nrm2(sb_handle, _N, _vx, _incx, acc, deps);
+        },
+        _dependencies);
+  } else {
+    if (sb_handle.is_reproducible() && _N > 0) {
+      typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
+          make_vector_view(_vx, _incx, _N);
+      auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
+                                 static_cast<index_t>(1));
+      auto cx = make_cast_op<element_t>(vx);
+      auto prdOp = make_op<UnaryOp, SquareOperator>(cx);
+      auto ret0 = _reproducible_reduction<AddOperator>(sb_handle, _N, rs,
+                                                       prdOp, _dependencies);
+      auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
+      auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
+      auto ret1 = sb_handle.execute(assignOpFinal, ret0);
+      return blas::concatenate_vectors(ret0, ret1);
+    }
+    return blas::nrm2::backend::_nrm2(sb_handle, _N, _vx, _incx, _rs,
+                                      _dependencies);
+  }
 }
 
 /*! _nrm2_impl.
@@ -560,7 +805,9 @@ typename sb_handle_t::event_t _nrm2_impl(
       make_vector_view(_vx, _incx, _N);
   auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
-  auto prdOp = make_op<UnaryOp, SquareOperator>(vx);
+  // Converts 16-bit elements to the float type of rs, see _nrm2
+  auto cx = make_cast_op<typename ValueType<container_1_t>::type>(vx);
+  auto prdOp = make_op<UnaryOp, SquareOperator>(cx);
 
   auto assignOp =
       make_wg_atomic_reduction<AddOperator, usmManagedMem>(rs, prdOp);
@@ -624,7 +871,11 @@ typename sb_handle_t::event_t _dot_impl(
   auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
 
-  auto prdOp = make_op<BinaryOpConst, ProductOperator>(vx, vy);
+  // Converts 16-bit elements to the float type of rs, see _dot
+  using acc_t = typename ValueType<container_2_t>::type;
+  auto cx = make_cast_op<acc_t>(vx);
+  auto cy = make_cast_op<acc_t>(vy);
+  auto prdOp = make_op<BinaryOpConst, ProductOperator>(cx, cy);
   auto wgReductionOp =
       make_wg_atomic_reduction<AddOperator, usmManagedMem>(rs, prdOp);
 
@@ -641,6 +892,126 @@ typename sb_handle_t::event_t _dot_impl(
   return ret_event;
 }
 
+/**
+ * @brief plan_reduction_launch Picks the work group size and the number of
+ * work groups of a one-pass atomic reduction of _N elements without local
+ * memory (see _dot_impl, _nrm2_impl and _asum_impl), unless they are fixed by
+ * SB_Handle::set_reduction_launch.
+ *
+ * On CPUs, a work group is a single sub-group, of the largest supported size
+ * up to 32, and runs on one core, so that up to two work groups per core keep
+ * all the cores busy. On other devices, the work groups have the default work
+ * group size and up to four of them run per compute unit. Fewer work groups
+ * are used for small vectors, each work item reducing at least
+ * min_elems_per_item elements to amortize the atomic update of its
+ * sub-group.
+ *
+ * The work group size is a power of two between 8 and 256, see
+ * dispatch_reduction_local_size.
+ */
+template <typename sb_handle_t, typename index_t>
+reduction_launch_t<index_t> plan_reduction_launch(sb_handle_t &sb_handle,
+                                                  index_t _N) {
+  constexpr index_t min_local_size = 8;
+  constexpr index_t max_local_size = 256;
+  constexpr index_t min_elems_per_item = 32;
+  const auto &caps = sb_handle.get_device_capabilities();
+  const auto fixed = sb_handle.get_reduction_launch();
+
+  index_t local_size = static_cast<index_t>(fixed.first);
+  if (local_size == 0) {
+    if (caps.is_cpu) {
+      local_size = min_local_size;
+      for (const auto sg_size : caps.sub_group_sizes) {
+        if (sg_size <= 32) {
+          local_size = std::max(local_size, static_cast<index_t>(sg_size));
+        }
+      }
+    } else {
+      local_size = static_cast<index_t>(caps.work_group_size);
+    }
+  }
+  // Round down to a power of two within the dispatched sizes
+  local_size = std::min(std::max(local_size, min_local_size), max_local_size);
+  while (local_size & (local_size - 1)) {
+    local_size &= local_size - 1;
+  }
+
+  index_t number_WG = static_cast<index_t>(fixed.second);
+  if (number_WG == 0) {
+    const index_t wg_per_cu = caps.is_cpu ? 2 : 4;
+    const index_t max_WG =
+        static_cast<index_t>(caps.compute_units) * wg_per_cu;
+    const index_t elems_per_WG = local_size * min_elems_per_item;
+    // Rounded up without overflowing for _N close to the index_t limit
+    number_WG =
+        std::min(max_WG, _N / elems_per_WG +
+                             static_cast<index_t>(_N % elems_per_WG != 0));
+  }
+  return {local_size, std::max(number_WG, static_cast<index_t>(1))};
+}
+
+/**
+ * @brief dispatch_reduction_local_size Calls
+ * launch(std::integral_constant<int, local_size>{}) and returns its result,
+ * so that a work group size chosen at runtime by plan_reduction_launch can be
+ * given to the implementations taking it as a template parameter.
+ *
+ * Without local memory, the kernels of the reductions do not depend on the
+ * work group size, so the dispatched sizes share a single kernel.
+ *
+ * @param local_size Power of two between 8 and 256.
+ */
+template <typename index_t, typename launch_t>
+auto dispatch_reduction_local_size(index_t local_size, launch_t launch) {
+  switch (local_size) {
+    case 256:
+      return launch(std::integral_constant<int, 256>{});
+    case 128:
+      return launch(std::integral_constant<int, 128>{});
+    case 64:
+      return launch(std::integral_constant<int, 64>{});
+    case 32:
+      return launch(std::integral_constant<int, 32>{});
+    case 16:
+      return launch(std::integral_constant<int, 16>{});
+    default:
+      return launch(std::integral_constant<int, 8>{});
+  }
+}
+
+/**
+ * @brief _reproducible_reduction Reduces the tree op of _N elements into the
+ * single element rs with execute(AssignReduction), whose work groups and
+ * passes combine the partial results in a fixed order, so that the result is
+ * bitwise reproducible (see SB_Handle::set_reproducible). rs is overwritten.
+ *
+ * The launch only depends on the device and _N: work groups of the default
+ * work group size, rounded down to a power of two up to 256, each reducing two
+ * blocks of elements per step, and at most four work groups per compute unit.
+ */
+template <typename operator_t, typename sb_handle_t, typename lhs_t,
+          typename rhs_t, typename index_t>
+typename sb_handle_t::event_t _reproducible_reduction(
+    sb_handle_t &sb_handle, index_t _N, lhs_t &rs, rhs_t &op,
+    const typename sb_handle_t::event_t &_dependencies) {
+  constexpr index_t max_local_size = 256;
+  index_t local_size = std::min(
+      static_cast<index_t>(sb_handle.get_work_group_size()), max_local_size);
+  // The work group reduction in local memory halves a power of two
+  while (local_size & (local_size - 1)) {
+    local_size &= local_size - 1;
+  }
+  const index_t max_WG =
+      static_cast<index_t>(4 * sb_handle.get_num_compute_units());
+  const index_t number_WG = std::max(
+      index_t{1},
+      std::min((_N + 2 * local_size - 1) / (2 * local_size), max_WG));
+  auto reductionOp = make_assign_reduction<operator_t>(
+      rs, op, local_size, static_cast<index_t>(2 * local_size * number_WG));
+  return sb_handle.execute(reductionOp, _dependencies);
+}
+
 /**
  * .
  * @brief _rot constructor given plane rotation
@@ -663,10 +1034,19 @@ typename sb_handle_t::event_t _rot(
     const typename sb_handle_t::event_t &_dependencies) {
   auto vx = make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
-  auto scalOp1 = make_op<ScalarOp, ProductOperator>(_cos, vx);
-  auto scalOp2 = make_op<ScalarOp, ProductOperator>(_sin, vy);
-  auto scalOp3 = make_op<ScalarOp, ProductOperator>(element_t{-_sin}, vx);
-  auto scalOp4 = make_op<ScalarOp, ProductOperator>(_cos, vy);
+  auto cos_op = make_scalar_operand<index_t>(_cos);
+  auto sin_op = make_scalar_operand<index_t>(_sin);
+  auto minus_sin_op = [&]() {
+    if constexpr (is_device_scalar<element_t>::value) {
+      return make_op<UnaryOp, NegationOperator>(sin_op);
+    } else {
+      return element_t{-_sin};
+    }
+  }();
+  auto scalOp1 = make_op<ScalarOp, ProductOperator>(cos_op, vx);
+  auto scalOp2 = make_op<ScalarOp, ProductOperator>(sin_op, vy);
+  auto scalOp3 = make_op<ScalarOp, ProductOperator>(minus_sin_op, vx);
+  auto scalOp4 = make_op<ScalarOp, ProductOperator>(cos_op, vy);
   auto addOp12 = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
   auto addOp34 = make_op<BinaryOp, AddOperator>(scalOp3, scalOp4);
   auto DoubleAssignView = make_op<DoubleAssign>(vx, vy, addOp12, addOp34);
@@ -1177,6 +1557,230 @@ typename ValueType<container_t>::type _nrm2(
 #endif
 }
 
+/**
+ * \brief Runs @p reduce, writing a scalar to a temporary container, and
+ * copies the scalar to a host slot of the SB_Handle without blocking.
+ * @tparam alloc Allocation type of the temporary container
+ * @param init_result Whether the temporary container is filled with
+ * @p init before the reduction
+ * @param reduce Called as reduce(_rs, dependencies), returns the events of
+ * the reduction writing to _rs
+ */
+template <helper::AllocType alloc, typename value_t, typename sb_handle_t,
+          typename reduce_t>
+Scalar_Future<value_t> _reduce_to_host_slot(
+    sb_handle_t &sb_handle, bool init_result, value_t init, reduce_t reduce,
+    const typename sb_handle_t::event_t &_dependencies) {
+  using event_t = typename sb_handle_t::event_t;
+  auto q = sb_handle.get_queue();
+  auto gpu_res = sb_handle.template acquire_temp_mem<alloc, value_t>(1);
+  event_t local_deps = _dependencies;
+  if (init_result) {
+    local_deps.push_back(helper::fill(q, gpu_res, init, 1, {}));
+  }
+  const event_t reduce_events = reduce(gpu_res, local_deps);
+
+  const auto &pool = sb_handle.get_host_slot_pool();
+  void *slot = pool->acquire();
+  sycl::event copy_event;
+#ifdef SB_ENABLE_USM
+  if constexpr (alloc == helper::AllocType::usm) {
+    copy_event = q.submit([&](sycl::handler &cgh) {
+      for (const auto &dep : reduce_events) {
+        cgh.depends_on(dep);
+      }
+      cgh.memcpy(slot, gpu_res, sizeof(value_t));
+    });
+  } else
+#endif
+  {
+    // The accessor orders the copy after the reduction
+    copy_event =
+        helper::copy_to_host(q, gpu_res, static_cast<value_t *>(slot), 1);
+  }
+  const event_t copy_events{copy_event};
+  sb_handle.release_temp_mem(copy_events, gpu_res);
+  return Scalar_Future<value_t>(pool, slot, copy_events);
+}
+
+/**
+ * \brief Computes the inner product of two vectors (future version that
+ * returns before the result is available)
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ * @return Scalar_Future holding the result.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Future<typename ValueType<container_0_t>::type> _dot_async(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies) {
+#ifndef __ADAPTIVECPP__
+  constexpr bool is_usm = std::is_pointer<container_0_t>::value;
+  using element_t = typename ValueType<container_0_t>::type;
+  constexpr auto alloc =
+      is_usm ? helper::AllocType::usm : helper::AllocType::buffer;
+  return _reduce_to_host_slot<alloc, element_t>(
+      sb_handle, true, element_t{0},
+      [&](auto _rs, const typename sb_handle_t::event_t &deps) {
+        return blas::internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy,
+                                    _rs, deps);
+      },
+      _dependencies);
+#else
+  throw std::runtime_error(
+      "Dot is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
+#endif
+}
+
+/**
+ * \brief Computes the inner product of two vectors with double precision
+ * accumulation and adds a scalar to the result (future version that returns
+ * before the result is available)
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes. If size 0, the result will be sb.
+ * @param sb Scalar to add to the results of the inner product.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ * @return Scalar_Future holding the result.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Future<typename ValueType<container_0_t>::type> _sdsdot_async(
+    sb_handle_t &sb_handle, index_t _N, float sb, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies) {
+  constexpr bool is_usm = std::is_pointer<container_0_t>::value;
+  using element_t = typename ValueType<container_0_t>::type;
+  constexpr auto alloc =
+      is_usm ? helper::AllocType::usm : helper::AllocType::buffer;
+  return _reduce_to_host_slot<alloc, element_t>(
+      sb_handle, true, element_t{0},
+      [&](auto _rs, const typename sb_handle_t::event_t &deps) {
+        return blas::internal::_sdsdot(sb_handle, _N, sb, _vx, _incx,
+                                       _vy, _incy, _rs, deps);
+      },
+      _dependencies);
+}
+
+/**
+ * \brief IAMAX finds the index of the first element having maximum (future
+ * version that returns before the result is available)
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<index_t> _iamax_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  constexpr auto alloc =
+      is_usm ? helper::AllocType::usm : helper::AllocType::buffer;
+  // The operation writes the result, which needs no initialization
+  return _reduce_to_host_slot<alloc, index_t>(
+      sb_handle, false, index_t{-1},
+      [&](auto _rs, const typename sb_handle_t::event_t &deps) {
+        return blas::internal::_iamax(sb_handle, _N, _vx, _incx, _rs, deps);
+      },
+      _dependencies);
+}
+
+/**
+ * \brief IAMIN finds the index of the first element having minimum (future
+ * version that returns before the result is available)
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<index_t> _iamin_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  constexpr auto alloc =
+      is_usm ? helper::AllocType::usm : helper::AllocType::buffer;
+  return _reduce_to_host_slot<alloc, index_t>(
+      sb_handle, false, index_t{-1},
+      [&](auto _rs, const typename sb_handle_t::event_t &deps) {
+        return blas::internal::_iamin(sb_handle, _N, _vx, _incx, _rs, deps);
+      },
+      _dependencies);
+}
+
+/**
+ * \brief ASUM Takes the sum of the absolute values (future version that
+ * returns before the result is available)
+ *
+ * @param sb_handle_t sb_handle
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<typename ValueType<container_t>::type> _asum_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+#ifndef __ADAPTIVECPP__
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  using element_t = typename ValueType<container_t>::type;
+  constexpr auto alloc =
+      is_usm ? helper::AllocType::usm : helper::AllocType::buffer;
+  return _reduce_to_host_slot<alloc, element_t>(
+      sb_handle, true, element_t{0},
+      [&](auto _rs, const typename sb_handle_t::event_t &deps) {
+        return blas::internal::_asum(sb_handle, _N, _vx, _incx, _rs, deps);
+      },
+      _dependencies);
+#else
+  throw std::runtime_error(
+      "Asum is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
+#endif
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector (future version that
+ * returns before the result is available)
+ *
+ * @param sb_handle_t sb_handle
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Future<typename ValueType<container_t>::type> _nrm2_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+#ifndef __ADAPTIVECPP__
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  using element_t = typename ValueType<container_t>::type;
+  constexpr auto alloc =
+      is_usm ? helper::AllocType::usm : helper::AllocType::buffer;
+  return _reduce_to_host_slot<alloc, element_t>(
+      sb_handle, true, element_t{0},
+      [&](auto _rs, const typename sb_handle_t::event_t &deps) {
+        return blas::internal::_nrm2(sb_handle, _N, _vx, _incx, _rs, deps);
+      },
+      _dependencies);
+#else
+  throw std::runtime_error(
+      "Nrm2 is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
+#endif
+}
+
 }  // namespace internal
 }  // namespace blas
 
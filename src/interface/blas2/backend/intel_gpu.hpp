@@ -57,6 +57,24 @@ typename SB_Handle::event_t _gemv(
         _dependencies);
   }
 }
+
+/*!
+ * @brief Batched GEMV, with enough work items per matrix for the length of y
+ * and the rest of each work group given to the next matrices of the batch.
+ */
+template <transpose_type trn, bool is_pointer_array, typename SB_Handle,
+          typename index_t, typename element_t, typename container_t0,
+          typename container_t1, typename increment_t, typename container_t2>
+typename SB_Handle::event_t _gemv_batch(
+    SB_Handle& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _stride_a, container_t1 _vx,
+    increment_t _incx, index_t _stride_x, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stride_y, index_t _batch_size,
+    const typename SB_Handle::event_t& _dependencies) {
+  return blas::internal::_gemv_batch_impl<128, trn, is_pointer_array>(
+      sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx, _stride_x,
+      _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+}
 }  // namespace backend
 }  // namespace gemv
 
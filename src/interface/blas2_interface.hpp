@@ -67,13 +67,14 @@ namespace internal {
  */
 template <uint32_t local_range, uint32_t cache_line_size,
           gemv_memory_t memory_type, transpose_type trn, typename sb_handle_t,
-          typename index_t, typename element_t, typename container_t0,
+          typename index_t, typename scalar_t, typename container_t0,
           typename container_t1, typename increment_t, typename container_t2>
 typename sb_handle_t::event_t _gemv_impl(
-    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    sb_handle_t& sb_handle, index_t _M, index_t _N, scalar_t _alpha,
     container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
-    element_t _beta, container_t2 _vy, increment_t _incy,
+    scalar_t _beta, container_t2 _vy, increment_t _incy,
     const typename sb_handle_t::event_t& _dependencies) {
+  using element_t = typename ValueType<container_t2>::type;
   constexpr int cl_elems = cache_line_size / sizeof(element_t);
   constexpr bool is_transposed = trn != transpose_type::Normal;
 
@@ -85,6 +86,11 @@ typename sb_handle_t::event_t _gemv_impl(
   typename VectorViewType<container_t1, index_t, increment_t>::type vx =
       make_vector_view(_vx, _incx, x_vector_size);
   auto vy = make_vector_view(_vy, _incy, y_vector_size);
+  auto alpha = make_scalar_operand<index_t>(_alpha);
+  auto beta = make_scalar_operand<index_t>(_beta);
+  // Scalars in device memory are checked for zero by the kernel, so that a
+  // zero beta does not propagate NaN values of y
+  using scale_op_t = scalar_product_operator_t<scalar_t>;
 
   constexpr bool is_usm = std::is_pointer<container_t0>::value;
   typename sb_handle_t::event_t ret;
@@ -112,13 +118,13 @@ typename sb_handle_t::event_t _gemv_impl(
     auto gemvEvent = sb_handle.execute(gemv, static_cast<index_t>(local_range),
                                        global_size, _dependencies);
 
-    if (_beta != static_cast<element_t>(0)) {
+    if (!is_host_zero(_beta)) {
       // vec_y * b
-      auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
+      auto betaMulYOp = make_op<ScalarOp, scale_op_t>(beta, vy);
 
       // alpha * vec_dot_products
       auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, dot_products_matrix);
+          make_op<ScalarOp, scale_op_t>(alpha, dot_products_matrix);
 
       // add up
       auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulDotsOp);
@@ -133,7 +139,7 @@ typename sb_handle_t::event_t _gemv_impl(
 
     } else {
       auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, dot_products_matrix);
+          make_op<ScalarOp, scale_op_t>(alpha, dot_products_matrix);
       auto assignOp = make_op<Assign>(vy, alphaMulDotsOp);
       ret = concatenate_vectors(
           gemvEvent,
@@ -184,13 +190,12 @@ typename sb_handle_t::event_t _gemv_impl(
     // Sum the partial dot products results from the GEMV kernel
     auto sumColsOp = make_sum_matrix_columns(dot_products_matrix);
 
-    if (_beta != static_cast<element_t>(0)) {
+    if (!is_host_zero(_beta)) {
       // vec_y * b
-      auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
+      auto betaMulYOp = make_op<ScalarOp, scale_op_t>(beta, vy);
 
       // alpha * vec_dot_products
-      auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, sumColsOp);
+      auto alphaMulDotsOp = make_op<ScalarOp, scale_op_t>(alpha, sumColsOp);
 
       // add up
       auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulDotsOp);
@@ -203,8 +208,7 @@ typename sb_handle_t::event_t _gemv_impl(
           gemvEvent,
           lastEvent = sb_handle.execute(assignOp, local_range, gemvEvent));
     } else {
-      auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, sumColsOp);
+      auto alphaMulDotsOp = make_op<ScalarOp, scale_op_t>(alpha, sumColsOp);
       auto assignOp = make_op<Assign>(vy, alphaMulDotsOp);
       ret = concatenate_vectors(
           gemvEvent,
@@ -216,6 +220,150 @@ typename sb_handle_t::event_t _gemv_impl(
   return ret;
 }
 
+/*! _gemv_batch_launch.
+ * @brief Launches a single GemvBatch kernel for the whole batch of General
+ * Matrix Vector products. Each matrix is computed by
+ * local_range / matrices_per_group work items, dot_split of them sharing each
+ * element of y. When matrices_per_group is 1, the rows of op(A) are spread
+ * across as many work groups as needed to give one row to each dot_split work
+ * items.
+ *
+ * @tparam local_range  specifies the number of threads per work group used by
+ *                      the kernel
+ * @tparam matrices_per_group  specifies the number of matrices computed by a
+ *                             work group
+ * @tparam dot_split  specifies the number of threads computing each dot
+ *                    product, whose partial sums are reduced in local memory
+ * @tparam trn  specifies whether the input matrices should be transposed
+ * @tparam is_pointer_array  specifies whether _mA, _vx and _vy are arrays of
+ *                           pointers, the strides being then ignored
+ */
+template <uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, transpose_type trn, bool is_pointer_array,
+          typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename sb_handle_t::event_t _gemv_batch_launch(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _stride_a, container_t1 _vx,
+    increment_t _incx, index_t _stride_x, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stride_y, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  const index_t x_vector_size = is_transposed ? _M : _N;
+  const index_t y_vector_size = is_transposed ? _N : _M;
+  if (_batch_size == 0 || y_vector_size == 0) {
+    return _dependencies;
+  }
+
+  // The views either hold the arrays of pointers or span the whole strided
+  // batches, the kernel finding each matrix and vector itself
+  const index_t abs_incx = _incx < 0 ? -_incx : _incx;
+  const index_t abs_incy = _incy < 0 ? -_incy : _incy;
+  const index_t a_size =
+      is_pointer_array ? _batch_size
+                       : (_batch_size - 1) * _stride_a + _lda * (_N - 1) + _M;
+  const index_t x_size =
+      is_pointer_array
+          ? _batch_size
+          : (_batch_size - 1) * _stride_x + (x_vector_size - 1) * abs_incx + 1;
+  const index_t y_size =
+      is_pointer_array
+          ? _batch_size
+          : (_batch_size - 1) * _stride_y + (y_vector_size - 1) * abs_incy + 1;
+  constexpr index_t one = 1;
+  auto mA = make_vector_view(_mA, one, a_size);
+  auto vx = make_vector_view(_vx, one, x_size);
+  auto vy = make_vector_view(_vy, one, y_size);
+
+  constexpr index_t rows_per_group = local_range / dot_split;
+  const index_t groups_per_matrix =
+      matrices_per_group == 1 ? (y_vector_size - 1) / rows_per_group + 1 : 1;
+  auto gemv =
+      make_gemv_batch<local_range, matrices_per_group, dot_split,
+                      is_transposed, is_pointer_array>(
+          vy, mA, vx, _M, _N, _alpha, _lda, _stride_a, _incx, _stride_x, _beta,
+          _incy, _stride_y, _batch_size, groups_per_matrix);
+  const index_t global_size = gemv.get_num_groups() * local_range;
+  if constexpr (dot_split == 1) {
+    return sb_handle.execute(gemv, static_cast<index_t>(local_range),
+                             global_size, _dependencies);
+  } else {
+    // One partial sum per work item
+    return sb_handle.execute(gemv, static_cast<index_t>(local_range),
+                             global_size, static_cast<index_t>(local_range),
+                             _dependencies);
+  }
+}
+
+/*! _gemv_batch_impl.
+ * @brief Internal implementation of the batched General Matrix Vector product.
+ *
+ * Gives each matrix the smallest slice of 8, 32 or 64 work items covering the
+ * length of y, the rest of each work group computing the next matrices of the
+ * batch. Longer vectors y get whole work groups.
+ *
+ * When the dot products are longer than y and the batch has too few elements
+ * of y to fill the device, each dot product is instead split across several
+ * work items of the kernel and reduced in local memory: a vector y of up to 8
+ * elements gets a whole work group, and longer vectors 8 work items per
+ * element. The transposed matrices are then read along their columns by
+ * neighbouring work items.
+ *
+ * @tparam local_range  specifies the number of threads per work group used by
+ *                      the kernel
+ */
+template <uint32_t local_range, transpose_type trn, bool is_pointer_array,
+          typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename sb_handle_t::event_t _gemv_batch_impl(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _stride_a, container_t1 _vx,
+    increment_t _incx, index_t _stride_x, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stride_y, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  static_assert(local_range % 64 == 0,
+                "local_range must be a multiple of the slice sizes");
+  const index_t y_size = (trn == transpose_type::Normal) ? _M : _N;
+  const index_t dot_size = (trn == transpose_type::Normal) ? _N : _M;
+  const index_t device_threads =
+      static_cast<index_t>(sb_handle.get_num_compute_units()) * local_range;
+  const bool split_dot = sb_handle.has_local_memory() && dot_size > y_size &&
+                         _batch_size * y_size < device_threads;
+  if (split_dot) {
+    if (y_size <= 8) {
+      return _gemv_batch_launch<local_range, 1, local_range / 8, trn,
+                                is_pointer_array>(
+          sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx,
+          _stride_x, _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+    } else {
+      return _gemv_batch_launch<local_range, 1, 8, trn, is_pointer_array>(
+          sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx,
+          _stride_x, _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+    }
+  } else if (y_size <= 8) {
+    return _gemv_batch_launch<local_range, local_range / 8, 1, trn,
+                              is_pointer_array>(
+        sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx, _stride_x,
+        _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+  } else if (y_size <= 32) {
+    return _gemv_batch_launch<local_range, local_range / 32, 1, trn,
+                              is_pointer_array>(
+        sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx, _stride_x,
+        _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+  } else if (y_size <= 64) {
+    return _gemv_batch_launch<local_range, local_range / 64, 1, trn,
+                              is_pointer_array>(
+        sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx, _stride_x,
+        _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+  } else {
+    return _gemv_batch_launch<local_range, 1, 1, trn, is_pointer_array>(
+        sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx, _stride_x,
+        _beta, _vy, _incy, _stride_y, _batch_size, _dependencies);
+  }
+}
+
 /*! _TRMV.
  * @brief Implementation of the Triangular Matrix Vector product.
  */
@@ -373,23 +521,22 @@ typename sb_handle_t::event_t _trsv_impl(
   auto mA = make_matrix_view<col_major>(_mA, _N, _N, _lda);
   auto vx = make_vector_view(_vx, _incx, _N);
 
-  std::vector<int32_t> sync_vec(2);
-  sync_vec[0] =
+  // Both synchronization counters start at the index of the first block
+  const int32_t sync_init =
       is_forward ? 0
                  : ((roundUp<index_t>(_N, subgroup_size) / subgroup_size) - 1);
-  sync_vec[1] = sync_vec[0];
+  constexpr index_t sync_size = 2;
 
-  auto queue = sb_handle.get_queue();
   constexpr bool is_usm = std::is_pointer<container_t0>::value;
   auto sync_buffer = sb_handle.template acquire_temp_mem < is_usm
                          ? blas::helper::AllocType::usm
                          : blas::helper::AllocType::buffer,
-       int32_t > (sync_vec.size());
-  auto copy_sync = blas::helper::copy_to_device<int32_t>(
-      queue, sync_vec.data(), sync_buffer, sync_vec.size());
-  sb_handle.wait(copy_sync);
+       int32_t > (sync_size);
+  // Recorded by an Execution_Plan, as the kernel updates the counters
+  auto init_sync =
+      sb_handle.fill(sync_buffer, sync_init, sync_size, _dependencies);
 
-  auto sync = make_vector_view(sync_buffer, 1, sync_vec.size());
+  auto sync = make_vector_view(sync_buffer, 1, sync_size);
 
   auto trsv =
       make_trsv<subgroup_size, subgroups, is_upper, is_transposed, is_unit>(
@@ -401,7 +548,7 @@ typename sb_handle_t::event_t _trsv_impl(
       trsv, static_cast<index_t>(sub_num * subgroup_size),
       roundUp<index_t>(sub_num * _N, sub_num * subgroup_size),
       static_cast<index_t>(subgroup_size * (subgroup_size + 2 + sub_num)),
-      _dependencies);
+      init_sync);
 
   sb_handle.release_temp_mem(ret, sync_buffer);
 
@@ -768,24 +915,23 @@ typename sb_handle_t::event_t _tbsv_impl(
       make_matrix_view<col_major>(_mA, _K + 1, _N, _lda);
   auto vx = make_vector_view(_vx, _incx, _N);
 
-  std::vector<int32_t> sync_vec(2);
-  sync_vec[0] =
+  // Both synchronization counters start at the index of the first block
+  const int32_t sync_init =
       is_forward ? 0
                  : ((roundUp<index_t>(_N, subgroup_size) / subgroup_size) - 1);
-  sync_vec[1] = sync_vec[0];
+  constexpr index_t sync_size = 2;
 
   constexpr bool is_usm = std::is_pointer<container_t0>::value;
-  auto queue = sb_handle.get_queue();
 
   auto sync_buffer = sb_handle.template acquire_temp_mem < is_usm
                          ? blas::helper::AllocType::usm
                          : blas::helper::AllocType::buffer,
-       int32_t > (sync_vec.size());
-  auto copy_sync = blas::helper::copy_to_device<int32_t>(
-      queue, sync_vec.data(), sync_buffer, sync_vec.size());
-  sb_handle.wait(copy_sync);
+       int32_t > (sync_size);
+  // Recorded by an Execution_Plan, as the kernel updates the counters
+  auto init_sync =
+      sb_handle.fill(sync_buffer, sync_init, sync_size, _dependencies);
 
-  auto sync = make_vector_view(sync_buffer, 1, sync_vec.size());
+  auto sync = make_vector_view(sync_buffer, 1, sync_size);
 
   auto tbsv =
       make_tbsv<subgroup_size, subgroups, is_upper, is_transposed, is_unit>(
@@ -796,7 +942,7 @@ typename sb_handle_t::event_t _tbsv_impl(
       tbsv, static_cast<index_t>(sub_num * subgroup_size),
       roundUp<index_t>(sub_num * _N, sub_num * subgroup_size),
       static_cast<index_t>(subgroup_size * (subgroup_size + 2 + sub_num)),
-      _dependencies);
+      init_sync);
 
   sb_handle.release_temp_mem(ret, sync_buffer);
 
@@ -832,25 +978,24 @@ typename sb_handle_t::event_t _tpsv_impl(
                                         matrix_size);
   auto vx = make_vector_view(_vx, _incx, _N);
 
-  std::vector<int32_t> sync_vec(2);
-  sync_vec[0] =
+  // Both synchronization counters start at the index of the first block
+  const int32_t sync_init =
       is_forward ? 0
                  : ((roundUp<index_t>(_N, subgroup_size) / subgroup_size) - 1);
-  sync_vec[1] = sync_vec[0];
+  constexpr index_t sync_size = 2;
 
   constexpr bool is_usm = std::is_pointer<container_t0>::value;
-  auto queue = sb_handle.get_queue();
 
   auto sync_buffer = sb_handle.template acquire_temp_mem < is_usm
                          ? blas::helper::AllocType::usm
                          : blas::helper::AllocType::buffer,
-       int32_t > (sync_vec.size());
-  auto copy_sync = blas::helper::copy_to_device<int32_t>(
-      queue, sync_vec.data(), sync_buffer, sync_vec.size());
-  sb_handle.wait(copy_sync);
+       int32_t > (sync_size);
+  // Recorded by an Execution_Plan, as the kernel updates the counters
+  auto init_sync =
+      sb_handle.fill(sync_buffer, sync_init, sync_size, _dependencies);
 
   auto sync =
-      make_vector_view(sync_buffer, one_increment_t::value(), sync_vec.size());
+      make_vector_view(sync_buffer, one_increment_t::value(), sync_size);
 
   auto tpsv =
       make_tpsv<subgroup_size, subgroups, is_upper, is_transposed, is_unit>(
@@ -861,7 +1006,7 @@ typename sb_handle_t::event_t _tpsv_impl(
       tpsv, static_cast<index_t>(sub_num * subgroup_size),
       roundUp<index_t>(sub_num * _N, sub_num * subgroup_size),
       static_cast<index_t>(subgroup_size * (subgroup_size + 2 + sub_num)),
-      _dependencies);
+      init_sync);
 
   sb_handle.release_temp_mem(ret, sync_buffer);
 
@@ -899,12 +1044,9 @@ typename sb_handle_t::event_t _ger_impl(
   if (_useLocalMem) {
     assert((_nRowsWG <= _localSize) && (_nColsWG <= _localSize));
   } else {
-    std::vector<size_t> subgroup_sizes =
-        sb_handle.get_queue()
-            .get_device()
-            .template get_info<sycl::info::device::sub_group_sizes>();
-    size_t min_subgroup_size = *subgroup_sizes.begin();
-    size_t max_subgroup_size = *subgroup_sizes.rbegin();
+    const auto& caps = sb_handle.get_device_capabilities();
+    size_t min_subgroup_size = caps.min_sub_group_size;
+    size_t max_subgroup_size = caps.max_sub_group_size;
     assert(((_nRowsWG * _nColsWG) / _localSize) <= min_subgroup_size);
     assert(_nRowsWG % max_subgroup_size == 0);
   }
@@ -1191,6 +1333,57 @@ typename sb_handle_t::event_t inline _gemv(
                    _incy, _dependencies);
 }
 
+/*!
+ @brief Strided batched generalised matrix vector product, computed by a
+ single kernel.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gemv_strided_batched(
+    sb_handle_t& sb_handle, char _trans, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _mA, index_t _lda, index_t _stride_a,
+    container_1_t _vx, increment_t _incx, index_t _stride_x, element_t _beta,
+    container_2_t _vy, increment_t _incy, index_t _stride_y,
+    index_t _batch_size, const typename sb_handle_t::event_t& _dependencies) {
+  return tolower(_trans) == 'n'
+             ? blas::gemv::backend::_gemv_batch<transpose_type::Normal, false>(
+                   sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx,
+                   _stride_x, _beta, _vy, _incy, _stride_y, _batch_size,
+                   _dependencies)
+             : blas::gemv::backend::_gemv_batch<transpose_type::Transposed,
+                                                false>(
+                   sb_handle, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx,
+                   _stride_x, _beta, _vy, _incy, _stride_y, _batch_size,
+                   _dependencies);
+}
+
+/*!
+ @brief Batched generalised matrix vector product on arrays of pointers to the
+ matrices and vectors, computed by a single kernel.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gemv_batched(
+    sb_handle_t& sb_handle, char _trans, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _a_array, index_t _lda,
+    container_1_t _x_array, increment_t _incx, element_t _beta,
+    container_2_t _y_array, increment_t _incy, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  constexpr index_t unused_stride = 0;
+  return tolower(_trans) == 'n'
+             ? blas::gemv::backend::_gemv_batch<transpose_type::Normal, true>(
+                   sb_handle, _M, _N, _alpha, _a_array, _lda, unused_stride,
+                   _x_array, _incx, unused_stride, _beta, _y_array, _incy,
+                   unused_stride, _batch_size, _dependencies)
+             : blas::gemv::backend::_gemv_batch<transpose_type::Transposed,
+                                                true>(
+                   sb_handle, _M, _N, _alpha, _a_array, _lda, unused_stride,
+                   _x_array, _incx, unused_stride, _beta, _y_array, _incy,
+                   unused_stride, _batch_size, _dependencies);
+}
+
 template <typename sb_handle_t, typename index_t, typename container_t0,
           typename container_t1, typename increment_t>
 typename sb_handle_t::event_t inline _trmv(
@@ -1319,8 +1512,34 @@ typename sb_handle_t::event_t inline _ger(
   nColsWG = (_N < 8192 && _M < 8192) ? 64 : 256;
 #endif
 
-  return _ger_impl(sb_handle, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA, _lda,
-                   _dependencies, localSize, useLocalMem, nRowsWG, nColsWG);
+  if constexpr (is_device_scalar<element_t>::value) {
+    // The Ger kernel takes alpha by value, so x is first scaled by the alpha
+    // in device memory into a temporary vector used with an alpha of one.
+    using value_t = typename ValueType<container_t2>::type;
+    constexpr bool is_usm = std::is_pointer<container_t2>::value;
+    constexpr increment_t one = 1;
+    auto scaled_x = sb_handle.template acquire_temp_mem < is_usm
+                        ? helper::AllocType::usm
+                        : helper::AllocType::buffer,
+         value_t > (_M);
+    typename VectorViewType<container_t0, index_t, increment_t>::type vx =
+        make_vector_view(_vx, _incx, _M);
+    auto vscaled_x = make_vector_view(scaled_x, one, _M);
+    auto alpha = make_scalar_operand<index_t>(_alpha);
+    auto scalOp =
+        make_op<ScalarOp, scalar_product_operator_t<element_t>>(alpha, vx);
+    auto assignOp = make_op<Assign>(vscaled_x, scalOp);
+    auto scalEvent = sb_handle.execute(assignOp, _dependencies);
+    auto ret = _ger_impl(sb_handle, _M, _N, value_t{1}, scaled_x, one, _vy,
+                         _incy, _mA, _lda, scalEvent, localSize, useLocalMem,
+                         nRowsWG, nColsWG);
+    sb_handle.release_temp_mem(ret, scaled_x);
+    return ret;
+  } else {
+    return _ger_impl(sb_handle, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA,
+                     _lda, _dependencies, localSize, useLocalMem, nRowsWG,
+                     nColsWG);
+  }
 }
 
 template <typename sb_handle_t, typename index_t, typename element_t,
@@ -66,8 +66,7 @@ _gemm(sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
     }
 
 #ifdef SB_ENABLE_JOINT_MATRIX
-    const char* en_joint_matrix = std::getenv("SB_ENABLE_JOINT_MATRIX");
-    if (en_joint_matrix != NULL && *en_joint_matrix == '1' && !s_a && !s_b &&
+    if (sb_handle.get_device_capabilities().use_joint_matrix && !s_a && !s_b &&
         std::is_same<typename ValueType<container_0_t>::type, float>::value &&
         std::is_same<typename ValueType<container_1_t>::type, float>::value &&
         std::is_same<typename ValueType<container_2_t>::type, float>::value) {
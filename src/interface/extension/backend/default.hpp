@@ -134,6 +134,23 @@ typename sb_handle_t::event_t _axpy_batch(
 }
 }  // namespace backend
 }  // namespace axpy_batch
+
+namespace reduction_batch {
+namespace backend {
+template <batch_reduction_t reduction, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  return blas::internal::_reduction_batch_impl<reduction, 128, 256>(
+      sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy, _stride_y, _rs,
+      _batch_size, _dependencies);
+}
+}  // namespace backend
+}  // namespace reduction_batch
 }  // namespace blas
 
 #endif
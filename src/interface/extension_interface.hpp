@@ -27,6 +27,7 @@
 #define PORTBLAS_EXTENSION_INTERFACE_HPP
 
 #include "blas_meta.h"
+#include "interface/blas1_interface.h"
 #include "interface/extension/backend/backend.hpp"
 #include "interface/extension_interface.h"
 #include "operations/blas1_trees.h"
@@ -34,6 +35,8 @@
 #include "operations/extension/axpy_batch.h"
 #include "operations/extension/matcopy_batch.h"
 #include "operations/extension/reduction.h"
+#include "operations/extension/reduction_batch.h"
+#include "operations/extension/rot_batch.h"
 #include "operations/extension/transpose.h"
 #include "portblas_helper.h"
 #include "sb_handle/portblas_handle.h"
@@ -642,6 +645,279 @@ typename sb_handle_t::event_t _axpy_batch_impl(
   }
 }
 
+template <batch_reduction_t reduction, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (_batch_size <= 0) {
+    return _dependencies;
+  }
+  return blas::reduction_batch::backend::_reduction_batch<reduction>(
+      sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy, _stride_y, _rs,
+      _batch_size, _dependencies);
+}
+
+/*!
+ * @brief Launches Reduction_batch with work groups of @p localSize work
+ * items. Vectors of up to @p maxSubGroupN elements are reduced by a
+ * sub-group each, longer ones by a whole work group.
+ */
+template <batch_reduction_t reduction, int localSize, int maxSubGroupN,
+          typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch_impl(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  // The kernel indexes the vectors itself, the views only give it access to
+  // the memory of the whole batch
+  const index_t vx_size =
+      (_stride_x) ? _stride_x * _batch_size : _N * std::abs(_incx);
+  const index_t vy_size =
+      (_stride_y) ? _stride_y * _batch_size : _N * std::abs(_incy);
+  typename VectorViewType<container_0_t, index_t, index_t>::type vx =
+      make_vector_view(_vx, static_cast<index_t>(1), vx_size);
+  typename VectorViewType<container_1_t, index_t, index_t>::type vy =
+      make_vector_view(_vy, static_cast<index_t>(1), vy_size);
+  auto rs = make_vector_view(_rs, static_cast<index_t>(1), _batch_size);
+  constexpr index_t local_size = static_cast<index_t>(localSize);
+  // Enough work groups to fill the device, the kernel loops over the rest of
+  // the batch
+  const index_t max_num_wg =
+      static_cast<index_t>(sb_handle.get_num_compute_units() * 8);
+  if (_N <= maxSubGroupN) {
+    const index_t sg_size = static_cast<index_t>(
+        sb_handle.get_device_capabilities().max_sub_group_size);
+    const index_t nWG = std::min(
+        max_num_wg, (_batch_size * sg_size + local_size - 1) / local_size);
+    auto op = make_reduction_batch<reduction, true, localSize>(
+        rs, vx, vy, _N, _incx, _stride_x, _incy, _stride_y, _batch_size);
+    return sb_handle.execute(op, local_size, local_size * nWG, _dependencies);
+  }
+  const index_t nWG = std::min(max_num_wg, _batch_size);
+  auto op = make_reduction_batch<reduction, false, localSize>(
+      rs, vx, vy, _N, _incx, _stride_x, _incy, _stride_y, _batch_size);
+  return sb_handle.execute(op, local_size, local_size * nWG, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rotg_batch(
+    sb_handle_t& sb_handle, container_0_t _a, index_t _stride_a,
+    container_1_t _b, index_t _stride_b, container_2_t _c, index_t _stride_c,
+    container_3_t _s, index_t _stride_s, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (_batch_size <= 0) {
+    return _dependencies;
+  }
+  // Rotg computes one rotation per element of the views
+  auto a_view = make_vector_view(_a, _stride_a, _batch_size);
+  auto b_view = make_vector_view(_b, _stride_b, _batch_size);
+  auto c_view = make_vector_view(_c, _stride_c, _batch_size);
+  auto s_view = make_vector_view(_s, _stride_s, _batch_size);
+
+  auto operation = Rotg<decltype(a_view)>(a_view, b_view, c_view, s_view);
+  return sb_handle.execute(operation, _dependencies);
+}
+
+/**
+ * @brief Number of elements spanned by a strided batch of _batch_size vectors
+ * of _N elements.
+ */
+template <typename index_t>
+inline index_t batch_span(index_t _N, index_t _inc, index_t _stride,
+                          index_t _batch_size) {
+  return (_batch_size - 1) * _stride + (_N - 1) * std::abs(_inc) + 1;
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rot_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _c, index_t _stride_c, container_3_t _s, index_t _stride_s,
+    index_t _batch_size, const typename sb_handle_t::event_t& _dependencies) {
+  if (_N <= 0 || _batch_size <= 0) {
+    return _dependencies;
+  }
+  constexpr index_t one = 1;
+  // The kernel indexes the vectors itself, the views only give it access to
+  // the memory of the whole batch
+  auto vx = make_vector_view(_vx, one,
+                             batch_span(_N, _incx, _stride_x, _batch_size));
+  auto vy = make_vector_view(_vy, one,
+                             batch_span(_N, _incy, _stride_y, _batch_size));
+  auto vc = make_vector_view(_c, one, batch_span(one, one, _stride_c,
+                                                 _batch_size));
+  auto vs = make_vector_view(_s, one, batch_span(one, one, _stride_s,
+                                                 _batch_size));
+  auto op = make_rot_batch(vx, vy, vc, vs, _N, _incx, _stride_x, _incy,
+                           _stride_y, _stride_c, _stride_s, _batch_size);
+  return sb_handle.execute(op, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _rotm_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _param, index_t _stride_param, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (_N <= 0 || _batch_size <= 0) {
+    return _dependencies;
+  }
+  constexpr index_t one = 1;
+  constexpr index_t param_size = 5;
+  auto vx = make_vector_view(_vx, one,
+                             batch_span(_N, _incx, _stride_x, _batch_size));
+  auto vy = make_vector_view(_vy, one,
+                             batch_span(_N, _incy, _stride_y, _batch_size));
+  auto vparam = make_vector_view(
+      _param, one, batch_span(param_size, one, _stride_param, _batch_size));
+  auto op = make_rotm_batch(vx, vy, vparam, _N, _incx, _stride_x, _incy,
+                            _stride_y, _stride_param, _batch_size);
+  return sb_handle.execute(op, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _axpby(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, element_t _beta, container_1_t _vy, index_t _incy,
+    const typename sb_handle_t::event_t& _dependencies) {
+  typename VectorViewType<container_0_t, index_t, index_t>::type vx =
+      make_vector_view(_vx, _incx, _N);
+  auto vy = make_vector_view(_vy, _incy, _N);
+  auto alpha = make_scalar_operand<index_t>(_alpha);
+  auto beta = make_scalar_operand<index_t>(_beta);
+
+  // A zero beta in device memory must not propagate NaN values of y
+  using scale_op_t = scalar_product_operator_t<element_t>;
+  auto scalXOp = make_op<ScalarOp, scale_op_t>(alpha, vx);
+  auto scalYOp = make_op<ScalarOp, scale_op_t>(beta, vy);
+  auto addOp = make_op<BinaryOp, AddOperator>(scalXOp, scalYOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  return sb_handle.execute(assignOp, _dependencies);
+}
+
+/**
+ * @brief Whether _vz reads the same elements as _vy, in which case the dot
+ * product of _axpy_dot squares the updated values instead of reading them
+ * back.
+ */
+template <typename container_0_t, typename container_1_t, typename index_t>
+inline bool is_same_vector(container_0_t _vy, index_t _incy, container_1_t _vz,
+                           index_t _incz) {
+  if constexpr (std::is_pointer<container_0_t>::value &&
+                std::is_pointer<container_1_t>::value) {
+    // The containers may differ in constness only
+    return static_cast<const void*>(_vy) == static_cast<const void*>(_vz) &&
+           _incy == _incz;
+  } else if constexpr (std::is_pointer<container_0_t>::value ||
+                       std::is_pointer<container_1_t>::value) {
+    return false;
+  } else if constexpr (!std::is_same<
+                           decltype(_vy.get_buffer()),
+                           decltype(_vz.get_buffer())>::value) {
+    return false;
+  } else {
+    return _vy.get_buffer() == _vz.get_buffer() &&
+           _vy.get_offset() == _vz.get_offset() && _incy == _incz;
+  }
+}
+
+/**
+ * @brief Builds the tree of _axpy_dot, the dot product of the axpy update of
+ * _vy with _vz, and calls reduce(rs, tree) to reduce it into _rs.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t, typename reduce_t>
+auto _axpy_dot_reduce(index_t _N, element_t _alpha, container_0_t _vx,
+                      index_t _incx, container_1_t _vy, index_t _incy,
+                      container_2_t _vz, index_t _incz, container_3_t _rs,
+                      reduce_t reduce) {
+  typename VectorViewType<container_0_t, index_t, index_t>::type vx =
+      make_vector_view(_vx, _incx, _N);
+  auto vy = make_vector_view(_vy, _incy, _N);
+  auto rs = make_vector_view(_rs, static_cast<index_t>(1),
+                             static_cast<index_t>(1));
+  auto alpha = make_scalar_operand<index_t>(_alpha);
+
+  // y = y + alpha * x, each element being updated by the work item reducing
+  // it, so that its new value is used without being read back
+  auto scalOp =
+      make_op<ScalarOp, scalar_product_operator_t<element_t>>(alpha, vx);
+  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+
+  if (is_same_vector(_vy, _incy, _vz, _incz)) {
+    auto sqrOp = make_op<UnaryOp, SquareOperator>(assignOp);
+    return reduce(rs, sqrOp);
+  } else {
+    typename VectorViewType<container_2_t, index_t, index_t>::type vz =
+        make_vector_view(_vz, _incz, _N);
+    auto prdOp = make_op<BinaryOp, ProductOperator>(assignOp, vz);
+    return reduce(rs, prdOp);
+  }
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _axpy_dot(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, container_1_t _vy, index_t _incy, container_2_t _vz,
+    index_t _incz, container_3_t _rs,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (sb_handle.is_reproducible() && _N > 0) {
+    // The fixed order reduction overwrites _rs
+    return _axpy_dot_reduce(
+        _N, _alpha, _vx, _incx, _vy, _incy, _vz, _incz, _rs,
+        [&](auto& rs, auto& op) {
+          return _reproducible_reduction<AddOperator>(sb_handle, _N, rs, op,
+                                                      _dependencies);
+        });
+  }
+  using value_t = typename ValueType<container_3_t>::type;
+  // The atomic reduction accumulates into _rs
+  auto init_event = sb_handle.fill(_rs, value_t{0}, 1, _dependencies);
+  if (_N <= 0) {
+    return init_event;
+  }
+  const auto launch = plan_reduction_launch(sb_handle, _N);
+  return dispatch_reduction_local_size(
+      launch.local_size, [&](auto local_size) {
+        return _axpy_dot_impl<decltype(local_size)::value>(
+            sb_handle, _N, _alpha, _vx, _incx, _vy, _incy, _vz, _incz, _rs,
+            launch.number_WG, init_event);
+      });
+}
+
+template <int localSize, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t,
+          typename container_3_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _axpy_dot_impl(
+    sb_handle_t& sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
+    index_t _incx, container_1_t _vy, index_t _incy, container_2_t _vz,
+    index_t _incz, container_3_t _rs, index_t _number_wg,
+    const typename sb_handle_t::event_t& _dependencies) {
+  const index_t global_size = _number_wg * static_cast<index_t>(localSize);
+  return _axpy_dot_reduce(
+      _N, _alpha, _vx, _incx, _vy, _incy, _vz, _incz, _rs,
+      [&](auto& rs, auto& op) {
+        auto wgReductionOp = make_wg_atomic_reduction<AddOperator>(rs, op);
+        return sb_handle.execute(wgReductionOp,
+                                 static_cast<index_t>(localSize), global_size,
+                                 _dependencies);
+      });
+}
+
 }  // namespace internal
 }  // namespace blas
 
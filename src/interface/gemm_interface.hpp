@@ -31,6 +31,7 @@
 #include "operations/blas3_trees.h"
 #include "portblas_helper.h"
 #include "sb_handle/portblas_handle.h"
+#include "views/view.h"
 
 #include <algorithm>
 #include <cctype>
@@ -184,6 +185,55 @@ typename sb_handle_t::event_t _gemm_backend(
   }
 }
 
+/*!
+ * @brief Single gemm, shared by _gemm and _symm, whose alpha and beta are
+ * either host scalars or in device memory.
+ */
+template <bool symm_A, bool symm_B, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_single(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (is_device_scalar<element_t>::value) {
+    // The Gemm kernels take alpha and beta by value, so A*B is computed into
+    // a temporary matrix, which is then scaled by the alpha in device memory
+    // and added to C scaled by the beta in device memory. Loading the scalars
+    // in the epilogue of every Gemm kernel instead would save this pass.
+    using value_t = typename ValueType<container_2_t>::type;
+    constexpr bool is_usm = std::is_pointer<container_2_t>::value;
+    auto ab_buffer = sb_handle.template acquire_temp_mem < is_usm
+                         ? helper::AllocType::usm
+                         : helper::AllocType::buffer,
+         value_t > (_M * _N);
+    auto gemmEvent = _gemm_backend<symm_A, symm_B>(
+        sb_handle, _TransA, _TransB, _M, _N, _K, value_t{1}, a_, _lda,
+        index_t(0), b_, _ldb, index_t(0), value_t{0}, ab_buffer, _M,
+        index_t(0), index_t(1), gemm_batch_type_t::strided, _dependencies);
+    auto mAB = make_matrix_view<col_major>(ab_buffer, _M, _N, _M);
+    auto mC = make_matrix_view<col_major>(_C, _M, _N, _ldc);
+    auto alpha = make_scalar_operand<index_t>(_alpha);
+    auto beta = make_scalar_operand<index_t>(_beta);
+    // A zero beta does not propagate NaN values of C, and a zero alpha those
+    // of A*B
+    using scale_op_t = scalar_product_operator_t<element_t>;
+    auto alphaMulABOp = make_op<ScalarOp, scale_op_t>(alpha, mAB);
+    auto betaMulCOp = make_op<ScalarOp, scale_op_t>(beta, mC);
+    auto addOp = make_op<BinaryOp, AddOperator>(alphaMulABOp, betaMulCOp);
+    auto assignOp = make_op<Assign>(mC, addOp);
+    auto ret = sb_handle.execute(assignOp, gemmEvent);
+    sb_handle.release_temp_mem(ret, ab_buffer);
+    return ret;
+  } else {
+    return _gemm_backend<symm_A, symm_B>(
+        sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, index_t(0),
+        b_, _ldb, index_t(0), _beta, _C, _ldc, index_t(0), index_t(1),
+        gemm_batch_type_t::strided, _dependencies);
+  }
+}
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename sb_handle_t::event_t _gemm(
@@ -191,10 +241,9 @@ typename sb_handle_t::event_t _gemm(
     index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, const typename sb_handle_t::event_t& _dependencies) {
-  return _gemm_backend<false, false>(
-      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, index_t(0), b_,
-      _ldb, index_t(0), _beta, _C, _ldc, index_t(0), index_t(1),
-      gemm_batch_type_t::strided, _dependencies);
+  return _gemm_single<false, false>(sb_handle, _TransA, _TransB, _M, _N, _K,
+                                    _alpha, a_, _lda, b_, _ldb, _beta, _C,
+                                    _ldc, _dependencies);
 }
 
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
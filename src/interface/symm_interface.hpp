@@ -53,20 +53,18 @@ typename sb_handle_t::event_t _symm(
   }
   if (_side == SIDE_LEFT) {  // C <- alpha * A * B + beta * C
     char trans_symm = _uplo == UPLO_UPPER ? TRANS_YES : TRANS_NO;
-    return _gemm_backend<true, false>(
-        sb_handle, trans_symm, TRANS_NO, _M, _N, _M, _alpha, a_, _lda,
-        index_t(0), b_, _ldb, index_t(0), _beta, _C, _ldc, index_t(0),
-        index_t(1), gemm_batch_type_t::strided, _dependencies);
+    return _gemm_single<true, false>(sb_handle, trans_symm, TRANS_NO, _M, _N,
+                                     _M, _alpha, a_, _lda, b_, _ldb, _beta, _C,
+                                     _ldc, _dependencies);
   } else if (_side == SIDE_RIGHT) {  // C <- alpha * B * A + beta * C
     // if the valid values are in the upper side, transpose the matrix
     // to make gemm to start reading rows on a valid value.
     // This is to reduce the number of modifications on the gemm
     // implementation needed to support symm.
     char trans_symm = _uplo == UPLO_LOWER ? TRANS_YES : TRANS_NO;
-    return _gemm_backend<false, true>(
-        sb_handle, TRANS_NO, trans_symm, _M, _N, _N, _alpha, b_, _ldb,
-        index_t(0), a_, _lda, index_t(0), _beta, _C, _ldc, index_t(0),
-        index_t(1), gemm_batch_type_t::strided, _dependencies);
+    return _gemm_single<false, true>(sb_handle, TRANS_NO, trans_symm, _M, _N,
+                                     _N, _alpha, b_, _ldb, a_, _lda, _beta, _C,
+                                     _ldc, _dependencies);
   } else {
     throw std::invalid_argument("invalid _side");
   }
@@ -151,8 +151,7 @@ typename sb_handle_t::event_t _trsm(
                   ? helper::AllocType::usm
                   : helper::AllocType::buffer,
        element_t > (invASize);
-  typename sb_handle_t::event_t event = {blas::helper::fill(
-      sb_handle.get_queue(), invA, element_t{0}, invASize, _dependencies)};
+  auto event = sb_handle.fill(invA, element_t{0}, invASize, _dependencies);
   trsmEvents = concatenate_vectors(trsmEvents, event);
 
   // Create the matrix views from the input buffers
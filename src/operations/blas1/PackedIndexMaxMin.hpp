@@ -0,0 +1,160 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename PackedIndexMaxMin.hpp
+ *
+ **************************************************************************/
+
+#ifndef PACKED_INDEX_MAX_MIN_HPP
+#define PACKED_INDEX_MAX_MIN_HPP
+#include "operations/blas1_trees.h"
+#include "operations/blas_operators.hpp"
+
+namespace blas {
+
+/*! PackedIndexMaxMin.
+ * @brief Single kernel implementation of iamax and iamin, combining the
+ * results of the work groups with a 64-bit atomic max on packed keys.
+ * */
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t,
+                  keys_t>::PackedIndexMaxMin(lhs_t& _l, rhs_t& _r, keys_t& _k)
+    : lhs_(_l), rhs_(_r), keys_(_k){};
+
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PORTBLAS_INLINE typename PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t,
+                                           keys_t>::index_t
+PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>::get_size()
+    const {
+  return rhs_.get_size();
+}
+
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PORTBLAS_INLINE bool
+PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>::valid_thread(
+    sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PORTBLAS_INLINE typename PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t,
+                                           keys_t>::key_t
+PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>::pack(
+    value_t val, index_t idx) {
+  using bits_t = typename PackedIndexKey<value_t>::bits_t;
+  if (sycl::isnan(val)) {
+    return key_t{0};
+  }
+  const key_t bits = sycl::bit_cast<bits_t>(sycl::fabs(val));
+  const key_t low = static_cast<uint32_t>(idx);
+  if constexpr (is_max) {
+    return (bits << 32) | (key_t{0xFFFFFFFF} - low);
+  } else {
+    return ~((bits << 32) | low);
+  }
+}
+
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PORTBLAS_INLINE typename PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t,
+                                           keys_t>::index_t
+PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>::unpack_index(
+    key_t key) {
+  // Only NaN elements
+  if (key == key_t{0}) {
+    return index_t{0};
+  }
+  const key_t low = key & key_t{0xFFFFFFFF};
+  if constexpr (is_max) {
+    return static_cast<index_t>(key_t{0xFFFFFFFF} - low);
+  } else {
+    return static_cast<index_t>(~low & key_t{0xFFFFFFFF});
+  }
+}
+
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PORTBLAS_INLINE void
+PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>::eval(
+    sycl::nd_item<1> ndItem) {
+  constexpr sycl::access::address_space addr_sp =
+      usmManagedMem ? sycl::access::address_space::generic_space
+                    : sycl::access::address_space::global_space;
+  const index_t size = rhs_.get_size();
+  const index_t lid = ndItem.get_global_linear_id();
+  const index_t loop_stride =
+      ndItem.get_local_range(0) * ndItem.get_group_range(0);
+  const index_t nGroups = ndItem.get_group_range(0);
+
+  // First loop for big arrays
+  key_t key = 0;
+  for (index_t id = lid; id < size; id += loop_stride) {
+    const key_t elem_key = pack(rhs_.eval(id), id);
+    key = (elem_key > key) ? elem_key : key;
+  }
+
+  key = sycl::reduce_over_group(ndItem.get_group(), key,
+                                sycl::maximum<key_t>());
+
+  // The key of the group is released by the ticket increment, and acquired
+  // by the last group through the same counter
+  if (ndItem.get_local_id(0) == 0) {
+    auto result = sycl::atomic_ref<key_t, sycl::memory_order::relaxed,
+                                   sycl::memory_scope::device, addr_sp>(
+        keys_.get_data()[0]);
+    auto ticket = sycl::atomic_ref<key_t, sycl::memory_order::acq_rel,
+                                   sycl::memory_scope::device, addr_sp>(
+        keys_.get_data()[1]);
+    result.fetch_max(key);
+    if (ticket.fetch_add(key_t{1}) == static_cast<key_t>(nGroups - 1)) {
+      lhs_.eval(0) = unpack_index(result.load());
+      // Ready for the next launch, e.g. a replay of an Execution_Plan
+      result.store(key_t{0});
+      ticket.store(key_t{0}, sycl::memory_order::relaxed);
+    }
+  }
+}
+
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PORTBLAS_INLINE void
+PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t, keys_t>::bind(
+    sycl::handler& h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+  keys_.bind(h);
+}
+
+template <bool is_max, bool usmManagedMem, typename lhs_t, typename rhs_t,
+          typename keys_t>
+PORTBLAS_INLINE void PackedIndexMaxMin<is_max, usmManagedMem, lhs_t, rhs_t,
+                                       keys_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+  keys_.adjust_access_displacement();
+}
+}  // namespace blas
+
+#endif
@@ -0,0 +1,188 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *
+ *  @filename SinglePassReduction.hpp
+ *
+ **************************************************************************/
+
+#ifndef SINGLE_PASS_REDUCTION_HPP
+#define SINGLE_PASS_REDUCTION_HPP
+#include "operations/blas1_trees.h"
+#include "operations/blas_operators.hpp"
+
+namespace blas {
+
+/*! SinglePassReduction.
+ * @brief This class implements a device wide reduction in a single kernel,
+ * the last work group to finish combining the partial results of all the work
+ * groups.
+ *
+ * */
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                    ticket_t>::SinglePassReduction(lhs_t& _l, rhs_t& _r,
+                                                   partials_t& _p,
+                                                   ticket_t& _t,
+                                                   index_t _blqS,
+                                                   index_t _grdS)
+    : lhs_(_l),
+      rhs_(_r),
+      partials_(_p),
+      ticket_(_t),
+      local_num_thread_(_blqS),
+      global_num_thread_(_grdS){};
+
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+PORTBLAS_INLINE typename SinglePassReduction<operator_t, usmManagedMem, lhs_t,
+                                             rhs_t, partials_t,
+                                             ticket_t>::index_t
+SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                    ticket_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+PORTBLAS_INLINE bool
+SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                    ticket_t>::valid_thread(sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+/*!
+ * @brief Tree reduction of the values @p val of the work items of the group.
+ * All the work items of the group must call it, and get the result.
+ */
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+template <typename sharedT>
+PORTBLAS_INLINE typename SinglePassReduction<operator_t, usmManagedMem, lhs_t,
+                                             rhs_t, partials_t,
+                                             ticket_t>::value_t
+SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                    ticket_t>::reduce_work_group(sharedT scratch,
+                                                 sycl::nd_item<1> ndItem,
+                                                 value_t val) {
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  // The scratch may still be read by a previous reduction
+  ndItem.barrier(sycl::access::fence_space::local_space);
+  scratch[localid] = val;
+  ndItem.barrier(sycl::access::fence_space::local_space);
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + offset]);
+    }
+    ndItem.barrier(sycl::access::fence_space::local_space);
+  }
+  return scratch[0];
+}
+
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+template <typename sharedT>
+PORTBLAS_INLINE typename SinglePassReduction<operator_t, usmManagedMem, lhs_t,
+                                             rhs_t, partials_t,
+                                             ticket_t>::value_t
+SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                    ticket_t>::eval(sharedT scratch, sycl::nd_item<1> ndItem) {
+  constexpr sycl::access::address_space addr_sp =
+      usmManagedMem ? sycl::access::address_space::generic_space
+                    : sycl::access::address_space::global_space;
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t groupid = ndItem.get_group(0);
+  const index_t nGroups = ndItem.get_group_range(0);
+  const index_t vecS = rhs_.get_size();
+  static const value_t init_val = operator_t::template init<rhs_t>();
+
+  // Reduction of the elements of the group, as in AssignReduction
+  value_t val = init_val;
+  for (index_t k = 2 * groupid * localSz + localid; k < vecS;
+       k += 2 * global_num_thread_) {
+    val = operator_t::eval(val, rhs_.eval(k));
+    if (k + local_num_thread_ < vecS) {
+      val = operator_t::eval(val, rhs_.eval(k + local_num_thread_));
+    }
+  }
+  val = reduce_work_group(scratch, ndItem, val);
+
+  // The partial result is released by the ticket increment, and acquired by
+  // the last group through the same counter
+  bool is_last = false;
+  if (localid == 0) {
+    partials_.eval(groupid) = val;
+    auto ticket = sycl::atomic_ref<unsigned int, sycl::memory_order::acq_rel,
+                                   sycl::memory_scope::device, addr_sp>(
+        ticket_.get_data()[0]);
+    is_last = ticket.fetch_add(1u) == static_cast<unsigned int>(nGroups - 1);
+  }
+  is_last = sycl::group_broadcast(ndItem.get_group(), is_last);
+  if (!is_last) {
+    return val;
+  }
+  sycl::atomic_fence(sycl::memory_order::acquire, sycl::memory_scope::device);
+
+  // Reduction of the partial results by the last group
+  val = init_val;
+  for (index_t k = localid; k < nGroups; k += localSz) {
+    val = operator_t::eval(val, partials_.eval(k));
+  }
+  val = reduce_work_group(scratch, ndItem, val);
+  if (localid == 0) {
+    lhs_.eval(0) = val;
+    // Ready for the next launch, e.g. a replay of an Execution_Plan
+    auto ticket = sycl::atomic_ref<unsigned int, sycl::memory_order::relaxed,
+                                   sycl::memory_scope::device, addr_sp>(
+        ticket_.get_data()[0]);
+    ticket.store(0u);
+  }
+  return val;
+}
+
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+PORTBLAS_INLINE void
+SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                    ticket_t>::bind(sycl::handler& h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+  partials_.bind(h);
+  ticket_.bind(h);
+}
+
+template <typename operator_t, bool usmManagedMem, typename lhs_t,
+          typename rhs_t, typename partials_t, typename ticket_t>
+PORTBLAS_INLINE void
+SinglePassReduction<operator_t, usmManagedMem, lhs_t, rhs_t, partials_t,
+                    ticket_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+  partials_.adjust_access_displacement();
+  ticket_.adjust_access_displacement();
+}
+}  // namespace blas
+
+#endif
@@ -27,12 +27,15 @@
 #define PORTBLAS_BLAS1_TREES_HPP
 
 #include "blas1/IndexMaxMin.hpp"
+#include "blas1/PackedIndexMaxMin.hpp"
+#include "blas1/SinglePassReduction.hpp"
 #include "blas1/WGAtomicReduction.hpp"
 #include "operations/blas1_trees.h"
 #include "operations/blas_operators.hpp"
 #include "views/view.hpp"
 #include "views/view_sycl.hpp"
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace blas {
@@ -87,6 +90,17 @@ struct DetectScalar<sycl::half> {
   static element_t get_scalar(element_t &scalar) { return scalar; }
 };
 
+#ifdef BLAS_ENABLE_BFLOAT16
+/*! DetectScalar.
+ * @brief See Detect Scalar.
+ */
+template <>
+struct DetectScalar<bfloat16> {
+  using element_t = bfloat16;
+  static element_t get_scalar(element_t &scalar) { return scalar; }
+};
+#endif
+
 #ifdef BLAS_ENABLE_COMPLEX
 /*! DetectScalar (for sycl::complex<value_t>)
  * @brief See Detect Scalar.
@@ -106,6 +120,38 @@ auto get_scalar(element_t &scalar_)
     -> decltype(DetectScalar<element_t>::get_scalar(scalar_)) {
   return DetectScalar<element_t>::get_scalar(scalar_);
 }
+
+/*! IsScalarExpression.
+ * @brief Whether the scalar of a ScalarOp node is an expression evaluated in
+ * the kernel, e.g. a view of a scalar in device memory, rather than a value.
+ */
+template <typename scalar_t, typename = void>
+struct IsScalarExpression : std::false_type {};
+
+template <typename scalar_t>
+struct IsScalarExpression<scalar_t, std::void_t<typename scalar_t::index_t>>
+    : std::true_type {};
+
+/*! bind_scalar.
+ * @brief Binds the scalar of a ScalarOp node if it is an expression.
+ */
+template <typename scalar_t>
+PORTBLAS_INLINE void bind_scalar(scalar_t &scalar_, sycl::handler &h) {
+  if constexpr (IsScalarExpression<scalar_t>::value) {
+    scalar_.bind(h);
+  }
+}
+
+/*! adjust_scalar_access_displacement.
+ * @brief Adjusts the access displacement of the scalar of a ScalarOp node if
+ * it is an expression.
+ */
+template <typename scalar_t>
+PORTBLAS_INLINE void adjust_scalar_access_displacement(scalar_t &scalar_) {
+  if constexpr (IsScalarExpression<scalar_t>::value) {
+    scalar_.adjust_access_displacement();
+  }
+}
 }  // namespace internal
 
 /** Join.
@@ -149,6 +195,58 @@ PORTBLAS_INLINE void Join<lhs_t, rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/** FusedOp.
+ * @brief Evaluates the active sides of the expression in a single kernel.
+ */
+template <typename lhs_t, typename rhs_t>
+FusedOp<lhs_t, rhs_t>::FusedOp(lhs_t &_l, rhs_t _r)
+    : lhs_(_l), rhs_(_r), lhs_active_(true), rhs_active_(true) {}
+
+template <typename lhs_t, typename rhs_t>
+PORTBLAS_INLINE typename FusedOp<lhs_t, rhs_t>::index_t
+FusedOp<lhs_t, rhs_t>::get_size() const {
+  const index_t lhs_size =
+      lhs_active_ ? static_cast<index_t>(lhs_.get_size()) : index_t(0);
+  const index_t rhs_size =
+      rhs_active_ ? static_cast<index_t>(rhs_.get_size()) : index_t(0);
+  return (lhs_size > rhs_size) ? lhs_size : rhs_size;
+}
+
+template <typename lhs_t, typename rhs_t>
+PORTBLAS_INLINE bool FusedOp<lhs_t, rhs_t>::valid_thread(
+    sycl::nd_item<1> ndItem) const {
+  return (static_cast<index_t>(ndItem.get_global_id(0)) <
+          FusedOp<lhs_t, rhs_t>::get_size());
+}
+
+template <typename lhs_t, typename rhs_t>
+PORTBLAS_INLINE typename FusedOp<lhs_t, rhs_t>::value_t
+FusedOp<lhs_t, rhs_t>::eval(typename FusedOp<lhs_t, rhs_t>::index_t i) {
+  using lhs_index_t = typename lhs_t::index_t;
+  if (lhs_active_ && static_cast<lhs_index_t>(i) < lhs_.get_size()) {
+    lhs_.eval(static_cast<lhs_index_t>(i));
+  }
+  return (rhs_active_ && i < rhs_.get_size()) ? rhs_.eval(i) : value_t(0);
+}
+
+template <typename lhs_t, typename rhs_t>
+PORTBLAS_INLINE typename FusedOp<lhs_t, rhs_t>::value_t
+FusedOp<lhs_t, rhs_t>::eval(sycl::nd_item<1> ndItem) {
+  return FusedOp<lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename rhs_t>
+PORTBLAS_INLINE void FusedOp<lhs_t, rhs_t>::bind(sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+template <typename lhs_t, typename rhs_t>
+PORTBLAS_INLINE void FusedOp<lhs_t, rhs_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
 /** Assign.
  */
 
@@ -172,8 +270,14 @@ PORTBLAS_INLINE bool Assign<lhs_t, rhs_t>::valid_thread(
 template <typename lhs_t, typename rhs_t>
 PORTBLAS_INLINE typename Assign<lhs_t, rhs_t>::value_t
 Assign<lhs_t, rhs_t>::eval(typename Assign<lhs_t, rhs_t>::index_t i) {
-  auto val = lhs_.eval(i) = rhs_.eval(i);
-  return val;
+  if constexpr (is_vector_packet_view<lhs_t>::value) {
+    auto val = rhs_.eval(i);
+    lhs_.store(i, val);
+    return val;
+  } else {
+    auto val = lhs_.eval(i) = rhs_.eval(i);
+    return val;
+  }
 }
 
 template <typename lhs_t, typename rhs_t>
@@ -225,8 +329,16 @@ PORTBLAS_INLINE
         typename DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::index_t i) {
   auto val1 = rhs_1_.eval(i);
   auto val2 = rhs_2_.eval(i);
-  lhs_1_.eval(i) = val1;
-  lhs_2_.eval(i) = val2;
+  if constexpr (is_vector_packet_view<lhs_1_t>::value) {
+    lhs_1_.store(i, val1);
+  } else {
+    lhs_1_.eval(i) = val1;
+  }
+  if constexpr (is_vector_packet_view<lhs_2_t>::value) {
+    lhs_2_.store(i, val2);
+  } else {
+    lhs_2_.eval(i) = val2;
+  }
   return val1;
 }
 
@@ -292,12 +404,14 @@ ScalarOp<operator_t, scalar_t, rhs_t>::eval(sycl::nd_item<1> ndItem) {
 template <typename operator_t, typename scalar_t, typename rhs_t>
 PORTBLAS_INLINE void ScalarOp<operator_t, scalar_t, rhs_t>::bind(
     sycl::handler &h) {
+  internal::bind_scalar(scalar_, h);
   rhs_.bind(h);
 }
 
 template <typename operator_t, typename scalar_t, typename rhs_t>
 PORTBLAS_INLINE void
 ScalarOp<operator_t, scalar_t, rhs_t>::adjust_access_displacement() {
+  internal::adjust_scalar_access_displacement(scalar_);
   rhs_.adjust_access_displacement();
 }
 /*! UnaryOp.
@@ -584,7 +698,9 @@ Rotg<operand_t>::Rotg(operand_t &_a, operand_t &_b, operand_t &_c,
 template <typename operand_t>
 PORTBLAS_INLINE typename Rotg<operand_t>::index_t Rotg<operand_t>::get_size()
     const {
-  return static_cast<Rotg<operand_t>::index_t>(1);
+  // One rotation per element of the views, a single one for rotg and a whole
+  // batch for rotg_batch
+  return a_.get_size();
 }
 
 template <typename operand_t>
@@ -0,0 +1,251 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_batch.hpp
+ *
+ **************************************************************************/
+
+#ifndef GEMV_BATCH_HPP
+#define GEMV_BATCH_HPP
+
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+/*!
+ * @brief Pointer to the first element of the matrix or vector @p batch of a
+ * batch, read from the array of pointers held by @p view or found @p stride
+ * elements apart in the strided batch it spans.
+ */
+template <bool is_pointer_array, typename view_t, typename index_t>
+PORTBLAS_INLINE auto gemv_batch_data(view_t &view, index_t batch,
+                                     index_t stride) {
+  if constexpr (is_pointer_array) {
+    return view.get_pointer()[batch];
+  } else {
+    return view.get_pointer() + batch * stride;
+  }
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed, is_pointer_array>::
+    GemvBatch(lhs_t _lhs, matrix_t _matrix, vector_t _vector, index_t _M,
+              index_t _N, value_t _alpha, index_t _lda, index_t _stride_a,
+              index_t _incx, index_t _stride_x, value_t _beta, index_t _incy,
+              index_t _stride_y, index_t _batch_size,
+              index_t _groups_per_matrix)
+    : lhs_(_lhs),
+      matrix_a_(_matrix),
+      vector_x_(_vector),
+      m_(_M),
+      n_(_N),
+      lda_(_lda),
+      stride_a_(_stride_a),
+      incx_(_incx),
+      stride_x_(_stride_x),
+      incy_(_incy),
+      stride_y_(_stride_y),
+      alpha_(_alpha),
+      beta_(_beta),
+      batch_size_(_batch_size),
+      groups_per_matrix_(_groups_per_matrix) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+PORTBLAS_INLINE typename vector_t::index_t
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed, is_pointer_array>::get_num_groups() const {
+  return ((batch_size_ - 1) / matrices_per_group + 1) * groups_per_matrix_;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+PORTBLAS_INLINE bool
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed,
+          is_pointer_array>::valid_thread(sycl::nd_item<1> ndItem) const {
+  // The last work group may have slices past the end of the batch
+  const index_t batch =
+      (static_cast<index_t>(ndItem.get_group(0)) / groups_per_matrix_) *
+          matrices_per_group +
+      static_cast<index_t>(ndItem.get_local_id(0)) / threads_per_matrix;
+  return batch < batch_size_;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+PORTBLAS_INLINE typename GemvBatch<lhs_t, matrix_t, vector_t, local_range,
+                                   matrices_per_group, dot_split, is_transposed,
+                                   is_pointer_array>::value_t
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed,
+          is_pointer_array>::eval(sycl::nd_item<1> ndItem) {
+  static_assert(dot_split == 1,
+                "Split dot products are reduced in local memory");
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t batch = (group_id / groups_per_matrix_) * matrices_per_group +
+                        local_id / threads_per_matrix;
+  const index_t lane = local_id % threads_per_matrix;
+  const index_t group_in_matrix = group_id % groups_per_matrix_;
+
+  const index_t y_size = is_transposed ? n_ : m_;
+  const index_t dot_size = is_transposed ? m_ : n_;
+  // Distance in A between consecutive rows and columns of op(A)
+  const index_t row_ld = is_transposed ? lda_ : index_t{1};
+  const index_t col_ld = is_transposed ? index_t{1} : lda_;
+  // A negative increment reads the vector backwards from its last element
+  const index_t x_base = (incx_ < 0) ? (1 - dot_size) * incx_ : 0;
+  const index_t y_base = (incy_ < 0) ? (1 - y_size) * incy_ : 0;
+
+  const auto a = gemv_batch_data<is_pointer_array>(matrix_a_, batch, stride_a_);
+  const auto x = gemv_batch_data<is_pointer_array>(vector_x_, batch, stride_x_);
+  auto y = gemv_batch_data<is_pointer_array>(lhs_, batch, stride_y_);
+
+  // The slices of the work groups of a matrix take turns over the rows of
+  // op(A), neighbouring work items reading neighbouring rows
+  const index_t row_step = groups_per_matrix_ * threads_per_matrix;
+  for (index_t row = group_in_matrix * threads_per_matrix + lane; row < y_size;
+       row += row_step) {
+    value_t dot{0};
+    for (index_t k = 0; k < dot_size; ++k) {
+      dot += a[row * row_ld + k * col_ld] * x[x_base + k * incx_];
+    }
+    const index_t y_index = y_base + row * incy_;
+    // y is not read when beta is zero, as it may be uninitialised
+    y[y_index] = (beta_ == value_t{0}) ? alpha_ * dot
+                                       : alpha_ * dot + beta_ * y[y_index];
+  }
+  return {};
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+template <typename local_memory_t>
+PORTBLAS_INLINE typename GemvBatch<lhs_t, matrix_t, vector_t, local_range,
+                                   matrices_per_group, dot_split, is_transposed,
+                                   is_pointer_array>::value_t
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed,
+          is_pointer_array>::eval(local_memory_t local_mem,
+                                  sycl::nd_item<1> ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t batch = (group_id / groups_per_matrix_) * matrices_per_group +
+                        local_id / threads_per_matrix;
+  const index_t lane = local_id % threads_per_matrix;
+  const index_t group_in_matrix = group_id % groups_per_matrix_;
+  // Slices past the end of the batch only take part in the barriers
+  const bool is_valid = batch < batch_size_;
+
+  // Neighbouring work items read neighbouring elements of A: the rows of a
+  // column of op(A), or the columns of a row of the transposed matrix
+  const index_t part = is_transposed ? lane % dot_split : lane / rows_per_pass;
+  const index_t row_in_pass =
+      is_transposed ? lane / dot_split : lane % rows_per_pass;
+  // Distance in local memory between the partial sums of a row
+  const index_t part_ld = is_transposed ? index_t{1} : rows_per_pass;
+
+  const index_t y_size = is_transposed ? n_ : m_;
+  const index_t dot_size = is_transposed ? m_ : n_;
+  // Distance in A between consecutive rows and columns of op(A)
+  const index_t row_ld = is_transposed ? lda_ : index_t{1};
+  const index_t col_ld = is_transposed ? index_t{1} : lda_;
+  // A negative increment reads the vector backwards from its last element
+  const index_t x_base = (incx_ < 0) ? (1 - dot_size) * incx_ : 0;
+  const index_t y_base = (incy_ < 0) ? (1 - y_size) * incy_ : 0;
+
+  const index_t data_batch = is_valid ? batch : index_t{0};
+  const auto a =
+      gemv_batch_data<is_pointer_array>(matrix_a_, data_batch, stride_a_);
+  const auto x =
+      gemv_batch_data<is_pointer_array>(vector_x_, data_batch, stride_x_);
+  auto y = gemv_batch_data<is_pointer_array>(lhs_, data_batch, stride_y_);
+  value_t *scratch = local_mem.localAcc.get_pointer();
+
+  // Every work item of the group runs the same number of passes, as the
+  // slices of a group share group_in_matrix
+  const index_t row_step = groups_per_matrix_ * rows_per_pass;
+  for (index_t first_row = group_in_matrix * rows_per_pass; first_row < y_size;
+       first_row += row_step) {
+    const index_t row = first_row + row_in_pass;
+    const bool has_row = is_valid && row < y_size;
+    value_t dot{0};
+    if (has_row) {
+      for (index_t k = part; k < dot_size; k += dot_split) {
+        dot += a[row * row_ld + k * col_ld] * x[x_base + k * incx_];
+      }
+    }
+    scratch[local_id] = dot;
+    // Tree reduction of the partial sums of each row into its first part
+    for (index_t offset = dot_split / 2; offset > 0; offset /= 2) {
+      ndItem.barrier(sycl::access::fence_space::local_space);
+      if (part < offset) {
+        scratch[local_id] += scratch[local_id + offset * part_ld];
+      }
+    }
+    if (has_row && part == 0) {
+      const index_t y_index = y_base + row * incy_;
+      // y is not read when beta is zero, as it may be uninitialised
+      y[y_index] = (beta_ == value_t{0})
+                       ? alpha_ * scratch[local_id]
+                       : alpha_ * scratch[local_id] + beta_ * y[y_index];
+    }
+    // The partial sums of the next pass overwrite those being read
+    ndItem.barrier(sycl::access::fence_space::local_space);
+  }
+  return {};
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+PORTBLAS_INLINE void
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed, is_pointer_array>::bind(sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t matrices_per_group,
+          uint32_t dot_split, bool is_transposed, bool is_pointer_array>
+PORTBLAS_INLINE void
+GemvBatch<lhs_t, matrix_t, vector_t, local_range, matrices_per_group,
+          dot_split, is_transposed,
+          is_pointer_array>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // GEMV_BATCH_HPP
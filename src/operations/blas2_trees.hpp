@@ -28,6 +28,7 @@
 
 #include "blas2/gbmv.hpp"
 #include "blas2/gemv.hpp"
+#include "blas2/gemv_batch.hpp"
 #include "blas2/ger.hpp"
 #include "blas2/sbmv.hpp"
 #include "blas2/spr.hpp"
@@ -142,6 +142,19 @@ struct SquareOperator : public Operators {
   }
 };
 
+/*!
+ * @brief Converts its operand to out_t, e.g. the elements of a 16-bit vector to
+ * the type the reductions accumulate in (see AccumulatorType).
+ */
+template <typename out_t>
+struct CastOperator : public Operators {
+  using value_t = out_t;
+  template <typename rhs_t>
+  static PORTBLAS_INLINE out_t eval(const rhs_t r) {
+    return static_cast<out_t>(r);
+  }
+};
+
 /*!
  Definitions of binary operators
 */
@@ -182,6 +195,19 @@ struct ProductOperator : public Operators {
   }
 };
 
+/*! StrongZeroProductOperator
+ * @brief Product by a scaling factor where a zero factor gives zero even if
+ * the other operand is NaN or infinite, as BLAS requires for a zero alpha or
+ * beta. Used for the scalars in device memory, whose value is only known by
+ * the kernels (see scalar_product_operator_t).
+ */
+struct StrongZeroProductOperator : public Operators {
+  template <typename lhs_t, typename rhs_t>
+  static PORTBLAS_INLINE rhs_t eval(const lhs_t &l, const rhs_t &r) {
+    return (l == lhs_t{0}) ? rhs_t(lhs_t{0}) : rhs_t(l * r);
+  }
+};
+
 struct DivisionOperator : public Operators {
   template <typename lhs_t, typename rhs_t>
   static PORTBLAS_INLINE rhs_t eval(const lhs_t &l, const rhs_t &r) {
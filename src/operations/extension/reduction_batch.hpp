@@ -0,0 +1,178 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename reduction_batch.hpp
+ *
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_EXTENSION_REDUCTION_BATCH_HPP
+#define PORTBLAS_EXTENSION_REDUCTION_BATCH_HPP
+
+#include "blas_meta.h"
+#include "operations/blas_operators.hpp"
+#include "operations/extension/reduction_batch.h"
+
+namespace blas {
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::Reduction_batch(lhs_t _lhs, rhs_1_t _rhs_1,
+                                          rhs_2_t _rhs_2, index_t _N,
+                                          index_t _inc_1, index_t _stride_1,
+                                          index_t _inc_2, index_t _stride_2,
+                                          index_t _batch_size)
+    : lhs_(_lhs),
+      rhs_1_(_rhs_1),
+      rhs_2_(_rhs_2),
+      n_(_N),
+      inc_1_(_inc_1),
+      stride_1_(_stride_1),
+      inc_2_(_inc_2),
+      stride_2_(_stride_2),
+      batch_size_(_batch_size){};
+
+/*!
+ * @brief Reduces the elements first, first + step, ... of the vector batch,
+ * before the reduction across the work items.
+ */
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+PORTBLAS_INLINE typename lhs_t::value_t
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::partial_reduction(index_t batch, index_t first,
+                                            index_t step) {
+  const index_t n{n_};
+  const auto vx = rhs_1_.get_pointer();
+  value_t val = AddOperator::template init<lhs_t>();
+  if constexpr (reduction == batch_reduction_t::dot) {
+    const auto vy = rhs_2_.get_pointer();
+    // A negative increment reads the vector backwards
+    const index_t x_base =
+        batch * stride_1_ + ((inc_1_ < 0) ? (1 - n) * inc_1_ : 0);
+    const index_t y_base =
+        batch * stride_2_ + ((inc_2_ < 0) ? (1 - n) * inc_2_ : 0);
+    for (index_t i = first; i < n; i += step) {
+      val += vx[x_base + i * inc_1_] * vy[y_base + i * inc_2_];
+    }
+  } else {
+    // The order of the elements does not matter
+    const index_t inc = (inc_1_ < 0) ? -inc_1_ : inc_1_;
+    const index_t x_base = batch * stride_1_;
+    for (index_t i = first; i < n; i += step) {
+      const value_t x = vx[x_base + i * inc];
+      if constexpr (reduction == batch_reduction_t::nrm2) {
+        val += x * x;
+      } else {
+        val += AbsoluteValue::eval(x);
+      }
+    }
+  }
+  return val;
+}
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+PORTBLAS_INLINE typename lhs_t::value_t
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::get_final_value(value_t val) {
+  if constexpr (reduction == batch_reduction_t::nrm2) {
+    return sycl::sqrt(val);
+  } else {
+    return val;
+  }
+}
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+PORTBLAS_INLINE typename lhs_t::value_t
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::eval(sycl::nd_item<1> ndItem) {
+  // The loops over the batch are uniform across the work items reducing a
+  // vector together, as required by the group reductions
+  if constexpr (subGroupPerBatch) {
+    const auto sg = ndItem.get_sub_group();
+    const index_t sg_size = sg.get_local_range()[0];
+    const index_t sg_lid = sg.get_local_id()[0];
+    const index_t sg_per_group = sg.get_group_range()[0];
+    const index_t batch_step = ndItem.get_group_range(0) * sg_per_group;
+    for (index_t batch = ndItem.get_group(0) * sg_per_group +
+                         sg.get_group_id()[0];
+         batch < batch_size_; batch += batch_step) {
+      value_t val = partial_reduction(batch, sg_lid, sg_size);
+      val = sycl::reduce_over_group(sg, val, sycl::plus<value_t>());
+      if (sg_lid == 0) {
+        lhs_.eval(batch) = get_final_value(val);
+      }
+    }
+  } else {
+    const index_t lid = ndItem.get_local_id(0);
+    for (index_t batch = ndItem.get_group(0); batch < batch_size_;
+         batch += ndItem.get_group_range(0)) {
+      value_t val = partial_reduction(batch, lid, localSize);
+      val = sycl::reduce_over_group(ndItem.get_group(), val,
+                                    sycl::plus<value_t>());
+      if (lid == 0) {
+        lhs_.eval(batch) = get_final_value(val);
+      }
+    }
+  }
+  return {};
+}
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+PORTBLAS_INLINE void Reduction_batch<reduction, subGroupPerBatch, localSize,
+                                     lhs_t, rhs_1_t,
+                                     rhs_2_t>::bind(sycl::handler& h) {
+  lhs_.bind(h);
+  rhs_1_.bind(h);
+  rhs_2_.bind(h);
+}
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+PORTBLAS_INLINE void
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_1_.adjust_access_displacement();
+  rhs_2_.adjust_access_displacement();
+}
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+PORTBLAS_INLINE typename rhs_1_t::index_t
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::get_size() const {
+  return n_ * batch_size_;
+}
+
+template <batch_reduction_t reduction, bool subGroupPerBatch, int localSize,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+PORTBLAS_INLINE bool
+Reduction_batch<reduction, subGroupPerBatch, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::valid_thread(sycl::nd_item<1> ndItem) const {
+  return true;
+}
+}  // namespace blas
+
+#endif  // PORTBLAS_EXTENSION_REDUCTION_BATCH_HPP
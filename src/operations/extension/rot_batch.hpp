@@ -0,0 +1,216 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename rot_batch.hpp
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_EXTENSION_ROT_BATCH_HPP
+#define PORTBLAS_EXTENSION_ROT_BATCH_HPP
+
+#include "blas_meta.h"
+#include "operations/blas_constants.h"
+#include "operations/extension/rot_batch.h"
+
+namespace blas {
+
+/*!
+ * @brief Index of the element i of the vector starting at base, a negative
+ * increment reading the vector backwards.
+ */
+template <typename index_t>
+PORTBLAS_INLINE index_t rot_batch_index(index_t base, index_t i, index_t n,
+                                        index_t inc) {
+  return base + ((inc < 0) ? (i + 1 - n) * inc : i * inc);
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::Rot_batch(
+    lhs_1_t _lhs_1, lhs_2_t _lhs_2, rhs_1_t _rhs_1, rhs_2_t _rhs_2, index_t _N,
+    index_t _inc_1, index_t _stride_1, index_t _inc_2, index_t _stride_2,
+    index_t _stride_c, index_t _stride_s, index_t _batch_size)
+    : lhs_1_(_lhs_1),
+      lhs_2_(_lhs_2),
+      rhs_1_(_rhs_1),
+      rhs_2_(_rhs_2),
+      n_(_N),
+      inc_1_(_inc_1),
+      stride_1_(_stride_1),
+      inc_2_(_inc_2),
+      stride_2_(_stride_2),
+      stride_c_(_stride_c),
+      stride_s_(_stride_s),
+      batch_size_(_batch_size){};
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+PORTBLAS_INLINE typename lhs_1_t::value_t
+Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::eval(sycl::nd_item<1> ndItem) {
+  const index_t id = ndItem.get_global_id(0);
+  const index_t batch = id / n_;
+  const index_t i = id - batch * n_;
+  auto vx = lhs_1_.get_pointer();
+  auto vy = lhs_2_.get_pointer();
+  const auto vc = rhs_1_.get_pointer();
+  const auto vs = rhs_2_.get_pointer();
+
+  const index_t x_index = rot_batch_index(batch * stride_1_, i, n_, inc_1_);
+  const index_t y_index = rot_batch_index(batch * stride_2_, i, n_, inc_2_);
+  const value_t c = vc[batch * stride_c_];
+  const value_t s = vs[batch * stride_s_];
+  const value_t x = vx[x_index];
+  const value_t y = vy[y_index];
+  vx[x_index] = c * x + s * y;
+  vy[y_index] = c * y - s * x;
+  return {};
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+PORTBLAS_INLINE void Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::bind(
+    sycl::handler& h) {
+  lhs_1_.bind(h);
+  lhs_2_.bind(h);
+  rhs_1_.bind(h);
+  rhs_2_.bind(h);
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+PORTBLAS_INLINE void Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t,
+                               rhs_2_t>::adjust_access_displacement() {
+  lhs_1_.adjust_access_displacement();
+  lhs_2_.adjust_access_displacement();
+  rhs_1_.adjust_access_displacement();
+  rhs_2_.adjust_access_displacement();
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+PORTBLAS_INLINE typename lhs_1_t::index_t
+Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::get_size() const {
+  return n_ * batch_size_;
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+PORTBLAS_INLINE bool
+Rot_batch<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::valid_thread(
+    sycl::nd_item<1> ndItem) const {
+  return (static_cast<index_t>(ndItem.get_global_id(0)) < get_size());
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+Rotm_batch<lhs_1_t, lhs_2_t, rhs_t>::Rotm_batch(
+    lhs_1_t _lhs_1, lhs_2_t _lhs_2, rhs_t _rhs, index_t _N, index_t _inc_1,
+    index_t _stride_1, index_t _inc_2, index_t _stride_2,
+    index_t _stride_param, index_t _batch_size)
+    : lhs_1_(_lhs_1),
+      lhs_2_(_lhs_2),
+      rhs_(_rhs),
+      n_(_N),
+      inc_1_(_inc_1),
+      stride_1_(_stride_1),
+      inc_2_(_inc_2),
+      stride_2_(_stride_2),
+      stride_param_(_stride_param),
+      batch_size_(_batch_size){};
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+PORTBLAS_INLINE typename lhs_1_t::value_t
+Rotm_batch<lhs_1_t, lhs_2_t, rhs_t>::eval(sycl::nd_item<1> ndItem) {
+  using m_two = constant<value_t, const_val::m_two>;
+  using m_one = constant<value_t, const_val::m_one>;
+  using zero = constant<value_t, const_val::zero>;
+  using one = constant<value_t, const_val::one>;
+
+  const index_t id = ndItem.get_global_id(0);
+  const index_t batch = id / n_;
+  const index_t i = id - batch * n_;
+  const auto param = rhs_.get_pointer();
+  const index_t param_base = batch * stride_param_;
+
+  const value_t flag = param[param_base];
+  if (flag == m_two::value()) {
+    // Identity
+    return {};
+  }
+  value_t h11, h21, h12, h22;
+  if (flag == zero::value()) {
+    h11 = one::value();
+    h21 = param[param_base + 2];
+    h12 = param[param_base + 3];
+    h22 = one::value();
+  } else if (flag == one::value()) {
+    h11 = param[param_base + 1];
+    h21 = m_one::value();
+    h12 = one::value();
+    h22 = param[param_base + 4];
+  } else {
+    h11 = param[param_base + 1];
+    h21 = param[param_base + 2];
+    h12 = param[param_base + 3];
+    h22 = param[param_base + 4];
+  }
+
+  auto vx = lhs_1_.get_pointer();
+  auto vy = lhs_2_.get_pointer();
+  const index_t x_index = rot_batch_index(batch * stride_1_, i, n_, inc_1_);
+  const index_t y_index = rot_batch_index(batch * stride_2_, i, n_, inc_2_);
+  const value_t x = vx[x_index];
+  const value_t y = vy[y_index];
+  vx[x_index] = h11 * x + h12 * y;
+  vy[y_index] = h21 * x + h22 * y;
+  return {};
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+PORTBLAS_INLINE void Rotm_batch<lhs_1_t, lhs_2_t, rhs_t>::bind(
+    sycl::handler& h) {
+  lhs_1_.bind(h);
+  lhs_2_.bind(h);
+  rhs_.bind(h);
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+PORTBLAS_INLINE void
+Rotm_batch<lhs_1_t, lhs_2_t, rhs_t>::adjust_access_displacement() {
+  lhs_1_.adjust_access_displacement();
+  lhs_2_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+PORTBLAS_INLINE typename lhs_1_t::index_t
+Rotm_batch<lhs_1_t, lhs_2_t, rhs_t>::get_size() const {
+  return n_ * batch_size_;
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_t>
+PORTBLAS_INLINE bool Rotm_batch<lhs_1_t, lhs_2_t, rhs_t>::valid_thread(
+    sycl::nd_item<1> ndItem) const {
+  return (static_cast<index_t>(ndItem.get_global_id(0)) < get_size());
+}
+
+}  // namespace blas
+
+#endif  // PORTBLAS_EXTENSION_ROT_BATCH_HPP
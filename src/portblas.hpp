@@ -30,6 +30,8 @@
 
 #include "sb_handle/kernel_constructor.hpp"
 
+#include "sb_handle/fusion.hpp"
+
 #include "interface/blas1_interface.hpp"
 
 #include "interface/blas2_interface.hpp"
@@ -53,6 +55,8 @@
 #include "operations/extension/matcopy_batch.hpp"
 
 #include "operations/extension/axpy_batch.hpp"
+#include "operations/extension/reduction_batch.hpp"
+#include "operations/extension/rot_batch.hpp"
 
 #include "operations/blas_constants.hpp"
 
@@ -0,0 +1,293 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename fusion.hpp
+ *
+ **************************************************************************/
+
+#ifndef PORTBLAS_FUSION_HPP
+#define PORTBLAS_FUSION_HPP
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "sb_handle/fusion.h"
+
+namespace blas {
+namespace fusion {
+
+namespace internal {
+/*!
+ * @brief Detects whether a ScalarOp operand is an expression (e.g. a view
+ * holding the scalar) rather than a plain value.
+ */
+template <typename scalar_t, typename = void>
+struct is_expression : std::false_type {};
+
+template <typename scalar_t>
+struct is_expression<scalar_t, std::void_t<typename scalar_t::index_t>>
+    : std::true_type {};
+
+/*!
+ * @brief Lowest and highest element offsets touched by a strided view,
+ * relative to its start element.
+ */
+inline std::pair<std::ptrdiff_t, std::ptrdiff_t> element_span(
+    const view_access_t &a) {
+  const std::ptrdiff_t last = (a.size > 0 ? a.size - 1 : 0) * a.stride;
+  return {std::min<std::ptrdiff_t>(0, last), std::max<std::ptrdiff_t>(0, last)};
+}
+
+inline bool may_alias(const view_access_t &a, const view_access_t &b) {
+  if (a.is_usm != b.is_usm) {
+    return false;
+  }
+  if (!a.is_usm) {
+    // Buffer views cannot be told apart on the host
+    return true;
+  }
+  const auto span_a = element_span(a);
+  const auto span_b = element_span(b);
+  const std::uintptr_t lo_a =
+      a.base + span_a.first * static_cast<std::ptrdiff_t>(a.elem_size);
+  const std::uintptr_t hi_a =
+      a.base + (span_a.second + 1) * static_cast<std::ptrdiff_t>(a.elem_size);
+  const std::uintptr_t lo_b =
+      b.base + span_b.first * static_cast<std::ptrdiff_t>(b.elem_size);
+  const std::uintptr_t hi_b =
+      b.base + (span_b.second + 1) * static_cast<std::ptrdiff_t>(b.elem_size);
+  return lo_a < hi_b && lo_b < hi_a;
+}
+
+/*!
+ * @brief Two views with the same access pattern touch the same element for
+ * the same global index, so a write followed by a read in the same work item
+ * keeps the sequential semantics.
+ */
+inline bool same_pattern(const view_access_t &a, const view_access_t &b) {
+  return a.is_usm == b.is_usm && a.base == b.base && a.stride == b.stride &&
+         a.size == b.size && a.elem_size == b.elem_size;
+}
+}  // namespace internal
+
+/*!
+ * @brief Fallback for nodes whose accesses are unknown.
+ */
+template <typename tree_t>
+void collect_access(const tree_t &, tree_footprint_t &footprint, bool) {
+  footprint.opaque = true;
+}
+
+/*!
+ * @brief USM vector view.
+ */
+template <typename container_t, typename index_t, typename increment_t>
+void collect_access(const VectorView<container_t, index_t, increment_t> &view,
+                    tree_footprint_t &footprint, bool write) {
+  using value_t =
+      typename VectorView<container_t, index_t, increment_t>::value_t;
+  if constexpr (std::is_pointer<container_t>::value) {
+    footprint.accesses.push_back(
+        {true, reinterpret_cast<std::uintptr_t>(view.ptr_),
+         static_cast<std::ptrdiff_t>(view.strd_),
+         static_cast<std::ptrdiff_t>(view.size_), sizeof(value_t), write});
+  } else {
+    footprint.opaque = true;
+  }
+}
+
+/*!
+ * @brief Buffer (accessor) vector view.
+ */
+template <typename scalar_t, int dim, sycl::access_mode acc_mode_t,
+          sycl::target access_t, sycl::access::placeholder place_holder_t,
+          typename index_t, typename increment_t>
+void collect_access(
+    const VectorView<sycl::accessor<scalar_t, dim, acc_mode_t, access_t,
+                                    place_holder_t>,
+                     index_t, increment_t> &view,
+    tree_footprint_t &footprint, bool write) {
+  footprint.accesses.push_back(
+      {false, static_cast<std::uintptr_t>(view.disp_),
+       static_cast<std::ptrdiff_t>(view.stride_),
+       static_cast<std::ptrdiff_t>(view.size_), sizeof(scalar_t), write});
+}
+
+template <typename lhs_t, typename rhs_t>
+void collect_access(const Join<lhs_t, rhs_t> &tree,
+                    tree_footprint_t &footprint, bool write) {
+  collect_access(tree.lhs_, footprint, write);
+  collect_access(tree.rhs_, footprint, write);
+}
+
+template <typename lhs_t, typename rhs_t>
+void collect_access(const Assign<lhs_t, rhs_t> &tree,
+                    tree_footprint_t &footprint, bool) {
+  collect_access(tree.lhs_, footprint, true);
+  collect_access(tree.rhs_, footprint, false);
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+void collect_access(
+    const DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t> &tree,
+    tree_footprint_t &footprint, bool) {
+  collect_access(tree.lhs_1_, footprint, true);
+  collect_access(tree.lhs_2_, footprint, true);
+  collect_access(tree.rhs_1_, footprint, false);
+  collect_access(tree.rhs_2_, footprint, false);
+}
+
+template <typename operator_t, typename scalar_t, typename rhs_t>
+void collect_access(const ScalarOp<operator_t, scalar_t, rhs_t> &tree,
+                    tree_footprint_t &footprint, bool write) {
+  // A scalar read from memory is broadcast to every work item, which does
+  // not follow the element-wise pattern the fusion relies on.
+  if (internal::is_expression<scalar_t>::value) {
+    footprint.opaque = true;
+  }
+  collect_access(tree.rhs_, footprint, write);
+}
+
+template <typename operator_t, typename rhs_t>
+void collect_access(const UnaryOp<operator_t, rhs_t> &tree,
+                    tree_footprint_t &footprint, bool write) {
+  collect_access(tree.rhs_, footprint, write);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+void collect_access(const BinaryOp<operator_t, lhs_t, rhs_t> &tree,
+                    tree_footprint_t &footprint, bool write) {
+  collect_access(tree.lhs_, footprint, write);
+  collect_access(tree.rhs_, footprint, write);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+void collect_access(const BinaryOpConst<operator_t, lhs_t, rhs_t> &tree,
+                    tree_footprint_t &footprint, bool write) {
+  collect_access(tree.lhs_, footprint, write);
+  collect_access(tree.rhs_, footprint, write);
+}
+
+template <typename rhs_t>
+void collect_access(const TupleOp<rhs_t> &tree, tree_footprint_t &footprint,
+                    bool write) {
+  collect_access(tree.rhs_, footprint, write);
+}
+
+namespace internal {
+template <typename tree_t>
+struct is_fused_op : std::false_type {};
+
+template <typename lhs_t, typename rhs_t>
+struct is_fused_op<FusedOp<lhs_t, rhs_t>> : std::true_type {};
+
+/*!
+ * @brief Builds the right-leaning FusedOp chain evaluating @p trees in order.
+ */
+template <typename tree_t>
+inline tree_t make_fused_chain(tree_t tree) {
+  return tree;
+}
+
+template <typename first_t, typename second_t, typename... rest_t>
+inline auto make_fused_chain(first_t first, second_t second, rest_t... rest) {
+  auto tail = make_fused_chain(second, rest...);
+  return FusedOp<first_t, decltype(tail)>(first, tail);
+}
+
+/*!
+ * @brief Enables the trees of the chain for which @p mask is true.
+ */
+template <typename tree_t>
+inline void set_fused_mask(tree_t &, const bool *) {}
+
+template <typename lhs_t, typename rhs_t>
+inline void set_fused_mask(FusedOp<lhs_t, rhs_t> &tree, const bool *mask) {
+  tree.lhs_active_ = mask[0];
+  if constexpr (is_fused_op<rhs_t>::value) {
+    tree.rhs_active_ = true;
+    set_fused_mask(tree.rhs_, mask + 1);
+  } else {
+    tree.rhs_active_ = mask[1];
+  }
+}
+}  // namespace internal
+
+template <typename tree_t>
+tree_footprint_t make_footprint(const tree_t &tree) {
+  tree_footprint_t footprint;
+  collect_access(tree, footprint, false);
+  return footprint;
+}
+
+inline bool has_hazard(const tree_footprint_t &first,
+                       const tree_footprint_t &second) {
+  if (first.opaque || second.opaque) {
+    return true;
+  }
+  for (const auto &a : first.accesses) {
+    for (const auto &b : second.accesses) {
+      if ((a.write || b.write) && internal::may_alias(a, b) &&
+          !internal::same_pattern(a, b)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace fusion
+
+template <typename... trees_t>
+Lazy_Fusion<trees_t...>::Lazy_Fusion(
+    SB_Handle &sb_handle, std::tuple<trees_t...> trees,
+    const typename Lazy_Fusion<trees_t...>::event_t &dependencies)
+    : sb_handle_(sb_handle), trees_(trees), dependencies_(dependencies) {}
+
+template <typename... trees_t>
+template <typename tree_t>
+Lazy_Fusion<trees_t..., tree_t> Lazy_Fusion<trees_t...>::defer(
+    tree_t tree,
+    const typename Lazy_Fusion<trees_t...>::event_t &dependencies) const {
+  return Lazy_Fusion<trees_t..., tree_t>(
+      sb_handle_, std::tuple_cat(trees_, std::make_tuple(tree)),
+      concatenate_vectors(dependencies_, dependencies));
+}
+
+template <typename... trees_t>
+typename Lazy_Fusion<trees_t...>::event_t Lazy_Fusion<trees_t...>::flush()
+    const {
+  if constexpr (sizeof...(trees_t) == 0) {
+    return dependencies_;
+  } else {
+    return std::apply(
+        [&](auto... trees) {
+          return sb_handle_.execute_fused(dependencies_, trees...);
+        },
+        trees_);
+  }
+}
+
+}  // namespace blas
+
+#endif  // PORTBLAS_FUSION_HPP
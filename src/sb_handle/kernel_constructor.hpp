@@ -183,10 +183,24 @@ struct ExpressionTreeFunctor {
   }
 };
 
+/*! ExpressionTreeKernel.
+@brief Type of the functor submitted by execute_tree for a tree, which is also
+the name of the SYCL kernel.
+@tparam int using_local_memory  specifying whether shared memory is enabled.
+@tparam expression Tree Type of the tree.
+*/
+template <int using_local_memory, typename expression_tree_t>
+using ExpressionTreeKernel = ExpressionTreeFunctor<
+    using_local_memory, expression_tree_t,
+    LocalMemory<
+        typename LocalMemoryType<using_local_memory, expression_tree_t>::type,
+        using_local_memory>,
+    typename LocalMemoryType<using_local_memory, expression_tree_t>::type>;
+
 template <int using_local_memory, typename queue_t, typename expression_tree_t>
 static PORTBLAS_INLINE sycl::event execute_tree(
     queue_t q_, expression_tree_t t, size_t _localSize, size_t _globalSize,
-    size_t _shMem, std::vector<sycl::event> dependencies) {
+    size_t _shMem, const event_vector_t& dependencies) {
   using value_t =
       typename LocalMemoryType<using_local_memory, expression_tree_t>::type;
 
@@ -195,8 +209,12 @@ static PORTBLAS_INLINE sycl::event execute_tree(
   auto shMem = _shMem;
   sycl::event ev;
   try {
-    auto cg1 = [=](sycl::handler &h) mutable {
-      h.depends_on(dependencies);
+    // The command group function is run by submit, so the dependencies can be
+    // captured by reference
+    auto cg1 = [=, &dependencies](sycl::handler &h) mutable {
+      for (const auto &dep : dependencies) {
+        h.depends_on(dep);
+      }
       t.bind(h);
       auto scratch = LocalMemory<value_t, using_local_memory>(shMem, h);
 
@@ -204,8 +222,8 @@ static PORTBLAS_INLINE sycl::event execute_tree(
           sycl::range<1>{globalSize}, sycl::range<1>{localSize}};
       h.parallel_for(
           gridConfiguration,
-          ExpressionTreeFunctor<using_local_memory, expression_tree_t,
-                                decltype(scratch), value_t>(scratch, t));
+          ExpressionTreeKernel<using_local_memory, expression_tree_t>(scratch,
+                                                                      t));
     };
 
     ev = q_.submit(cg1);
@@ -27,6 +27,7 @@
 #define PORTBLAS_HANDLE_HPP
 
 #include <algorithm>
+#include <array>
 
 #include "blas_meta.h"
 #include "operations/blas1_trees.hpp"
@@ -34,6 +35,7 @@
 #include "operations/blas_operators.hpp"
 #include "portblas_helper.h"
 #include "sb_handle/kernel_constructor.h"
+#include "sb_handle/fusion.hpp"
 #include "sb_handle/portblas_handle.h"
 #include "sb_handle/temp_memory_pool.hpp"
 #include "views/view.h"
@@ -44,11 +46,11 @@ typename std::enable_if<
     alloc == helper::AllocType::buffer,
     typename helper::AllocHelper<value_t, alloc>::type>::type
 SB_Handle::acquire_temp_mem(size_t size) {
-#ifndef __ADAPTIVECPP__
+  if (workspace_ != nullptr)
+    return workspace_->template acquire<alloc, value_t>(size);
   if (tempMemPool_ != nullptr)
     return tempMemPool_->acquire_buff_mem<value_t>(size);
   else
-#endif
     return make_sycl_iterator_buffer<value_t>(size);
 }
 
@@ -60,11 +62,19 @@ typename std::enable_if<
     typename SB_Handle::event_t>::type
 SB_Handle::release_temp_mem(const typename SB_Handle::event_t& dependencies,
                             const container_t& mem) {
-#ifndef __ADAPTIVECPP__
+  if (workspace_ != nullptr) {
+    // Owned by the caller
+    return {};
+  }
+  if (plan_ != nullptr && tempMemPool_ != nullptr) {
+    // The captured kernels keep using the memory until the plan is destroyed
+    auto pool = tempMemPool_;
+    plan_->defer_release([pool, mem]() { pool->reclaim_buff_mem(mem); });
+    return {};
+  }
   if (tempMemPool_ != nullptr)
     return tempMemPool_->release_buff_mem(dependencies, mem);
   else
-#endif
     return {};
 }
 
@@ -74,10 +84,14 @@ typename std::enable_if<
     alloc == helper::AllocType::usm,
     typename helper::AllocHelper<value_t, alloc>::type>::type
 SB_Handle::acquire_temp_mem(size_t size) {
+  if (workspace_ != nullptr)
+    return workspace_->template acquire<alloc, value_t>(size);
   if (tempMemPool_ != nullptr)
     return tempMemPool_->acquire_usm_mem<value_t>(size);
-  else
+  else {
+    pendingFrees_->poll([this](void* mem) { sycl::free(mem, q_); });
     return sycl::malloc_device<value_t>(size, q_);
+  }
 }
 
 template <typename container_t>
@@ -88,18 +102,86 @@ typename std::enable_if<
     typename SB_Handle::event_t>::type
 SB_Handle::release_temp_mem(const typename SB_Handle::event_t& dependencies,
                             const container_t& mem) {
+  if (workspace_ != nullptr) {
+    // Owned by the caller
+    return {};
+  }
+  if (plan_ != nullptr) {
+    // The captured kernels keep using the memory until the plan is destroyed
+    auto pool = tempMemPool_;
+    sycl::context context = q_.get_context();
+    plan_->defer_release([pool, mem, context]() {
+      if (pool != nullptr)
+        pool->reclaim_usm_mem(mem);
+      else
+        sycl::free(mem, context);
+    });
+    return {};
+  }
   if (tempMemPool_ != nullptr)
     return tempMemPool_->release_usm_mem(dependencies, mem);
   else {
-    sycl::context context = q_.get_context();
-    return {q_.submit([&](sycl::handler& cgh) {
-      cgh.depends_on(dependencies);
-      cgh.host_task([=]() { sycl::free(mem, context); });
-    })};
+    // Freed by a later call once the commands are complete
+    if (dependencies.empty()) {
+      sycl::free(mem, q_);
+    } else {
+      pendingFrees_->push(mem, dependencies);
+    }
+    return {};
   }
 }
 #endif
 
+template <int using_local_memory, typename expression_tree_t>
+inline sycl::event SB_Handle::submit_tree(
+    expression_tree_t tree, size_t localSize, size_t globalSize, size_t shMem,
+    const typename SB_Handle::event_t& dependencies) {
+  if (warmup_ != nullptr) {
+    warmup_->template record<
+        ExpressionTreeKernel<using_local_memory, expression_tree_t>>();
+  }
+  if (is_workspace_query()) {
+    return {};
+  }
+  const auto& deps = effective_dependencies(dependencies);
+  auto event = execute_tree<using_local_memory>(q_, tree, localSize, globalSize,
+                                                shMem, deps);
+  record_submitted(event);
+  if (plan_ != nullptr && plan_->records_command_groups()) {
+    plan_->record(
+        [=](queue_t q, const event_t& replay_deps) {
+          return execute_tree<using_local_memory>(
+              q, tree, localSize, globalSize, shMem, replay_deps);
+        },
+        deps, event);
+  }
+  if (trace_ != nullptr) {
+    trace_->record<expression_tree_t>(traceCall_, globalSize, localSize, shMem,
+                                      event);
+  }
+  return event;
+}
+
+template <typename container_t>
+inline typename SB_Handle::event_t SB_Handle::fill(
+    container_t container, typename ValueType<container_t>::type value,
+    size_t size, const typename SB_Handle::event_t& dependencies) {
+  if (is_workspace_query()) {
+    return {};
+  }
+  const auto& deps = effective_dependencies(dependencies);
+  auto event = helper::fill(q_, container, value, size, deps);
+  record_submitted(event);
+  if (plan_ != nullptr && plan_->records_command_groups()) {
+    plan_->record(
+        [=](queue_t q, const event_t& replay_deps) {
+          return helper::fill(q, container, value, size, replay_deps);
+        },
+        deps, event);
+  }
+  return {event};
+}
+
 /*!
  * @brief Executes the tree without defining required shared memory.
  */
@@ -111,8 +193,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
 
-  return {execute_tree<using_local_memory::disabled>(
-      get_queue(), t, localSize, globalSize, 0, dependencies)};
+  return {submit_tree<using_local_memory::disabled>(
+      t, localSize, globalSize, 0, dependencies)};
 };
 
 /*!
@@ -126,8 +208,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   auto _N = t.get_size();
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
-  return {execute_tree<using_local_memory::disabled>(
-      q_, t, localSize, globalSize, 0, dependencies)};
+  return {submit_tree<using_local_memory::disabled>(
+      t, localSize, globalSize, 0, dependencies)};
 };
 
 /*!
@@ -138,8 +220,8 @@ template <typename expression_tree_t, typename index_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     expression_tree_t t, index_t localSize, index_t globalSize,
     const typename SB_Handle::event_t& dependencies) {
-  return {execute_tree<using_local_memory::disabled>(
-      q_, t, localSize, globalSize, 0, dependencies)};
+  return {submit_tree<using_local_memory::disabled>(
+      t, localSize, globalSize, 0, dependencies)};
 }
 
 /*!
@@ -150,8 +232,65 @@ template <typename expression_tree_t, typename index_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     expression_tree_t t, index_t localSize, index_t globalSize, index_t shMem,
     const typename SB_Handle::event_t& dependencies) {
-  return {execute_tree<using_local_memory::enabled>(
-      q_, t, localSize, globalSize, shMem, dependencies)};
+  return {submit_tree<using_local_memory::enabled>(
+      t, localSize, globalSize, shMem, dependencies)};
+}
+
+/*!
+ * @brief Executes a group of element-wise trees in as few kernels as possible.
+ * The trees are split in consecutive stages: a tree joins the current stage
+ * unless one of the views it accesses may alias a view of the stage with a
+ * different access pattern (see fusion::has_hazard). All the trees are
+ * compiled into a single FusedOp chain and each stage enables its own trees.
+ */
+template <typename... expression_tree_t>
+inline typename SB_Handle::event_t SB_Handle::execute_fused(
+    const typename SB_Handle::event_t& dependencies,
+    expression_tree_t... trees) {
+  constexpr std::size_t num_trees = sizeof...(expression_tree_t);
+  static_assert(num_trees > 0, "execute_fused requires at least one tree");
+  if constexpr (num_trees == 1) {
+    return execute(trees..., dependencies);
+  } else {
+    const std::array<fusion::tree_footprint_t, num_trees> footprints{
+        fusion::make_footprint(trees)...};
+    const std::array<std::size_t, num_trees> sizes{
+        static_cast<std::size_t>(trees.get_size())...};
+    auto fused_tree = fusion::internal::make_fused_chain(trees...);
+    const auto localSize = get_work_group_size();
+
+    typename SB_Handle::event_t events;
+    typename SB_Handle::event_t stage_dependencies = dependencies;
+    std::size_t first = 0;
+    while (first < num_trees) {
+      std::size_t last = first + 1;
+      bool fusible = true;
+      while (fusible && last < num_trees) {
+        for (std::size_t k = first; fusible && k < last; ++k) {
+          fusible = !fusion::has_hazard(footprints[k], footprints[last]);
+        }
+        last += fusible ? 1 : 0;
+      }
+
+      std::array<bool, num_trees> mask{};
+      std::size_t stage_size = 0;
+      for (std::size_t k = first; k < last; ++k) {
+        mask[k] = true;
+        stage_size = std::max(stage_size, sizes[k]);
+      }
+      first = last;
+      if (stage_size == 0) {
+        continue;
+      }
+      fusion::internal::set_fused_mask(fused_tree, mask.data());
+      const auto globalSize = roundUp(stage_size, localSize);
+      auto event = submit_tree<using_local_memory::disabled>(
+          fused_tree, localSize, globalSize, 0, stage_dependencies);
+      events.push_back(event);
+      stage_dependencies = {event};
+    }
+    return events.empty() ? dependencies : events;
+  }
 }
 
 /*!
@@ -171,10 +310,40 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   auto nWG = (t.global_num_thread_ + (2 * localSize) - 1) / (2 * localSize);
   auto lhs = t.lhs_;
   auto rhs = t.rhs_;
+  constexpr bool is_usm = std::is_pointer<typename lhs_t::container_t>::value;
+
+  if (singlePassReduction_ && nWG > 1) {
+    // A single kernel: each work group writes its partial result and the last
+    // one to finish, counted with the ticket, reduces them into lhs
+    constexpr auto alloc_type =
+        is_usm ? helper::AllocType::usm : helper::AllocType::buffer;
+    auto partials = acquire_temp_mem<alloc_type, typename lhs_t::value_t>(nWG);
+    auto ticket = acquire_temp_mem<alloc_type, unsigned int>(1);
+    auto opPartials =
+        make_vector_view(partials, typename lhs_t::increment_t(1), nWG);
+    auto opTicket = make_vector_view(ticket, typename lhs_t::increment_t(1),
+                                     typename rhs_t::index_t(1));
+    typename SB_Handle::event_t event;
+    if (!is_workspace_query()) {
+      // The kernel leaves the ticket at zero, so that it is only reset once
+      // per call and not when replaying an Execution_Plan
+      event.push_back(helper::fill(q_, ticket, 0u, 1,
+                                   effective_dependencies(dependencies)));
+      record_submitted(event.back());
+    }
+    auto globalSize = nWG * localSize;
+    auto localTree = make_single_pass_reduction<operator_t, is_usm>(
+        lhs, rhs, opPartials, opTicket, localSize, globalSize);
+    event = {submit_tree<using_local_memory::enabled>(
+        localTree, localSize, globalSize, localSize,
+        event.empty() ? dependencies : event)};
+    release_temp_mem(event, partials);
+    release_temp_mem(event, ticket);
+    return event;
+  }
 
   // Two accessors to local memory
   auto sharedSize = ((nWG < localSize) ? localSize : nWG);
-  constexpr bool is_usm = std::is_pointer<typename lhs_t::container_t>::value;
   auto shMem1 = acquire_temp_mem < is_usm ? helper::AllocType::usm
                                           : helper::AllocType::buffer,
        typename lhs_t::value_t > (sharedSize);
@@ -195,15 +364,15 @@ inline typename SB_Handle::event_t SB_Handle::execute(
       // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
       auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
                                          localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, dependencies));
+      event.push_back(submit_tree<using_local_memory::enabled>(
+          localTree, localSize, globalSize, sharedSize, dependencies));
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
       auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
           ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
           (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, event));
+      event.push_back(submit_tree<using_local_memory::enabled>(
+          localTree, localSize, globalSize, sharedSize, event));
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
@@ -215,6 +384,10 @@ inline typename SB_Handle::event_t SB_Handle::execute(
 
   release_temp_mem({*event.rbegin()}, shMem2);
 
+  if (inOrderFastPath_) {
+    // Only the last pass needs to be waited for on an in-order queue
+    return {*event.rbegin()};
+  }
   return event;
 }
 
@@ -251,15 +424,15 @@ inline typename SB_Handle::event_t SB_Handle::execute(
       // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
       auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
                                          localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, dependencies));
+      event.push_back(submit_tree<using_local_memory::enabled>(
+          localTree, localSize, globalSize, sharedSize, dependencies));
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
       auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
           ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
           (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, dependencies));
+      event.push_back(submit_tree<using_local_memory::enabled>(
+          localTree, localSize, globalSize, sharedSize, dependencies));
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
@@ -286,10 +459,10 @@ inline typename SB_Handle::event_t SB_Handle::execute(
                       is_beta_zero, GemmMemoryType, GemmAlgorithm,
                       GemmVectorization, VectorSize, BatchType, UseJointMatrix>;
   auto rng = gemm_tree.get_nd_range(SB_Handle::get_num_compute_units());
-  return {execute_tree<
+  return {submit_tree<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
              using_local_memory::enabled, using_local_memory::disabled>::type>(
-      q_, gemm_tree, rng.get_local_range()[0], rng.get_global_range()[0],
+      gemm_tree, rng.get_local_range()[0], rng.get_global_range()[0],
       gemm_t::local_memory_size, dependencies)};
 }
 
@@ -365,7 +538,7 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   if (is_beta_zero && ldc == rows) {
     Reduction<blas::AddOperator, params_t, CubeType, output_t> reduction(
         cube_reduction, gemm_wrapper.c_);
-    events = concatenate_vectors(events, execute(reduction, events));
+    events = chain_events(events, execute(reduction, events));
   }
   /* Otherwise we reduce to a temporary buffer */
   else {
@@ -378,12 +551,12 @@ inline typename SB_Handle::event_t SB_Handle::execute(
     /* Execute the reduction */
     Reduction<blas::AddOperator, params_t, CubeType, output_t> reduction(
         cube_reduction, temp);
-    events = concatenate_vectors(events, execute(reduction, events));
+    events = chain_events(events, execute(reduction, events));
 
     /* If beta is zero, simply do a 2D copy from the temp buffer to C */
     if (is_beta_zero) {
       auto assignOp = make_op<Assign>(gemm_wrapper.c_, temp);
-      events = concatenate_vectors(events, execute(assignOp, events));
+      events = chain_events(events, execute(assignOp, events));
     }
     /* Else add temp and beta * C and then assign to C */
     else {
@@ -391,7 +564,7 @@ inline typename SB_Handle::event_t SB_Handle::execute(
                                                        gemm_wrapper.c_);
       auto addOp = make_op<BinaryOp, AddOperator>(temp, scalOp);
       auto assignOp = make_op<Assign>(gemm_wrapper.c_, addOp);
-      events = concatenate_vectors(events, execute(assignOp, events));
+      events = chain_events(events, execute(assignOp, events));
     }
 
     release_temp_mem(events, temp_buffer);
@@ -413,10 +586,10 @@ inline typename SB_Handle::event_t SB_Handle::execute(
     const typename SB_Handle::event_t& dependencies) {
   auto gemm_partial_range =
       gemm_partial.get_nd_range(SB_Handle::get_num_compute_units());
-  return {execute_tree<
+  return {submit_tree<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
              using_local_memory::enabled, using_local_memory::disabled>::type>(
-      q_, gemm_partial, gemm_partial_range.get_local_range()[0],
+      gemm_partial, gemm_partial_range.get_local_range()[0],
       gemm_partial_range.get_global_range()[0], gemm_partial.local_memory_size,
       dependencies)};
 }
@@ -429,8 +602,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
     const typename SB_Handle::event_t& dependencies) {
   auto step_range = reduction.get_nd_range(SB_Handle::get_num_compute_units());
 
-  return {execute_tree<using_local_memory::enabled>(
-      q_, reduction, step_range.get_local_range()[0],
+  return {submit_tree<using_local_memory::enabled>(
+      reduction, step_range.get_local_range()[0],
       step_range.get_global_range()[0], params_t::get_local_memory_size(),
       dependencies)};
 }
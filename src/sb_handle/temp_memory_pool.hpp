@@ -1,106 +1,171 @@
 #ifndef TEMP_MEMORY_POOL_HPP
 #define TEMP_MEMORY_POOL_HPP
-#ifndef __ADAPTIVECPP__
 #include "portblas_helper.h"
 
 namespace blas {
+inline void Temp_Mem_Pool::reserve_bytes_(size_t byte_size) {
+  if (allocated_bytes_.fetch_add(byte_size) + byte_size >
+      config_.max_allocated_bytes) {
+    allocated_bytes_ -= byte_size;
+    trim();
+    const size_t allocated = allocated_bytes_;
+    if (allocated + byte_size > config_.max_allocated_bytes) {
+      trim_lru_(clock_t::time_point::max(),
+                allocated + byte_size - config_.max_allocated_bytes);
+    }
+    if (allocated_bytes_.fetch_add(byte_size) + byte_size >
+        config_.max_allocated_bytes) {
+      allocated_bytes_ -= byte_size;
+      throw std::bad_alloc();
+    }
+  }
+  size_t high_water_mark = high_water_mark_;
+  const size_t allocated = allocated_bytes_;
+  while (allocated > high_water_mark &&
+         !high_water_mark_.compare_exchange_weak(high_water_mark, allocated)) {
+  }
+}
+
+inline void Temp_Mem_Pool::record_acquire_(clock_t::time_point start,
+                                           bool hit) {
+  const uint64_t ns = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() -
+                                                           start)
+          .count());
+  (hit ? hits_ : misses_)++;
+  acquire_ns_ += ns;
+  uint64_t max_ns = max_acquire_ns_;
+  while (ns > max_ns && !max_acquire_ns_.compare_exchange_weak(max_ns, ns)) {
+  }
+}
+
 template <typename value_t>
 typename helper::AllocHelper<value_t, helper::AllocType::buffer>::type
 Temp_Mem_Pool::acquire_buff_mem(size_t size) {
-  const size_t pad = sizeof(double) / sizeof(value_t);
-  // Adjust the requested size in order to reinterpret for double's
-  size += (pad - size % pad);
-  const size_t byteSize = size * sizeof(value_t);
-  temp_buffer_map_mutex_.lock();  // lock
-  auto found = temp_buffer_map_.lower_bound(byteSize);
-  if (found != temp_buffer_map_.end()) {
-    sycl::buffer<temp_buffer_map_t::mapped_type::value_type, 1> buff =
-        found->second;
-    temp_buffer_map_tot_byte_size_ -= found->first;
-    temp_buffer_map_.erase(found);
-    temp_buffer_map_mutex_.unlock();  // unlock
-    return blas::BufferIterator<value_t>{buff.reinterpret<value_t>(
-        sycl::range<1>(buff.byte_size() / sizeof(value_t)))};
-  } else {
-    temp_buffer_map_mutex_.unlock();  // unlock
+  const size_t byteSize = std::max<size_t>(size * sizeof(value_t), 1);
+  const size_t sizeClass = buffer_arena_t::size_class(byteSize);
+  const size_t classByteSize = buffer_arena_t::class_byte_size(sizeClass);
+  if (classByteSize % sizeof(value_t) != 0) {
+    // The pooled buffers cannot be reinterpreted to this type
+    return make_sycl_iterator_buffer<value_t>(size);
+  }
+  const auto start = clock_t::now();
+  pending_buffers_.poll([this](temp_buffer_t buff) { reclaim_buffer_(buff); });
+  auto buff = buffer_arena_.acquire(sizeClass);
+  const bool hit = buff.has_value();
+  if (!hit) {
 #ifdef VERBOSE
-    std::cout << "Create a temporary buffer of " << byteSize << " bytes."
+    std::cout << "Create a temporary buffer of " << classByteSize << " bytes."
               << std::endl;
 #endif
-    return make_sycl_iterator_buffer<value_t>(size);
+    reserve_bytes_(classByteSize);
+    buff.emplace(sycl::range<1>(classByteSize));
   }
+  record_acquire_(start, hit);
+  return blas::BufferIterator<value_t>{buff->template reinterpret<value_t>(
+      sycl::range<1>(classByteSize / sizeof(value_t)))};
 }
 
-template <typename container_t>
-void Temp_Mem_Pool::release_buff_mem_(const container_t& mem) {
-  const size_t byteSize = mem.get_buffer().byte_size();
-  auto rebuff =
-      mem.get_buffer()
-          .template reinterpret<temp_buffer_map_t::mapped_type::value_type>(
-              sycl::range<1>(
-                  byteSize /
-                  sizeof(temp_buffer_map_t::mapped_type::value_type)));
-  temp_buffer_map_mutex_.lock();  // lock
-  if (temp_buffer_map_tot_byte_size_ + byteSize <= max_size_temp_mem_) {
-    temp_buffer_map_tot_byte_size_ += byteSize;
-    temp_buffer_map_.emplace(byteSize, rebuff);
+inline void Temp_Mem_Pool::reclaim_buffer_(temp_buffer_t buff) {
+  const size_t byteSize = buff.byte_size();
+  const size_t sizeClass = buffer_arena_t::size_class(byteSize);
+  if (buffer_arena_t::class_byte_size(sizeClass) != byteSize) {
+    // Not allocated by the pool
+    return;
+  }
+  if (!buffer_arena_.release(sizeClass, buff)) {
+    // Dropped, the pool is full
+    allocated_bytes_ -= byteSize;
+    trimmed_bytes_ += byteSize;
   }
-  temp_buffer_map_mutex_.unlock();  // unlock
 }
 
 template <typename container_t>
 typename Temp_Mem_Pool::event_t Temp_Mem_Pool::release_buff_mem(
     const typename Temp_Mem_Pool::event_t& dependencies,
     const container_t& mem) {
-  return {q_.submit([&](sycl::handler& cgh) {
-    cgh.depends_on(dependencies);
-    cgh.host_task([&, mem]() { release_buff_mem_(mem); });
-  })};
+  if (dependencies.empty()) {
+    reclaim_buff_mem(mem);
+  } else {
+    pending_buffers_.push(
+        mem.get_buffer().template reinterpret<temp_buffer_t::value_type>(
+            sycl::range<1>(mem.get_buffer().byte_size() /
+                           sizeof(temp_buffer_t::value_type))),
+        dependencies);
+  }
+  return {};
 }
 
 #ifdef SB_ENABLE_USM
-template <typename value_t>
-typename helper::AllocHelper<value_t, helper::AllocType::usm>::type
-Temp_Mem_Pool::acquire_usm_mem(size_t size) {
-  const size_t byteSize = size * sizeof(value_t);
-  temp_usm_map_mutex_.lock();  // lock
-  auto found = temp_usm_map_.lower_bound(byteSize);
-  if (found != temp_usm_map_.end()) {
-    temp_usm_map_tot_byte_size_ -= found->first;
-    value_t* tmp = reinterpret_cast<value_t*>(found->second);
-    temp_usm_map_.erase(found);
-    temp_usm_map_mutex_.unlock();  // unlock
-    return tmp;
-  } else {
-    temp_usm_map_mutex_.unlock();  // unlock
+inline void* Temp_Mem_Pool::allocate_usm_block_(size_t size_class) {
+  const size_t classByteSize = usm_arena_t::class_byte_size(size_class);
+  const size_t byteSize =
+      usm_arena_t::is_small(size_class) ? slab_byte_size_ : classByteSize;
 #ifdef VERBOSE
-    std::cout << "Create a temporary USM allocation of " << byteSize
-              << " bytes." << std::endl;
+  std::cout << "Create a temporary USM allocation of " << byteSize
+            << " bytes." << std::endl;
 #endif
-    value_t* tmp = sycl::malloc_device<value_t>(size, q_);
-    temp_usm_map_mutex_.lock();  // lock
-    temp_usm_size_map_.emplace(
-        reinterpret_cast<temp_usm_size_map_t::key_type>(tmp), byteSize);
-    temp_usm_map_mutex_.unlock();  // unlock
-    return tmp;
+  reserve_bytes_(byteSize);
+  int8_t* mem = sycl::malloc_device<int8_t>(byteSize, q_);
+  if (mem == nullptr) {
+    allocated_bytes_ -= byteSize;
+    throw std::bad_alloc();
+  }
+  {
+    std::unique_lock<std::shared_mutex> lock(usm_allocations_mutex_);
+    usm_allocations_.emplace(mem, usm_allocation_t{byteSize, size_class});
+  }
+  if (usm_arena_t::is_small(size_class)) {
+    // Carve the slab into blocks of the class, the first one is returned
+    for (size_t offset = classByteSize; offset < byteSize;
+         offset += classByteSize) {
+      usm_arena_.add(size_class, mem + offset);
+    }
+  }
+  return mem;
+}
+
+inline void Temp_Mem_Pool::free_usm_block_(void* mem) {
+  size_t byteSize;
+  {
+    std::unique_lock<std::shared_mutex> lock(usm_allocations_mutex_);
+    auto found = usm_allocations_.find(reinterpret_cast<const int8_t*>(mem));
+    byteSize = found->second.byte_size;
+    usm_allocations_.erase(found);
   }
+  sycl::free(mem, q_);
+  allocated_bytes_ -= byteSize;
+  trimmed_bytes_ += byteSize;
+}
+
+template <typename value_t>
+typename helper::AllocHelper<value_t, helper::AllocType::usm>::type
+Temp_Mem_Pool::acquire_usm_mem(size_t size) {
+  const size_t byteSize = std::max<size_t>(size * sizeof(value_t), 1);
+  const size_t sizeClass = usm_arena_t::size_class(byteSize);
+  const auto start = clock_t::now();
+  pending_usm_.poll([this](void* mem) { reclaim_usm_mem(mem); });
+  auto block = usm_arena_.acquire(sizeClass);
+  const bool hit = block.has_value();
+  void* mem = hit ? *block : allocate_usm_block_(sizeClass);
+  record_acquire_(start, hit);
+  return reinterpret_cast<value_t*>(mem);
 }
 
 template <typename container_t>
-void Temp_Mem_Pool::release_usm_mem_(const container_t& mem) {
-  temp_usm_map_mutex_.lock();  // lock
-  auto found = temp_usm_size_map_.find(
-      reinterpret_cast<temp_usm_size_map_t::key_type>(mem));
-  const size_t byteSize = found->second;
-  if (temp_usm_map_tot_byte_size_ + byteSize > max_size_temp_mem_) {
-    temp_usm_size_map_.erase(found);
-    temp_usm_map_mutex_.unlock();  // unlock
-    sycl::free(mem, q_);
-  } else {
-    temp_usm_map_tot_byte_size_ += byteSize;
-    temp_usm_map_.emplace(byteSize,
-                          reinterpret_cast<temp_usm_map_t::mapped_type>(mem));
-    temp_usm_map_mutex_.unlock();  // unlock
+void Temp_Mem_Pool::reclaim_usm_mem(const container_t& mem) {
+  const int8_t* ptr = reinterpret_cast<const int8_t*>(mem);
+  size_t sizeClass;
+  {
+    std::shared_lock<std::shared_mutex> lock(usm_allocations_mutex_);
+    // Allocation (slab or large block) containing the block
+    auto found = usm_allocations_.upper_bound(ptr);
+    --found;
+    sizeClass = found->second.size_class;
+  }
+  if (!usm_arena_.release(sizeClass, const_cast<int8_t*>(ptr))) {
+    // Large block beyond the pool limit
+    free_usm_block_(const_cast<int8_t*>(ptr));
   }
 }
 
@@ -108,12 +173,56 @@ template <typename container_t>
 typename Temp_Mem_Pool::event_t Temp_Mem_Pool::release_usm_mem(
     const typename Temp_Mem_Pool::event_t& dependencies,
     const container_t& mem) {
-  return {q_.submit([&](sycl::handler& cgh) {
-    cgh.depends_on(dependencies);
-    cgh.host_task([&, mem]() { release_usm_mem_(mem); });
-  })};
-}
+  if (dependencies.empty()) {
+    reclaim_usm_mem(mem);
+  } else {
+    pending_usm_.push(mem, dependencies);
+  }
+  return {};
 }
 #endif  // SB_ENABLE_USM
-#endif  // __ADAPTIVECPP__
+
+inline size_t Temp_Mem_Pool::trim_lru_(clock_t::time_point released_before,
+                                       size_t byte_size) {
+  // USM blocks first, least recently released first within each path
+  size_t freed = 0;
+#ifdef SB_ENABLE_USM
+  freed += usm_arena_.trim(released_before, byte_size,
+                           [this](void* mem) { free_usm_block_(mem); });
+#endif
+  freed += buffer_arena_.trim(
+      released_before, byte_size > freed ? byte_size - freed : 0,
+      [this](temp_buffer_t buff) {
+        allocated_bytes_ -= buff.byte_size();
+        trimmed_bytes_ += buff.byte_size();
+      });
+  return freed;
+}
+
+inline size_t Temp_Mem_Pool::trim() {
+  pending_buffers_.poll([this](temp_buffer_t buff) { reclaim_buffer_(buff); });
+#ifdef SB_ENABLE_USM
+  pending_usm_.poll([this](void* mem) { reclaim_usm_mem(mem); });
+#endif
+  return trim_lru_(clock_t::now() - config_.trim_idle_time, 0);
+}
+
+inline Temp_Mem_Pool_Stats Temp_Mem_Pool::get_stats() {
+  Temp_Mem_Pool_Stats stats;
+  stats.hits = hits_;
+  stats.misses = misses_;
+  stats.bytes_cached = buffer_arena_.cached_byte_size();
+#ifdef SB_ENABLE_USM
+  stats.bytes_cached += usm_arena_.cached_byte_size();
+#endif
+  stats.bytes_allocated = allocated_bytes_;
+  stats.high_water_mark = high_water_mark_;
+  stats.bytes_trimmed = trimmed_bytes_;
+  const size_t acquisitions = stats.hits + stats.misses;
+  stats.avg_acquire_us =
+      acquisitions == 0 ? 0.0 : acquire_ns_ / (1000.0 * acquisitions);
+  stats.max_acquire_us = max_acquire_ns_ / 1000.0;
+  return stats;
+}
+}  // namespace blas
 #endif
@@ -114,6 +114,27 @@
     name_generator)
 #endif  // BLAS_ENABLE_HALF
 
+#ifdef BLAS_ENABLE_BFLOAT16
+/** Registers test for the bfloat16 type
+ * @see BLAS_REGISTER_TEST_CUSTOM_NAME
+ */
+#define BLAS_REGISTER_TEST_BFLOAT16_CUSTOM_NAME(test_suite, class_name,       \
+                                                test_function, combination_t, \
+                                                combination, name_generator)  \
+  class class_name##BFloat16                                                  \
+      : public ::testing::TestWithParam<combination_t<blas::bfloat16>> {};    \
+  TEST_P(class_name##BFloat16, test) {                                        \
+    test_function<blas::bfloat16>(GetParam());                                \
+  };                                                                          \
+  INSTANTIATE_TEST_SUITE_P(test_suite, class_name##BFloat16,                  \
+                           combination<blas::bfloat16>,                       \
+                           name_generator<blas::bfloat16>);
+#else
+#define BLAS_REGISTER_TEST_BFLOAT16_CUSTOM_NAME(test_suite, class_name,       \
+                                                test_function, combination_t, \
+                                                combination, name_generator)
+#endif  // BLAS_ENABLE_BFLOAT16
+
 #ifdef BLAS_ENABLE_COMPLEX
 #define BLAS_REGISTER_TEST_CPLX_S_CUSTOM_NAME(test_suite, class_name,        \
                                               test_function, combination_t,  \
@@ -0,0 +1,133 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_fused_test.cpp
+ *
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+#include "portblas.hpp"
+
+// inputs combination
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, scalar_t, int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  int incX;
+  bool lazy;
+  std::tie(size, alpha, beta, incX, lazy) = combi;
+
+  // Dimensions of input vector x
+  int x_dim = size * incX;
+
+  std::vector<scalar_t> v_x(x_dim);
+  std::vector<scalar_t> v_y(size);
+  std::vector<scalar_t> v_z(size, scalar_t(0));
+  fill_random(v_x);
+  fill_random(v_y);
+
+  // Reference BLAS implementation: y = beta * (alpha * x + y), z = y
+  std::vector<scalar_t> v_cpu_y = v_y;
+  std::vector<scalar_t> v_cpu_z(size);
+  reference_blas::axpy(size, alpha, v_x.data(), incX, v_cpu_y.data(), 1);
+  reference_blas::scal(size, beta, v_cpu_y.data(), 1);
+  reference_blas::copy(size, v_cpu_y.data(), 1, v_cpu_z.data(), 1);
+
+  // portBLAS implementation
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_dim);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  auto gpu_z_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+
+  auto xcp_ev = blas::helper::copy_to_device(sb_handle.get_queue(), v_x.data(),
+                                             gpu_x_v, x_dim);
+  auto ycp_ev = blas::helper::copy_to_device(sb_handle.get_queue(), v_y.data(),
+                                             gpu_y_v, size);
+  sb_handle.wait({xcp_ev, ycp_ev});
+
+  // Views
+  auto view_x = make_vector_view(gpu_x_v, incX, size);
+  auto view_y = make_vector_view(gpu_y_v, 1, size);
+  auto view_z = make_vector_view(gpu_z_v, 1, size);
+
+  // AXPY expression
+  auto axpy_scal_op = make_op<ScalarOp, ProductOperator>(alpha, view_x);
+  auto axpy_add_op = make_op<BinaryOp, AddOperator>(view_y, axpy_scal_op);
+  auto axpy_op = make_op<Assign>(view_y, axpy_add_op);
+
+  // SCAL expression
+  auto scal_op = make_op<ScalarOp, ProductOperator>(beta, view_y);
+  auto scal_assign_op = make_op<Assign>(view_y, scal_op);
+
+  // COPY expression
+  auto copy_op = make_op<Assign>(view_z, view_y);
+
+  typename blas::SB_Handle::event_t events;
+  if (lazy) {
+    events = make_lazy_fusion(sb_handle)
+                 .defer(axpy_op)
+                 .defer(scal_assign_op)
+                 .defer(copy_op)
+                 .flush();
+  } else {
+    events = sb_handle.execute_fused({}, axpy_op, scal_assign_op, copy_op);
+  }
+  sb_handle.wait(events);
+
+  // With a unit stride all the views share the same access pattern and the
+  // three trees are merged in one kernel. Otherwise x is read with a pattern
+  // that may alias y, so the axpy is launched on its own.
+  ASSERT_EQ(events.size(), (incX == 1) ? 1 : 2);
+
+  auto y_ev = blas::helper::copy_to_host(sb_handle.get_queue(), gpu_y_v,
+                                         v_y.data(), size);
+  auto z_ev = blas::helper::copy_to_host(sb_handle.get_queue(), gpu_z_v,
+                                         v_z.data(), size);
+  sb_handle.wait({y_ev, z_ev});
+
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_y, v_y));
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_z, v_z));
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(16, 1023),             // size
+                       ::testing::Values<scalar_t>(0.0, 1.34),  // alpha
+                       ::testing::Values<scalar_t>(0.5, 2.0),   // beta
+                       ::testing::Values(1, 4),                 // incX
+                       ::testing::Values(false, true));         // lazy
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int size, incX;
+  T alpha, beta;
+  bool lazy;
+  BLAS_GENERATE_NAME(info.param, size, alpha, beta, incX, lazy);
+}
+
+BLAS_REGISTER_TEST_FLOAT(FusedTree, combination_t, combi, generate_name);
@@ -28,14 +28,15 @@
 
 // inputs combination
 template <typename scalar_t>
-using combination_t = std::tuple<int, scalar_t, int>;
+using combination_t = std::tuple<int, scalar_t, int, bool>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
   int size;
   scalar_t alpha;
   int incX;
-  std::tie(size, alpha, incX) = combi;
+  bool single_pass;
+  std::tie(size, alpha, incX, single_pass) = combi;
 
   // Dimensions of input vector x
   int x_dim = size * incX;
@@ -56,6 +57,8 @@ void run_test(const combination_t<scalar_t> combi) {
   // portBLAS implementation
   auto q = make_queue();
   blas::SB_Handle sb_handle(q);
+  // Falls back to the multi-pass reduction if the device lacks the atomics
+  sb_handle.set_single_pass_reduction(single_pass);
 
   // Iterators
   auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_dim);
@@ -97,16 +100,20 @@ void run_test(const combination_t<scalar_t> combi) {
 }
 
 template <typename scalar_t>
-const auto combi = ::testing::Combine(::testing::Values(16, 1023),   // size
-                                      ::testing::Values(0.0, 1.34),  // alpha
-                                      ::testing::Values(1, 4));      // incX
+const auto combi =
+    ::testing::Combine(::testing::Values(16, 1023),    // size
+                       ::testing::Values(0.0, 1.34),   // alpha
+                       ::testing::Values(1, 4),        // incX
+                       ::testing::Values(true, false)  // single_pass
+    );
 
 template <class T>
 static std::string generate_name(
     const ::testing::TestParamInfo<combination_t<T>>& info) {
   int size, incX;
   T alpha;
-  BLAS_GENERATE_NAME(info.param, size, alpha, incX);
+  bool single_pass;
+  BLAS_GENERATE_NAME(info.param, size, alpha, incX, single_pass);
 }
 
 BLAS_REGISTER_TEST_FLOAT(ScalAsumTree, combination_t, combi, generate_name);
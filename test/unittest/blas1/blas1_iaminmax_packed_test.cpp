@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_iaminmax_packed_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, index_t, bool>;
+
+// Large sizes take the single kernel iamax / iamin with packed atomic keys on
+// devices supporting 64-bit atomics, or the two step reduction when the single
+// pass reductions are disabled. Both return the first index of the extremum,
+// including when replayed from an Execution_Plan.
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t incX;
+  bool single_pass;
+  std::tie(alloc, size, incX, single_pass) = combi;
+
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random_with_range(x_v, scalar_t{1}, scalar_t{10});
+  // Ties of the extrema, the first one being expected
+  x_v[(size / 3) * incX] = scalar_t{-20};
+  x_v[(2 * size / 3) * incX] = scalar_t{20};
+  x_v[(size / 4) * incX] = scalar_t{0};
+  x_v[(size / 2) * incX] = scalar_t{-0};
+
+  const int iamax_cpu = reference_blas::iamax(size, x_v.data(), incX);
+  const int iamin_cpu = reference_blas::iamin(size, x_v.data(), incX);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  sb_handle.set_single_pass_reduction(single_pass);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size * incX, q);
+  auto gpu_out = helper::allocate<mem_alloc, index_t>(2, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size * incX);
+
+  sb_handle.wait(copy_x);
+  // Captured, the keys of the single kernel being only reset by the host
+  // before the first launch
+  blas::Execution_Plan plan(blas::plan_backend_t::command_group);
+  sb_handle.begin_capture(plan);
+  auto iamax_event = _iamax(sb_handle, size, gpu_x_v, incX, gpu_out);
+  auto iamin_event = _iamin(sb_handle, size, gpu_x_v, incX, gpu_out + 1);
+  sb_handle.end_capture();
+  sb_handle.wait(iamax_event);
+  sb_handle.wait(iamin_event);
+
+  std::vector<index_t> out(2);
+  auto copy_out = helper::copy_to_host(q, gpu_out, out.data(), 2);
+  sb_handle.wait(copy_out);
+  ASSERT_EQ(iamax_cpu, out[0]);
+  ASSERT_EQ(iamin_cpu, out[1]);
+
+  // Smaller extrema elsewhere: the replay only finds them if the previous
+  // launch left its keys ready for the next one
+  fill_random_with_range(x_v, scalar_t{2}, scalar_t{10});
+  x_v[(size / 5) * incX] = scalar_t{15};
+  x_v[(3 * size / 4) * incX] = scalar_t{1};
+  const int iamax_replay_cpu = reference_blas::iamax(size, x_v.data(), incX);
+  const int iamin_replay_cpu = reference_blas::iamin(size, x_v.data(), incX);
+  copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size * incX);
+  sb_handle.wait(copy_x);
+
+  sb_handle.wait(plan.replay());
+  copy_out = helper::copy_to_host(q, gpu_out, out.data(), 2);
+  sb_handle.wait(copy_out);
+  ASSERT_EQ(iamax_replay_cpu, out[0]);
+  ASSERT_EQ(iamin_replay_cpu, out[1]);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_out, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t incX;
+  bool single_pass;
+  std::tie(alloc, size, incX, single_pass) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(10000, 1000000),  // size
+                       ::testing::Values(1, 3),            // incX
+                       ::testing::Values(true, false)      // single_pass
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, incX;
+  bool single_pass;
+  BLAS_GENERATE_NAME(info.param, alloc, size, incX, single_pass);
+}
+
+BLAS_REGISTER_TEST_ALL(IaminmaxPacked, combination_t, combi, generate_name);
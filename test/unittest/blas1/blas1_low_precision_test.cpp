@@ -0,0 +1,205 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_low_precision_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t>;
+
+// Relative rounding error of the 16-bit storage type
+template <typename scalar_t>
+double storage_epsilon() {
+  return std::is_same_v<scalar_t, sycl::half> ? 0x1p-10 : 0x1p-7;
+}
+
+template <typename scalar_t>
+double to_double(scalar_t value) {
+  return static_cast<double>(static_cast<float>(value));
+}
+
+// Compares a result to its reference computed in double from the same 16-bit
+// inputs, allowing a few roundings to the storage type
+template <typename scalar_t>
+void check_near(const std::vector<scalar_t>& res,
+                const std::vector<double>& ref) {
+  const double tol = 4 * storage_epsilon<scalar_t>();
+  for (size_t i = 0; i < ref.size(); ++i) {
+    ASSERT_NEAR(to_double(res[i]), ref[i], tol * (1 + std::abs(ref[i])))
+        << "at element " << i;
+  }
+}
+
+// The 16-bit types are only used for storage: dot and nrm2 accumulate in
+// float, which the vectors of ones check, as their sums in half or bfloat16
+// would stop growing at 2048 or 256.
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  const scalar_t alpha{1.5f};
+  const scalar_t c{0.6f};
+  const scalar_t s{0.8f};
+
+  std::vector<float> x_f(size);
+  std::vector<float> y_f(size);
+  fill_random_with_range(x_f, -1.f, 1.f);
+  fill_random_with_range(y_f, -1.f, 1.f);
+  std::vector<scalar_t> x_v(x_f.begin(), x_f.end());
+  std::vector<scalar_t> y_v(y_f.begin(), y_f.end());
+  std::vector<scalar_t> ones_v(size, scalar_t{1.f});
+  std::vector<scalar_t> res_v(4, scalar_t{0.f});
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_z_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_ones_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_res = helper::allocate<mem_alloc, scalar_t>(4, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size);
+  auto copy_ones = helper::copy_to_device(q, ones_v.data(), gpu_ones_v, size);
+  auto copy_res = helper::copy_to_device(q, res_v.data(), gpu_res, 4);
+  sb_handle.wait({copy_x, copy_y, copy_ones, copy_res});
+
+  // dot and nrm2
+  auto dot_event = _dot(sb_handle, size, gpu_x_v, index_t{1}, gpu_y_v,
+                        index_t{1}, gpu_res);
+  auto nrm2_event = _nrm2(sb_handle, size, gpu_x_v, index_t{1}, gpu_res + 1);
+  auto dot_ones_event = _dot(sb_handle, size, gpu_ones_v, index_t{1},
+                             gpu_ones_v, index_t{1}, gpu_res + 2);
+  auto nrm2_ones_event =
+      _nrm2(sb_handle, size, gpu_ones_v, index_t{1}, gpu_res + 3);
+  sb_handle.wait({dot_event, nrm2_event, dot_ones_event, nrm2_ones_event});
+  auto copy_res_back = helper::copy_to_host(q, gpu_res, res_v.data(), 4);
+  sb_handle.wait(copy_res_back);
+
+  double dot_ref = 0;
+  double nrm2_ref = 0;
+  for (index_t i = 0; i < size; ++i) {
+    dot_ref += to_double(x_v[i]) * to_double(y_v[i]);
+    nrm2_ref += to_double(x_v[i]) * to_double(x_v[i]);
+  }
+  nrm2_ref = std::sqrt(nrm2_ref);
+  const double ones_ref = to_double(scalar_t{static_cast<float>(size)});
+  const double ones_nrm2_ref =
+      to_double(scalar_t{static_cast<float>(std::sqrt(size))});
+  check_near(res_v, {dot_ref, nrm2_ref, ones_ref, ones_nrm2_ref});
+
+  // axpy into y
+  auto axpy_event = _axpy(sb_handle, size, alpha, gpu_x_v, index_t{1},
+                          gpu_y_v, index_t{1});
+  sb_handle.wait(axpy_event);
+  std::vector<scalar_t> axpy_v(size);
+  auto copy_axpy = helper::copy_to_host(q, gpu_y_v, axpy_v.data(), size);
+  sb_handle.wait(copy_axpy);
+  std::vector<double> axpy_ref(size);
+  for (index_t i = 0; i < size; ++i) {
+    axpy_ref[i] = to_double(alpha) * to_double(x_v[i]) + to_double(y_v[i]);
+  }
+  check_near(axpy_v, axpy_ref);
+
+  // copy of y into z, then scal of z
+  auto copy_event = _copy(sb_handle, size, gpu_y_v, index_t{1}, gpu_z_v,
+                          index_t{1});
+  auto scal_event =
+      _scal(sb_handle, size, alpha, gpu_z_v, index_t{1}, copy_event);
+  sb_handle.wait(scal_event);
+  std::vector<scalar_t> scal_v(size);
+  auto copy_scal = helper::copy_to_host(q, gpu_z_v, scal_v.data(), size);
+  sb_handle.wait(copy_scal);
+  std::vector<double> scal_ref(size);
+  for (index_t i = 0; i < size; ++i) {
+    scal_ref[i] = to_double(alpha) * to_double(axpy_v[i]);
+  }
+  check_near(scal_v, scal_ref);
+
+  // rot of x and z
+  auto rot_event = _rot(sb_handle, size, gpu_x_v, index_t{1}, gpu_z_v,
+                        index_t{1}, c, s);
+  sb_handle.wait(rot_event);
+  std::vector<scalar_t> rot_x_v(size);
+  std::vector<scalar_t> rot_z_v(size);
+  auto copy_rot_x = helper::copy_to_host(q, gpu_x_v, rot_x_v.data(), size);
+  auto copy_rot_z = helper::copy_to_host(q, gpu_z_v, rot_z_v.data(), size);
+  sb_handle.wait({copy_rot_x, copy_rot_z});
+  std::vector<double> rot_x_ref(size);
+  std::vector<double> rot_z_ref(size);
+  for (index_t i = 0; i < size; ++i) {
+    const double x = to_double(x_v[i]);
+    const double z = to_double(scal_v[i]);
+    rot_x_ref[i] = to_double(c) * x + to_double(s) * z;
+    rot_z_ref[i] = to_double(c) * z - to_double(s) * x;
+  }
+  check_near(rot_x_v, rot_x_ref);
+  check_near(rot_z_v, rot_z_ref);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_z_v, q);
+  helper::deallocate<mem_alloc>(gpu_ones_v, q);
+  helper::deallocate<mem_alloc>(gpu_res, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),   // allocation type
+                       ::testing::Values(11, 1002, 10000)  // size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size;
+  BLAS_GENERATE_NAME(info.param, alloc, size);
+}
+
+// Only registered for the 16-bit types, see BLAS_ENABLE_HALF and
+// BLAS_ENABLE_BFLOAT16
+BLAS_REGISTER_TEST_HALF_CUSTOM_NAME(LowPrecision, LowPrecision, run_test,
+                                    combination_t, combi, generate_name);
+BLAS_REGISTER_TEST_BFLOAT16_CUSTOM_NAME(LowPrecision, LowPrecision, run_test,
+                                        combination_t, combi, generate_name);
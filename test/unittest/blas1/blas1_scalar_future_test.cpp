@@ -0,0 +1,141 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_scalar_future_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, index_t>;
+
+// The future versions of the scalar-returning operations are all submitted
+// before any result is read, and must give the results of the synchronous
+// versions.
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t incX;
+  std::tie(alloc, size, incX) = combi;
+
+  std::vector<scalar_t> x_v(size * incX);
+  std::vector<scalar_t> y_v(size * incX);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  const scalar_t dot_cpu =
+      reference_blas::dot(size, x_v.data(), incX, y_v.data(), incX);
+  const scalar_t asum_cpu = reference_blas::asum(size, x_v.data(), incX);
+  const scalar_t nrm2_cpu = reference_blas::nrm2(size, x_v.data(), incX);
+  const int iamax_cpu = reference_blas::iamax(size, x_v.data(), incX);
+  const int iamin_cpu = reference_blas::iamin(size, x_v.data(), incX);
+
+  auto q = make_queue();
+  blas::Temp_Mem_Pool pool(q);
+  blas::SB_Handle sb_handle(&pool);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size * incX, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size * incX, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size * incX);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size * incX);
+
+  auto dot_future = _dot_async(sb_handle, size, gpu_x_v, incX, gpu_y_v, incX,
+                               {copy_x, copy_y});
+  auto asum_future = _asum_async(sb_handle, size, gpu_x_v, incX, {copy_x});
+  auto nrm2_future = _nrm2_async(sb_handle, size, gpu_x_v, incX, {copy_x});
+  auto iamax_future = _iamax_async(sb_handle, size, gpu_x_v, incX, {copy_x});
+  auto iamin_future = _iamin_async(sb_handle, size, gpu_x_v, incX, {copy_x});
+  // Dropped without being read, its slot is reused once the copy is complete
+  _nrm2_async(sb_handle, size, gpu_y_v, incX, {copy_y});
+
+  ASSERT_TRUE(dot_future.valid());
+  ASSERT_TRUE(utils::almost_equal(dot_future.get(), dot_cpu));
+  // The result can be read again
+  ASSERT_TRUE(utils::almost_equal(dot_future.get(), dot_cpu));
+  ASSERT_TRUE(utils::almost_equal(asum_future.get(), asum_cpu));
+  ASSERT_TRUE(utils::almost_equal(nrm2_future.get(), nrm2_cpu));
+  iamax_future.wait();
+  ASSERT_TRUE(iamax_future.is_ready());
+  ASSERT_EQ(iamax_future.get(), iamax_cpu);
+  ASSERT_EQ(iamin_future.get(), iamin_cpu);
+
+  if constexpr (std::is_same<scalar_t, float>::value) {
+    const float sb = 0.5f;
+    const scalar_t sdsdot_cpu =
+        reference_blas::sdsdot(size, sb, x_v.data(), incX, y_v.data(), incX);
+    auto sdsdot_future =
+        _sdsdot_async(sb_handle, size, sb, gpu_x_v, incX, gpu_y_v, incX);
+    ASSERT_TRUE(utils::almost_equal(sdsdot_future.get(), sdsdot_cpu));
+  }
+
+  // The slots of the moved-from and destroyed futures go back to the pool
+  auto moved_future = std::move(dot_future);
+  ASSERT_FALSE(dot_future.valid());
+  ASSERT_TRUE(utils::almost_equal(moved_future.get(), dot_cpu));
+  const size_t allocated_slots =
+      sb_handle.get_host_slot_pool()->allocated_slots();
+  for (size_t i = 0; i < 4 * blas::Host_Slot_Pool::slots_per_slab; ++i) {
+    auto future = _asum_async(sb_handle, size, gpu_x_v, incX);
+    future.wait();
+  }
+  ASSERT_EQ(sb_handle.get_host_slot_pool()->allocated_slots(),
+            allocated_slots);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t incX;
+  std::tie(alloc, size, incX) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 1002),      // size
+                       ::testing::Values(1, 3)           // incX
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, incX;
+  BLAS_GENERATE_NAME(info.param, alloc, size, incX);
+}
+
+BLAS_REGISTER_TEST_ALL(ScalarFuture, combination_t, combi, generate_name);
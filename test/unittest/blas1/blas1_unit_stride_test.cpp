@@ -0,0 +1,127 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_unit_stride_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, index_t, index_t>;
+
+// The unit stride vectors are evaluated with sycl::vec packets when they are
+// aligned to the size of a packet, and element by element otherwise. The
+// offsets move the vectors away from the alignment of the allocation.
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t offset_x;
+  index_t offset_y;
+  std::tie(alloc, size, offset_x, offset_y) = combi;
+
+  const scalar_t alpha{1.5};
+  const index_t x_size = size + offset_x;
+  const index_t y_size = size + offset_y;
+
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v(y_size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  // Reference implementation, axpy then scal then swap then copy
+  std::vector<scalar_t> x_cpu_v = x_v;
+  std::vector<scalar_t> y_cpu_v = y_v;
+  reference_blas::axpy(size, alpha, x_cpu_v.data() + offset_x, 1,
+                       y_cpu_v.data() + offset_y, 1);
+  reference_blas::scal(size, alpha, y_cpu_v.data() + offset_y, 1);
+  reference_blas::swap(size, x_cpu_v.data() + offset_x, 1,
+                       y_cpu_v.data() + offset_y, 1);
+  reference_blas::copy(size, x_cpu_v.data() + offset_x, 1,
+                       y_cpu_v.data() + offset_y, 1);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(y_size, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, x_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, y_size);
+
+  auto axpy_event = _axpy(sb_handle, size, alpha, gpu_x_v + offset_x,
+                          index_t{1}, gpu_y_v + offset_y, index_t{1},
+                          {copy_x, copy_y});
+  auto scal_event = _scal(sb_handle, size, alpha, gpu_y_v + offset_y,
+                          index_t{1}, axpy_event);
+  auto swap_event = _swap(sb_handle, size, gpu_x_v + offset_x, index_t{1},
+                          gpu_y_v + offset_y, index_t{1}, scal_event);
+  auto copy_event = _copy(sb_handle, size, gpu_x_v + offset_x, index_t{1},
+                          gpu_y_v + offset_y, index_t{1}, swap_event);
+  sb_handle.wait(copy_event);
+
+  auto copy_x_back = helper::copy_to_host(q, gpu_x_v, x_v.data(), x_size);
+  auto copy_y_back = helper::copy_to_host(q, gpu_y_v, y_v.data(), y_size);
+  sb_handle.wait({copy_x_back, copy_y_back});
+
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t offset_x;
+  index_t offset_y;
+  std::tie(alloc, size, offset_x, offset_y) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(1, 7, 11, 1002),  // size
+                       ::testing::Values(0, 1, 4),         // offset_x
+                       ::testing::Values(0, 3)             // offset_y
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, offset_x, offset_y;
+  BLAS_GENERATE_NAME(info.param, alloc, size, offset_x, offset_y);
+}
+
+BLAS_REGISTER_TEST_ALL(UnitStride, combination_t, combi, generate_name);
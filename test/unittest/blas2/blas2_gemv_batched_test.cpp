@@ -0,0 +1,211 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<std::string, int, int, T, T, bool, int, int, int, int>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t m;
+  index_t n;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t incX;
+  index_t incY;
+  index_t stride_a_mul;
+  index_t batch_size;
+  std::tie(alloc, m, n, alpha, beta, trans, incX, incY, stride_a_mul,
+           batch_size) = combi;
+
+  const char* t_str = trans ? "t" : "n";
+
+  const index_t lda = m;
+  // A stride of 0 uses the same matrix for the whole batch
+  const index_t stride_a = stride_a_mul * lda * n;
+  const index_t stride_x = trans ? (1 + (m - 1) * std::abs(incX))
+                                 : (1 + (n - 1) * std::abs(incX));
+  const index_t stride_y = trans ? (1 + (n - 1) * std::abs(incY))
+                                 : (1 + (m - 1) * std::abs(incY));
+  const index_t a_size = (batch_size - 1) * stride_a + lda * n;
+  const index_t x_size = batch_size * stride_x;
+  const index_t y_size = batch_size * stride_y;
+
+  std::vector<scalar_t> a_m(a_size);
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v(y_size, scalar_t(10.0));
+  fill_random(a_m);
+  fill_random(x_v);
+
+  std::vector<scalar_t> y_v_cpu = y_v;
+  for (index_t i = 0; i < batch_size; ++i) {
+    reference_blas::gemv(t_str, m, n, alpha, a_m.data() + i * stride_a, lda,
+                         x_v.data() + i * stride_x, incX, beta,
+                         y_v_cpu.data() + i * stride_y, incY);
+  }
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto m_a_gpu = helper::allocate<mem_alloc, scalar_t>(a_size, q);
+  auto v_x_gpu = helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto v_y_gpu = helper::allocate<mem_alloc, scalar_t>(y_size, q);
+
+  auto copy_m = helper::copy_to_device(q, a_m.data(), m_a_gpu, a_size);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), v_x_gpu, x_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), v_y_gpu, y_size);
+
+  auto gemv_event = _gemv_strided_batched(
+      sb_handle, *t_str, m, n, alpha, m_a_gpu, lda, stride_a, v_x_gpu, incX,
+      stride_x, beta, v_y_gpu, incY, stride_y, batch_size,
+      {copy_m, copy_x, copy_y});
+  sb_handle.wait(gemv_event);
+
+  std::vector<scalar_t> y_v_gpu_result(y_size);
+  auto event =
+      helper::copy_to_host(q, v_y_gpu, y_v_gpu_result.data(), y_size);
+  sb_handle.wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v_gpu_result, y_v_cpu));
+
+#ifdef SB_ENABLE_USM
+  if constexpr (mem_alloc == helper::AllocType::usm) {
+    // Same batch through arrays of pointers, listed in reverse order
+    std::vector<scalar_t*> a_ptrs(batch_size);
+    std::vector<scalar_t*> x_ptrs(batch_size);
+    std::vector<scalar_t*> y_ptrs(batch_size);
+    for (index_t i = 0; i < batch_size; ++i) {
+      const index_t j = batch_size - 1 - i;
+      a_ptrs[i] = m_a_gpu + j * stride_a;
+      x_ptrs[i] = v_x_gpu + j * stride_x;
+      y_ptrs[i] = v_y_gpu + j * stride_y;
+    }
+    auto a_array = helper::allocate<mem_alloc, scalar_t*>(batch_size, q);
+    auto x_array = helper::allocate<mem_alloc, scalar_t*>(batch_size, q);
+    auto y_array = helper::allocate<mem_alloc, scalar_t*>(batch_size, q);
+    auto copy_a_array =
+        helper::copy_to_device(q, a_ptrs.data(), a_array, batch_size);
+    auto copy_x_array =
+        helper::copy_to_device(q, x_ptrs.data(), x_array, batch_size);
+    auto copy_y_array =
+        helper::copy_to_device(q, y_ptrs.data(), y_array, batch_size);
+    copy_y = helper::copy_to_device(q, y_v.data(), v_y_gpu, y_size);
+
+    gemv_event = _gemv_batched(
+        sb_handle, *t_str, m, n, alpha, a_array, lda, x_array, incX, beta,
+        y_array, incY, batch_size,
+        {copy_a_array, copy_x_array, copy_y_array, copy_y});
+    sb_handle.wait(gemv_event);
+
+    event = helper::copy_to_host(q, v_y_gpu, y_v_gpu_result.data(), y_size);
+    sb_handle.wait(event);
+
+    ASSERT_TRUE(utils::compare_vectors(y_v_gpu_result, y_v_cpu));
+
+    helper::deallocate<mem_alloc>(a_array, q);
+    helper::deallocate<mem_alloc>(x_array, q);
+    helper::deallocate<mem_alloc>(y_array, q);
+  }
+#endif
+
+  helper::deallocate<mem_alloc>(m_a_gpu, q);
+  helper::deallocate<mem_alloc>(v_x_gpu, q);
+  helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t m;
+  index_t n;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t incX;
+  index_t incY;
+  index_t stride_a_mul;
+  index_t batch_size;
+  std::tie(alloc, m, n, alpha, beta, trans, incX, incY, stride_a_mul,
+           batch_size) = combi;
+
+  if (alloc == "usm") {
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+// The sizes of y cover the several matrices per work group of the small
+// matrices as well as the large ones spread across work groups, and the long
+// dot products of the small ones split across work items
+#ifdef STRESS_TESTING
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),   // allocation type
+                       ::testing::Values(5, 30, 60, 300),  // m
+                       ::testing::Values(7, 63, 257, 2000),  // n
+                       ::testing::Values<scalar_t>(0.0, 1.5),  // alpha
+                       ::testing::Values<scalar_t>(0.0, 1.5),  // beta
+                       ::testing::Values(false, true),         // trans
+                       ::testing::Values(1, -2),               // incX
+                       ::testing::Values(1, 3),                // incY
+                       ::testing::Values(0, 1),                // stride_a_mul
+                       ::testing::Values(1, 37, 1000)          // batch_size
+    );
+#else
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),   // allocation type
+                       ::testing::Values(5, 300),         // m
+                       ::testing::Values(7, 63, 2000),    // n
+                       ::testing::Values<scalar_t>(1.5),  // alpha
+                       ::testing::Values<scalar_t>(0.0, 1.5),  // beta
+                       ::testing::Values(false, true),         // trans
+                       ::testing::Values(-2),                  // incX
+                       ::testing::Values(3),                   // incY
+                       ::testing::Values(0, 1),                // stride_a_mul
+                       ::testing::Values(37)                   // batch_size
+    );
+#endif
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  int m, n, incX, incY, strideAMul, batchSize;
+  T alpha, beta;
+  bool trans;
+  BLAS_GENERATE_NAME(info.param, alloc, m, n, alpha, beta, trans, incX, incY,
+                     strideAMul, batchSize);
+}
+
+BLAS_REGISTER_TEST_ALL(GemvBatched, combination_t, combi, generate_name);
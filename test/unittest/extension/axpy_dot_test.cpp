@@ -0,0 +1,180 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename axpy_dot_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+// How z aliases y
+enum class z_alias_t : char {
+  None = 'n',
+  Same = 's',     // The same container
+  Distinct = 'd'  // A pointer to const or another iterator to the same memory
+};
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, scalar_t, index_t,
+                                 index_t, index_t, z_alias_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  scalar_t alpha;
+  index_t incX;
+  index_t incY;
+  index_t incZ;
+  z_alias_t z_alias;
+  std::tie(alloc, size, alpha, incX, incY, incZ, z_alias) = combi;
+  const bool z_is_y = z_alias != z_alias_t::None;
+  if (z_is_y) {
+    incZ = incY;
+  }
+
+  auto x_size = size * std::abs(incX);
+  auto y_size = size * std::abs(incY);
+  auto z_size = size * std::abs(incZ);
+  // Input vectors
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> z_v(z_size);
+  fill_random(x_v);
+  fill_random(z_v);
+
+  // Updated vector and result, the initial result is overwritten
+  std::vector<scalar_t> y_v(y_size);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v = y_v;
+  scalar_t rs{10};
+
+  // Reference implementation
+  reference_blas::axpy(size, alpha, x_v.data(), incX, y_cpu_v.data(), incY);
+  const scalar_t rs_cpu =
+      z_is_y ? reference_blas::dot(size, y_cpu_v.data(), incY,
+                                   y_cpu_v.data(), incY)
+             : reference_blas::dot(size, y_cpu_v.data(), incY, z_v.data(),
+                                   incZ);
+
+  // SYCL implementation
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  // Iterators
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(y_size, q);
+  auto gpu_z_v = helper::allocate<mem_alloc, scalar_t>(z_size, q);
+  auto gpu_rs = helper::allocate<mem_alloc, scalar_t>(1, q);
+
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, x_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, y_size);
+  auto copy_z = helper::copy_to_device(q, z_v.data(), gpu_z_v, z_size);
+  auto copy_rs = helper::copy_to_device(q, &rs, gpu_rs, 1);
+
+  typename blas::SB_Handle::event_t axpy_dot_event;
+  if (z_alias == z_alias_t::Distinct) {
+    if constexpr (mem_alloc == helper::AllocType::usm) {
+      const scalar_t* gpu_y_const = gpu_y_v;
+      axpy_dot_event =
+          _axpy_dot(sb_handle, size, alpha, gpu_x_v, incX, gpu_y_v, incY,
+                    gpu_y_const, incY, gpu_rs, {copy_x, copy_y, copy_rs});
+    } else {
+      auto gpu_y_other = blas::BufferIterator<scalar_t>(gpu_y_v.get_buffer());
+      axpy_dot_event =
+          _axpy_dot(sb_handle, size, alpha, gpu_x_v, incX, gpu_y_v, incY,
+                    gpu_y_other, incY, gpu_rs, {copy_x, copy_y, copy_rs});
+    }
+  } else if (z_is_y) {
+    axpy_dot_event =
+        _axpy_dot(sb_handle, size, alpha, gpu_x_v, incX, gpu_y_v, incY,
+                  gpu_y_v, incY, gpu_rs, {copy_x, copy_y, copy_rs});
+  } else {
+    axpy_dot_event = _axpy_dot(sb_handle, size, alpha, gpu_x_v, incX, gpu_y_v,
+                               incY, gpu_z_v, incZ, gpu_rs,
+                               {copy_x, copy_y, copy_z, copy_rs});
+  }
+  sb_handle.wait(axpy_dot_event);
+
+  auto event_y = helper::copy_to_host(q, gpu_y_v, y_v.data(), y_size);
+  auto event_rs = helper::copy_to_host(q, gpu_rs, &rs, 1);
+  sb_handle.wait({event_y, event_rs});
+
+  // Validate the result
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::almost_equal(rs, rs_cpu));
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_z_v, q);
+  helper::deallocate<mem_alloc>(gpu_rs, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  scalar_t alpha;
+  index_t incX;
+  index_t incY;
+  index_t incZ;
+  z_alias_t z_alias;
+  std::tie(alloc, size, alpha, incX, incY, incZ, z_alias) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(0, 11, 1002, 102400),  // size
+                       ::testing::Values<scalar_t>(0.0, 1.5),   // alpha
+                       ::testing::Values(1, -2),                // incX
+                       ::testing::Values(1, 3),                 // incY
+                       ::testing::Values(1, -1),                // incZ
+                       ::testing::Values(z_alias_t::None, z_alias_t::Same,
+                                         z_alias_t::Distinct)  // z alias
+    );
+
+template <>
+inline void dump_arg<z_alias_t>(std::ostream& ss, z_alias_t z_alias) {
+  ss << (char)z_alias;
+}
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, incX, incY, incZ;
+  T alpha;
+  z_alias_t z_alias;
+  BLAS_GENERATE_NAME(info.param, alloc, size, alpha, incX, incY, incZ,
+                     z_alias);
+}
+
+BLAS_REGISTER_TEST_ALL(Axpy_dot, combination_t, combi, generate_name);
@@ -0,0 +1,268 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename device_scalar_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t>;
+
+// A zero alpha or beta in device memory must not propagate the NaN values of
+// the output, which BLAS does not read in that case.
+template <typename scalar_t, helper::AllocType mem_alloc>
+void check_zero_scalars(sycl::queue q, index_t size) {
+  // zero and alpha
+  std::vector<scalar_t> scalars = {scalar_t{0}, scalar_t{1.5}};
+  const scalar_t alpha = scalars[1];
+  const scalar_t nan = std::numeric_limits<scalar_t>::quiet_NaN();
+
+  std::vector<scalar_t> x_v(size);
+  std::vector<scalar_t> a_m(size * size);
+  std::vector<scalar_t> b_m(size * size);
+  fill_random(x_v);
+  fill_random(a_m);
+  fill_random(b_m);
+  std::vector<scalar_t> y_v(size, nan);
+  std::vector<scalar_t> z_v(size, nan);
+  std::vector<scalar_t> c_m(size * size, nan);
+  std::vector<scalar_t> d_m(size * size, nan);
+
+  // Reference implementation, from outputs without NaN
+  std::vector<scalar_t> y_cpu_v(size, scalar_t{0});
+  std::vector<scalar_t> z_cpu_v(size, scalar_t{0});
+  std::vector<scalar_t> c_cpu_m(size * size, scalar_t{0});
+  std::vector<scalar_t> d_cpu_m(size * size, scalar_t{0});
+  reference_blas::gemv("n", size, size, alpha, a_m.data(), size, x_v.data(), 1,
+                       scalar_t{0}, z_cpu_v.data(), 1);
+  reference_blas::gemm("n", "n", size, size, size, alpha, a_m.data(), size,
+                       b_m.data(), size, scalar_t{0}, c_cpu_m.data(), size);
+  reference_blas::symm("l", "l", size, size, alpha, a_m.data(), size,
+                       b_m.data(), size, scalar_t{0}, d_cpu_m.data(), size);
+
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_scalars = helper::allocate<mem_alloc, scalar_t>(scalars.size(), q);
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_z_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_a_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto gpu_b_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto gpu_c_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto gpu_d_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto copy_scalars = helper::copy_to_device(q, scalars.data(), gpu_scalars,
+                                             scalars.size());
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size);
+  auto copy_z = helper::copy_to_device(q, z_v.data(), gpu_z_v, size);
+  auto copy_a = helper::copy_to_device(q, a_m.data(), gpu_a_m, size * size);
+  auto copy_b = helper::copy_to_device(q, b_m.data(), gpu_b_m, size * size);
+  auto copy_c = helper::copy_to_device(q, c_m.data(), gpu_c_m, size * size);
+  auto copy_d = helper::copy_to_device(q, d_m.data(), gpu_d_m, size * size);
+  sb_handle.wait(
+      {copy_scalars, copy_x, copy_y, copy_z, copy_a, copy_b, copy_c, copy_d});
+
+  auto gpu_zero = gpu_scalars;
+  auto gpu_alpha = gpu_scalars + 1;
+  constexpr index_t inc = 1;
+
+  auto scal_event = _scal(sb_handle, size, gpu_zero, gpu_y_v, inc);
+  auto gemv_event = _gemv(sb_handle, 'n', size, size, gpu_alpha, gpu_a_m, size,
+                          gpu_x_v, inc, gpu_zero, gpu_z_v, inc);
+  auto gemm_event =
+      _gemm(sb_handle, 'n', 'n', size, size, size, gpu_alpha, gpu_a_m, size,
+            gpu_b_m, size, gpu_zero, gpu_c_m, size);
+  auto symm_event = _symm(sb_handle, 'l', 'l', size, size, gpu_alpha, gpu_a_m,
+                          size, gpu_b_m, size, gpu_zero, gpu_d_m, size);
+  sb_handle.wait({scal_event, gemv_event, gemm_event, symm_event});
+
+  auto copy_y_back = helper::copy_to_host(q, gpu_y_v, y_v.data(), size);
+  auto copy_z_back = helper::copy_to_host(q, gpu_z_v, z_v.data(), size);
+  auto copy_c_back = helper::copy_to_host(q, gpu_c_m, c_m.data(), size * size);
+  auto copy_d_back = helper::copy_to_host(q, gpu_d_m, d_m.data(), size * size);
+  sb_handle.wait({copy_y_back, copy_z_back, copy_c_back, copy_d_back});
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(z_v, z_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_cpu_m));
+  ASSERT_TRUE(utils::compare_vectors(d_m, d_cpu_m));
+
+  helper::deallocate<mem_alloc>(gpu_scalars, q);
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_z_v, q);
+  helper::deallocate<mem_alloc>(gpu_a_m, q);
+  helper::deallocate<mem_alloc>(gpu_b_m, q);
+  helper::deallocate<mem_alloc>(gpu_c_m, q);
+  helper::deallocate<mem_alloc>(gpu_d_m, q);
+}
+
+// The operations taking alpha and beta in device memory are chained without
+// reading the scalars back, the alpha of the last axpy being the dot product
+// computed by _axpy_dot, as in a conjugate gradient iteration.
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  // alpha, beta, cos, sin and the result of _axpy_dot
+  std::vector<scalar_t> scalars = {scalar_t{1.5}, scalar_t{0.5}, scalar_t{0.6},
+                                   scalar_t{0.8}, scalar_t{0}};
+  const scalar_t alpha = scalars[0];
+  const scalar_t beta = scalars[1];
+  const scalar_t c = scalars[2];
+  const scalar_t s = scalars[3];
+
+  std::vector<scalar_t> x_v(size);
+  std::vector<scalar_t> y_v(size);
+  std::vector<scalar_t> z_v(size);
+  std::vector<scalar_t> a_m(size * size);
+  std::vector<scalar_t> b_m(size * size);
+  std::vector<scalar_t> c_m(size * size);
+  fill_random(x_v);
+  fill_random(y_v);
+  fill_random(z_v);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+
+  // Reference implementation
+  std::vector<scalar_t> x_cpu_v = x_v;
+  std::vector<scalar_t> y_cpu_v = y_v;
+  std::vector<scalar_t> z_cpu_v = z_v;
+  std::vector<scalar_t> a_cpu_m = a_m;
+  std::vector<scalar_t> c_cpu_m = c_m;
+  reference_blas::axpy(size, alpha, x_cpu_v.data(), 1, y_cpu_v.data(), 1);
+  reference_blas::scal(size, beta, y_cpu_v.data(), 1);
+  reference_blas::rot(size, x_cpu_v.data(), 1, y_cpu_v.data(), 1, c, s);
+  reference_blas::scal(size, beta, y_cpu_v.data(), 1);
+  reference_blas::axpy(size, alpha, x_cpu_v.data(), 1, y_cpu_v.data(), 1);
+  reference_blas::gemv("n", size, size, alpha, a_cpu_m.data(), size,
+                       x_cpu_v.data(), 1, beta, z_cpu_v.data(), 1);
+  reference_blas::ger(size, size, alpha, z_cpu_v.data(), 1, x_cpu_v.data(), 1,
+                      a_cpu_m.data(), size);
+  reference_blas::gemm("n", "n", size, size, size, alpha, a_cpu_m.data(), size,
+                       b_m.data(), size, beta, c_cpu_m.data(), size);
+  reference_blas::axpy(size, alpha, x_cpu_v.data(), 1, y_cpu_v.data(), 1);
+  const scalar_t rs_cpu =
+      reference_blas::dot(size, y_cpu_v.data(), 1, y_cpu_v.data(), 1);
+  reference_blas::axpy(size, rs_cpu, x_cpu_v.data(), 1, z_cpu_v.data(), 1);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_scalars = helper::allocate<mem_alloc, scalar_t>(scalars.size(), q);
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_z_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_a_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto gpu_b_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto gpu_c_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto copy_scalars = helper::copy_to_device(q, scalars.data(), gpu_scalars,
+                                             scalars.size());
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size);
+  auto copy_z = helper::copy_to_device(q, z_v.data(), gpu_z_v, size);
+  auto copy_a = helper::copy_to_device(q, a_m.data(), gpu_a_m, size * size);
+  auto copy_b = helper::copy_to_device(q, b_m.data(), gpu_b_m, size * size);
+  auto copy_c = helper::copy_to_device(q, c_m.data(), gpu_c_m, size * size);
+  sb_handle.wait(
+      {copy_scalars, copy_x, copy_y, copy_z, copy_a, copy_b, copy_c});
+
+  auto gpu_alpha = gpu_scalars;
+  auto gpu_beta = gpu_scalars + 1;
+  auto gpu_cos = gpu_scalars + 2;
+  auto gpu_sin = gpu_scalars + 3;
+  auto gpu_rs = gpu_scalars + 4;
+  constexpr index_t inc = 1;
+
+  auto event = _axpy(sb_handle, size, gpu_alpha, gpu_x_v, inc, gpu_y_v, inc);
+  event = _scal(sb_handle, size, gpu_beta, gpu_y_v, inc, event);
+  event = _rot(sb_handle, size, gpu_x_v, inc, gpu_y_v, inc, gpu_cos, gpu_sin,
+               event);
+  event = _axpby(sb_handle, size, gpu_alpha, gpu_x_v, inc, gpu_beta, gpu_y_v,
+                 inc, event);
+  event = _gemv(sb_handle, 'n', size, size, gpu_alpha, gpu_a_m, size, gpu_x_v,
+                inc, gpu_beta, gpu_z_v, inc, event);
+  event = _ger(sb_handle, size, size, gpu_alpha, gpu_z_v, inc, gpu_x_v, inc,
+               gpu_a_m, size, event);
+  event = _gemm(sb_handle, 'n', 'n', size, size, size, gpu_alpha, gpu_a_m,
+                size, gpu_b_m, size, gpu_beta, gpu_c_m, size, event);
+  event = _axpy_dot(sb_handle, size, gpu_alpha, gpu_x_v, inc, gpu_y_v, inc,
+                    gpu_y_v, inc, gpu_rs, event);
+  event = _axpy(sb_handle, size, gpu_rs, gpu_x_v, inc, gpu_z_v, inc, event);
+  sb_handle.wait(event);
+
+  auto copy_y_back = helper::copy_to_host(q, gpu_y_v, y_v.data(), size);
+  auto copy_z_back = helper::copy_to_host(q, gpu_z_v, z_v.data(), size);
+  auto copy_c_back = helper::copy_to_host(q, gpu_c_m, c_m.data(), size * size);
+  sb_handle.wait({copy_y_back, copy_z_back, copy_c_back});
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(z_v, z_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_cpu_m));
+
+  helper::deallocate<mem_alloc>(gpu_scalars, q);
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_z_v, q);
+  helper::deallocate<mem_alloc>(gpu_a_m, q);
+  helper::deallocate<mem_alloc>(gpu_b_m, q);
+  helper::deallocate<mem_alloc>(gpu_c_m, q);
+
+  check_zero_scalars<scalar_t, mem_alloc>(q, size);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 64)         // size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size;
+  BLAS_GENERATE_NAME(info.param, alloc, size);
+}
+
+BLAS_REGISTER_TEST_ALL(DeviceScalar, combination_t, combi, generate_name);
@@ -0,0 +1,145 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename dot_batch_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, index_t, index_t,
+                                 index_t, index_t, index_t, index_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t offset;
+  index_t size;
+  index_t incX;
+  index_t incY;
+  index_t stride_mul_x;
+  index_t stride_mul_y;
+  index_t batch_size;
+  std::tie(alloc, offset, size, incX, incY, stride_mul_x, stride_mul_y,
+           batch_size) = combi;
+
+  const index_t stride_x{size * std::abs(incX) * stride_mul_x};
+  const index_t stride_y{size * std::abs(incY) * stride_mul_y};
+
+  // The batches start offset elements after the beginning of the memory
+  auto x_size =
+      offset + ((stride_x) ? stride_x * batch_size : size * std::abs(incX));
+  auto y_size = offset + stride_y * batch_size;
+  auto rs_size = offset + batch_size;
+  // Input vectors
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v(y_size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  // Output vector
+  std::vector<scalar_t> rs_v(rs_size, 10.0);
+  std::vector<scalar_t> rs_cpu_v(rs_v);
+
+  // Reference implementation
+  for (index_t i = 0; i < batch_size; ++i) {
+    rs_cpu_v[offset + i] =
+        reference_blas::dot(size, x_v.data() + offset + i * stride_x, incX,
+                            y_v.data() + offset + i * stride_y, incY);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  // Iterators
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(y_size, q);
+  auto gpu_rs_v = helper::allocate<mem_alloc, scalar_t>(rs_size, q);
+
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, x_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, y_size);
+  auto copy_rs = helper::copy_to_device(q, rs_v.data(), gpu_rs_v, rs_size);
+
+  auto dot_batch_event = _dot_batch(
+      sb_handle, size, gpu_x_v + offset, incX, stride_x, gpu_y_v + offset,
+      incY, stride_y, gpu_rs_v + offset, batch_size, {copy_x, copy_y, copy_rs});
+  sb_handle.wait(dot_batch_event);
+
+  auto event = helper::copy_to_host(q, gpu_rs_v, rs_v.data(), rs_size);
+  sb_handle.wait(event);
+
+  // Validate the result
+  const bool isAlmostEqual = utils::compare_vectors(rs_v, rs_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_rs_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t offset;
+  index_t size;
+  index_t incX;
+  index_t incY;
+  index_t stride_mul_x;
+  index_t stride_mul_y;
+  index_t batch_size;
+  std::tie(alloc, offset, size, incX, incY, stride_mul_x, stride_mul_y,
+           batch_size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(0, 3),                 // offset
+                       ::testing::Values(11, 65, 1002, 10240),  // size
+                       ::testing::Values(1, -1, 2),             // incX
+                       ::testing::Values(1, -3),                // incY
+                       ::testing::Values(0, 1, 2),  // stride_mul_x
+                       ::testing::Values(1, 3),     // stride_mul_y
+                       ::testing::Values(1, 5, 130)  // batch_size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t offset, size, incX, incY, stride_mul_x, stride_mul_y, batch_size;
+  BLAS_GENERATE_NAME(info.param, alloc, offset, size, incX, incY,
+                     stride_mul_x, stride_mul_y, batch_size);
+}
+
+BLAS_REGISTER_TEST_ALL(Dot_batch, combination_t, combi, generate_name);
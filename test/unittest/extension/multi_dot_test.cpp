@@ -0,0 +1,130 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename multi_dot_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<std::string, index_t, index_t, index_t, index_t, index_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t k;
+  index_t incX;
+  index_t incY;
+  index_t stride_mul_x;
+  std::tie(alloc, size, k, incX, incY, stride_mul_x) = combi;
+
+  const index_t stride_x{size * std::abs(incX) * stride_mul_x};
+
+  auto x_size = stride_x * k;
+  auto y_size = size * std::abs(incY);
+  // Input vectors
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v(y_size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  // Output vector
+  std::vector<scalar_t> rs_v(k, 10.0);
+  std::vector<scalar_t> rs_cpu_v(k);
+
+  // Reference implementation
+  for (index_t j = 0; j < k; ++j) {
+    rs_cpu_v[j] = reference_blas::dot(size, x_v.data() + j * stride_x, incX,
+                                      y_v.data(), incY);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  // Iterators
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(y_size, q);
+  auto gpu_rs_v = helper::allocate<mem_alloc, scalar_t>(k, q);
+
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, x_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, y_size);
+
+  auto multi_dot_event =
+      _multi_dot(sb_handle, size, k, gpu_x_v, incX, stride_x, gpu_y_v, incY,
+                 gpu_rs_v, {copy_x, copy_y});
+  sb_handle.wait(multi_dot_event);
+
+  auto event = helper::copy_to_host(q, gpu_rs_v, rs_v.data(), k);
+  sb_handle.wait(event);
+
+  // Validate the result
+  const bool isAlmostEqual = utils::compare_vectors(rs_v, rs_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_rs_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t k;
+  index_t incX;
+  index_t incY;
+  index_t stride_mul_x;
+  std::tie(alloc, size, k, incX, incY, stride_mul_x) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 1002, 10240),  // size
+                       ::testing::Values(1, 4, 33),         // k
+                       ::testing::Values(1, 2),             // incX
+                       ::testing::Values(1, -3),            // incY
+                       ::testing::Values(1, 2)              // stride_mul_x
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, k, incX, incY, stride_mul_x;
+  BLAS_GENERATE_NAME(info.param, alloc, size, k, incX, incY, stride_mul_x);
+}
+
+BLAS_REGISTER_TEST_ALL(Multi_dot, combination_t, combi, generate_name);
@@ -0,0 +1,175 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename rot_batch_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<std::string, index_t, index_t, index_t, index_t, index_t,
+               index_t>;
+
+// The rotations computed by _rotg_batch are applied by _rot_batch, as in a
+// step of a batched QR factorization.
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t offset;
+  index_t size;
+  index_t incX;
+  index_t incY;
+  index_t stride_cs;
+  index_t batch_size;
+  std::tie(alloc, offset, size, incX, incY, stride_cs, batch_size) = combi;
+
+  // The batches start offset elements after the beginning of the memory
+  const index_t stride_x{size * std::abs(incX)};
+  const index_t stride_y{size * std::abs(incY) * 2};
+  const index_t x_size = offset + stride_x * batch_size;
+  const index_t y_size = offset + stride_y * batch_size;
+  const index_t cs_size = offset + stride_cs * batch_size;
+
+  std::vector<scalar_t> a_v(cs_size);
+  std::vector<scalar_t> b_v(cs_size);
+  std::vector<scalar_t> c_v(cs_size);
+  std::vector<scalar_t> s_v(cs_size);
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v(y_size);
+  fill_random(a_v);
+  fill_random(b_v);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  // Reference implementation
+  std::vector<scalar_t> a_cpu_v(a_v);
+  std::vector<scalar_t> b_cpu_v(b_v);
+  std::vector<scalar_t> c_cpu_v(cs_size);
+  std::vector<scalar_t> s_cpu_v(cs_size);
+  std::vector<scalar_t> x_cpu_v(x_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+  for (index_t i = 0; i < batch_size; ++i) {
+    const index_t j = offset + i * stride_cs;
+    reference_blas::rotg(&a_cpu_v[j], &b_cpu_v[j], &c_cpu_v[j], &s_cpu_v[j]);
+    reference_blas::rot(size, x_cpu_v.data() + offset + i * stride_x, incX,
+                        y_cpu_v.data() + offset + i * stride_y, incY,
+                        c_cpu_v[j], s_cpu_v[j]);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_a_v = helper::allocate<mem_alloc, scalar_t>(cs_size, q);
+  auto gpu_b_v = helper::allocate<mem_alloc, scalar_t>(cs_size, q);
+  auto gpu_c_v = helper::allocate<mem_alloc, scalar_t>(cs_size, q);
+  auto gpu_s_v = helper::allocate<mem_alloc, scalar_t>(cs_size, q);
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(y_size, q);
+
+  auto copy_a = helper::copy_to_device(q, a_v.data(), gpu_a_v, cs_size);
+  auto copy_b = helper::copy_to_device(q, b_v.data(), gpu_b_v, cs_size);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, x_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, y_size);
+
+  auto rotg_event = _rotg_batch(sb_handle, gpu_a_v + offset, stride_cs,
+                                gpu_b_v + offset, stride_cs, gpu_c_v + offset,
+                                stride_cs, gpu_s_v + offset, stride_cs,
+                                batch_size, {copy_a, copy_b, copy_x, copy_y});
+  auto rot_event =
+      _rot_batch(sb_handle, size, gpu_x_v + offset, incX, stride_x,
+                 gpu_y_v + offset, incY, stride_y, gpu_c_v + offset, stride_cs,
+                 gpu_s_v + offset, stride_cs, batch_size, rotg_event);
+  sb_handle.wait(rot_event);
+
+  auto event1 = helper::copy_to_host(q, gpu_a_v, a_v.data(), cs_size);
+  auto event2 = helper::copy_to_host(q, gpu_b_v, b_v.data(), cs_size);
+  auto event3 = helper::copy_to_host(q, gpu_c_v, c_v.data(), cs_size);
+  auto event4 = helper::copy_to_host(q, gpu_s_v, s_v.data(), cs_size);
+  auto event5 = helper::copy_to_host(q, gpu_x_v, x_v.data(), x_size);
+  auto event6 = helper::copy_to_host(q, gpu_y_v, y_v.data(), y_size);
+  sb_handle.wait({event1, event2, event3, event4, event5, event6});
+
+  // Validate the result, only the elements of the batch are compared as the
+  // others are left uninitialized
+  for (index_t i = 0; i < batch_size; ++i) {
+    const index_t j = offset + i * stride_cs;
+    ASSERT_TRUE(utils::almost_equal(a_v[j], a_cpu_v[j]));
+    ASSERT_TRUE(utils::almost_equal(b_v[j], b_cpu_v[j]));
+    ASSERT_TRUE(utils::almost_equal(c_v[j], c_cpu_v[j]));
+    ASSERT_TRUE(utils::almost_equal(s_v[j], s_cpu_v[j]));
+  }
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+
+  helper::deallocate<mem_alloc>(gpu_a_v, q);
+  helper::deallocate<mem_alloc>(gpu_b_v, q);
+  helper::deallocate<mem_alloc>(gpu_c_v, q);
+  helper::deallocate<mem_alloc>(gpu_s_v, q);
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t offset;
+  index_t size;
+  index_t incX;
+  index_t incY;
+  index_t stride_cs;
+  index_t batch_size;
+  std::tie(alloc, offset, size, incX, incY, stride_cs, batch_size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(0, 3),          // offset
+                       ::testing::Values(11, 1002),      // size
+                       ::testing::Values(1, -2),         // incX
+                       ::testing::Values(1, 3),          // incY
+                       ::testing::Values(1, 3),          // stride_cs
+                       ::testing::Values(1, 5, 130)      // batch_size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t offset, size, incX, incY, stride_cs, batch_size;
+  BLAS_GENERATE_NAME(info.param, alloc, offset, size, incX, incY, stride_cs,
+                     batch_size);
+}
+
+BLAS_REGISTER_TEST_ALL(Rot_batch, combination_t, combi, generate_name);
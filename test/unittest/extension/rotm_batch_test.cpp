@@ -0,0 +1,150 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename rotm_batch_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<std::string, index_t, index_t, index_t, index_t, index_t,
+               index_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t offset;
+  index_t size;
+  index_t incX;
+  index_t incY;
+  index_t stride_param;
+  index_t batch_size;
+  std::tie(alloc, offset, size, incX, incY, stride_param, batch_size) = combi;
+
+  // The batches start offset elements after the beginning of the memory
+  constexpr index_t param_size = 5;
+  const index_t stride_x{size * std::abs(incX)};
+  const index_t stride_y{size * std::abs(incY)};
+  const index_t x_size = offset + stride_x * batch_size;
+  const index_t y_size = offset + stride_y * batch_size;
+  const index_t p_size =
+      offset + ((stride_param) ? stride_param * batch_size : param_size);
+
+  // The flags of the rotations cycle through all the forms of H
+  const scalar_t flags[] = {scalar_t{-2}, scalar_t{-1}, scalar_t{0},
+                            scalar_t{1}, scalar_t{-4}};
+  std::vector<scalar_t> param(p_size);
+  fill_random(param);
+  for (index_t i = 0; i < batch_size; ++i) {
+    param[offset + i * stride_param] = flags[i % 5];
+  }
+
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v(y_size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  // Reference implementation
+  std::vector<scalar_t> x_cpu_v(x_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+  for (index_t i = 0; i < batch_size; ++i) {
+    reference_blas::rotm(size, x_cpu_v.data() + offset + i * stride_x, incX,
+                         y_cpu_v.data() + offset + i * stride_y, incY,
+                         param.data() + offset + i * stride_param);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(x_size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(y_size, q);
+  auto gpu_param = helper::allocate<mem_alloc, scalar_t>(p_size, q);
+
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, x_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, y_size);
+  auto copy_param = helper::copy_to_device(q, param.data(), gpu_param, p_size);
+
+  auto rotm_event = _rotm_batch(sb_handle, size, gpu_x_v + offset, incX,
+                                stride_x, gpu_y_v + offset, incY, stride_y,
+                                gpu_param + offset, stride_param, batch_size,
+                                {copy_x, copy_y, copy_param});
+  sb_handle.wait(rotm_event);
+
+  auto event1 = helper::copy_to_host(q, gpu_x_v, x_v.data(), x_size);
+  auto event2 = helper::copy_to_host(q, gpu_y_v, y_v.data(), y_size);
+  sb_handle.wait({event1, event2});
+
+  // Validate the result
+  const bool isAlmostEqual = utils::compare_vectors(x_v, x_cpu_v) &&
+                             utils::compare_vectors(y_v, y_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_param, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t offset;
+  index_t size;
+  index_t incX;
+  index_t incY;
+  index_t stride_param;
+  index_t batch_size;
+  std::tie(alloc, offset, size, incX, incY, stride_param, batch_size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(0, 3),          // offset
+                       ::testing::Values(11, 1002),      // size
+                       ::testing::Values(1, 4),          // incX
+                       ::testing::Values(1, -3),         // incY
+                       ::testing::Values(0, 5, 8),       // stride_param
+                       ::testing::Values(1, 5, 130)      // batch_size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t offset, size, incX, incY, stride_param, batch_size;
+  BLAS_GENERATE_NAME(info.param, alloc, offset, size, incX, incY, stride_param,
+                     batch_size);
+}
+
+BLAS_REGISTER_TEST_ALL(Rotm_batch, combination_t, combi, generate_name);
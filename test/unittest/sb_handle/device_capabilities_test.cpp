@@ -0,0 +1,80 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename device_capabilities_test.cpp
+ *
+ **************************************************************************/
+
+#include <algorithm>
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<index_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  index_t num_handles;
+  std::tie(num_handles) = combi;
+
+  auto q = make_queue();
+  const auto device = q.get_device();
+  const auto& caps = blas::Device_Capabilities::get(device);
+
+  // Queried once, shared by all the handles on the device
+  ASSERT_EQ(&blas::Device_Capabilities::get(device), &caps);
+  for (index_t i = 0; i < num_handles; ++i) {
+    blas::SB_Handle sb_handle(sycl::queue(q.get_context(), device));
+    ASSERT_EQ(&sb_handle.get_device_capabilities(), &caps);
+    ASSERT_EQ(sb_handle.get_work_group_size(), caps.work_group_size);
+    ASSERT_EQ(sb_handle.get_num_compute_units(), caps.compute_units);
+    ASSERT_EQ(sb_handle.has_local_memory(), caps.has_local_memory);
+    ASSERT_EQ(sb_handle.is_single_pass_reduction(), caps.has_device_atomics);
+  }
+
+  ASSERT_EQ(caps.vendor, device.get_info<sycl::info::device::vendor>());
+  ASSERT_EQ(caps.is_gpu, device.is_gpu());
+  ASSERT_EQ(caps.max_work_group_size,
+            device.get_info<sycl::info::device::max_work_group_size>());
+  ASSERT_LE(caps.work_group_size, size_t{256});
+  ASSERT_EQ(caps.local_mem_size,
+            device.get_info<sycl::info::device::local_mem_size>());
+  ASSERT_EQ(caps.has_fp64, device.has(sycl::aspect::fp64));
+  ASSERT_FALSE(caps.sub_group_sizes.empty());
+  ASSERT_TRUE(std::is_sorted(caps.sub_group_sizes.begin(),
+                             caps.sub_group_sizes.end()));
+  ASSERT_EQ(caps.min_sub_group_size, caps.sub_group_sizes.front());
+  ASSERT_EQ(caps.max_sub_group_size, caps.sub_group_sizes.back());
+}
+
+template <typename scalar_t>
+const auto combi = ::testing::Combine(::testing::Values(1, 4)  // handles
+);
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  index_t num_handles;
+  BLAS_GENERATE_NAME(info.param, num_handles);
+}
+
+BLAS_REGISTER_TEST_ALL(DeviceCapabilities, combination_t, combi,
+                       generate_name);
@@ -0,0 +1,198 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename event_allocation_test.cpp
+ *
+ **************************************************************************/
+
+#include <cstdlib>
+#include <new>
+
+#include "blas_test.hpp"
+
+// Heap allocations made by the test thread while counting is enabled. The
+// SYCL runtime worker threads are not accounted for.
+static thread_local bool count_allocations = false;
+static thread_local size_t allocation_count = 0;
+
+void* operator new(std::size_t size) {
+  if (count_allocations) ++allocation_count;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+  if (count_allocations) ++allocation_count;
+  const std::size_t alignment = static_cast<std::size_t>(align);
+  const std::size_t bytes = ((size + alignment - 1) / alignment) * alignment;
+  if (void* ptr = std::aligned_alloc(alignment, bytes == 0 ? alignment : bytes))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+template <typename function_t>
+size_t count_heap_allocations(function_t func) {
+  allocation_count = 0;
+  count_allocations = true;
+  func();
+  count_allocations = false;
+  return allocation_count;
+}
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, index_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  using event_t = typename blas::SB_Handle::event_t;
+  std::string alloc;
+  index_t size;
+  index_t num_dependencies;
+  std::tie(alloc, size, num_dependencies) = combi;
+
+  constexpr int repetitions = 5;
+  const scalar_t alpha{1.5};
+
+  std::vector<scalar_t> x_v(size);
+  std::vector<scalar_t> y_v(size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size);
+  sb_handle.wait({copy_x, copy_y});
+
+  // Building, copying and merging event lists within the inline capacity
+  // must not touch the heap.
+  event_t dependencies;
+  auto list_allocations = count_heap_allocations([&]() {
+    for (index_t i = 0; i < num_dependencies; ++i) {
+      dependencies.push_back(copy_y);
+    }
+    event_t copy = dependencies;
+    event_t merged = concatenate_vectors(event_t{}, copy);
+    ASSERT_EQ(merged.size(), static_cast<size_t>(num_dependencies));
+  });
+  ASSERT_EQ(list_allocations, size_t{0});
+
+  // Reach a steady state: kernels compiled and runtime caches populated
+  for (int i = 0; i < repetitions; ++i) {
+    sb_handle.wait(_axpy(sb_handle, size, alpha, gpu_x_v, index_t{1}, gpu_y_v,
+                         index_t{1}, dependencies));
+  }
+
+  // Equivalent kernel submitted directly to the queue, measuring the
+  // allocations made by the SYCL runtime for a submission.
+  const size_t local_size = sb_handle.get_work_group_size();
+  const size_t global_size = roundUp<size_t>(size, local_size);
+  auto raw_axpy = [&]() {
+    return q.submit([&](sycl::handler& cgh) {
+      for (const auto& dep : dependencies) {
+        cgh.depends_on(dep);
+      }
+      auto x = gpu_x_v;
+      auto y = gpu_y_v;
+      cgh.parallel_for(
+          sycl::nd_range<1>(sycl::range<1>(global_size),
+                            sycl::range<1>(local_size)),
+          [=](sycl::nd_item<1> id) {
+            const auto i = id.get_global_id(0);
+            if (i < static_cast<size_t>(size)) {
+              y[i] += alpha * x[i];
+            }
+          });
+    });
+  };
+  raw_axpy().wait();
+
+  size_t raw_allocations = std::numeric_limits<size_t>::max();
+  size_t axpy_allocations = std::numeric_limits<size_t>::max();
+  for (int i = 0; i < repetitions; ++i) {
+    sycl::event raw_event;
+    raw_allocations = std::min(
+        raw_allocations,
+        count_heap_allocations([&]() { raw_event = raw_axpy(); }));
+    raw_event.wait();
+
+    event_t axpy_event;
+    axpy_allocations = std::min(
+        axpy_allocations, count_heap_allocations([&]() {
+          axpy_event = _axpy(sb_handle, size, alpha, gpu_x_v, index_t{1},
+                             gpu_y_v, index_t{1}, dependencies);
+        }));
+    ASSERT_TRUE(axpy_event.is_inline());
+    sb_handle.wait(axpy_event);
+  }
+
+  // The BLAS call must not allocate on top of the kernel submission itself
+  ASSERT_LE(axpy_allocations, raw_allocations);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t num_dependencies;
+  std::tie(alloc, size, num_dependencies) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    // Accessor creation allocates in the runtime, only USM is measured
+    GTEST_SKIP();
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm"),          // allocation type
+                       ::testing::Values(11, 1002),       // size
+                       ::testing::Values(0, 1, 2, 4)      // dependencies
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, num_dependencies;
+  BLAS_GENERATE_NAME(info.param, alloc, size, num_dependencies);
+}
+
+BLAS_REGISTER_TEST_ALL(EventAllocation, combination_t, combi, generate_name);
@@ -0,0 +1,147 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename execution_plan_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, scalar_t, index_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  scalar_t alpha;
+  index_t replays;
+  std::tie(alloc, size, alpha, replays) = combi;
+
+  std::vector<scalar_t> x_v(size);
+  std::vector<scalar_t> y_v(size);
+  fill_random(x_v);
+  fill_random(y_v);
+  // Lower triangular matrix with a dominant diagonal
+  std::vector<scalar_t> a_m(size * size, scalar_t{0});
+  for (index_t j = 0; j < size; ++j) {
+    a_m[j * size + j] = random_scalar(scalar_t(9), scalar_t(11));
+    for (index_t i = j + 1; i < size; ++i) {
+      a_m[j * size + i] =
+          random_scalar(scalar_t(-10), scalar_t(10)) / scalar_t(size);
+    }
+  }
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_a_m = helper::allocate<mem_alloc, scalar_t>(size * size, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size);
+  auto copy_a = helper::copy_to_device(q, a_m.data(), gpu_a_m, size * size);
+  sb_handle.wait({copy_x, copy_y, copy_a});
+
+  // Capture y = alpha * x + y, x = alpha * x and y = inv(A) * y. Capturing
+  // with the command group backend also runs the calls once.
+  blas::Execution_Plan plan(blas::plan_backend_t::command_group);
+  sb_handle.begin_capture(plan);
+  try {
+    auto axpy_event = _axpy(sb_handle, size, alpha, gpu_x_v, index_t{1},
+                            gpu_y_v, index_t{1});
+    auto scal_event =
+        _scal(sb_handle, size, alpha, gpu_x_v, index_t{1}, axpy_event);
+    auto trsv_event = _trsv(sb_handle, 'l', 'n', 'n', size, gpu_a_m, size,
+                            gpu_y_v, index_t{1}, axpy_event);
+    sb_handle.end_capture();
+    sb_handle.wait(concatenate_vectors(scal_event, trsv_event));
+  } catch (const blas::unsupported_exception& ue) {
+    sb_handle.end_capture();
+    GTEST_SKIP();
+  }
+  // The reset of the trsv synchronization counters is recorded as well
+  ASSERT_EQ(plan.size(), size_t{4});
+
+  // Reference implementation
+  std::vector<scalar_t> x_cpu_v = x_v;
+  std::vector<scalar_t> y_cpu_v = y_v;
+  for (index_t r = 0; r <= replays; ++r) {
+    reference_blas::axpy(size, alpha, x_cpu_v.data(), 1, y_cpu_v.data(), 1);
+    reference_blas::scal(size, alpha, x_cpu_v.data(), 1);
+    reference_blas::trsv("l", "n", "n", size, a_m.data(), size,
+                         y_cpu_v.data(), 1);
+  }
+
+  for (index_t r = 0; r < replays; ++r) {
+    auto replay_event = plan.replay();
+    sb_handle.wait(replay_event);
+  }
+
+  auto event_x = helper::copy_to_host(q, gpu_x_v, x_v.data(), size);
+  auto event_y = helper::copy_to_host(q, gpu_y_v, y_v.data(), size);
+  sb_handle.wait({event_x, event_y});
+
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_a_m, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  scalar_t alpha;
+  index_t replays;
+  std::tie(alloc, size, alpha, replays) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 1002),      // size
+                       ::testing::Values<scalar_t>(0.5, 1.1),  // alpha
+                       ::testing::Values(1, 3)                 // replays
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, replays;
+  T alpha;
+  BLAS_GENERATE_NAME(info.param, alloc, size, alpha, replays);
+}
+
+BLAS_REGISTER_TEST_ALL(ExecutionPlan, combination_t, combi, generate_name);
@@ -0,0 +1,126 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename kernel_trace_test.cpp
+ *
+ **************************************************************************/
+
+#include <sstream>
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, bool>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  bool profiling;
+  std::tie(alloc, size, profiling) = combi;
+
+  std::vector<scalar_t> x_v(size);
+  std::vector<scalar_t> y_v(size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  auto q = profiling ? sycl::queue(make_queue().get_device(),
+                                   {sycl::property::queue::enable_profiling()})
+                     : make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_out_s = helper::allocate<mem_alloc, scalar_t>(1, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size);
+  sb_handle.wait({copy_x, copy_y});
+
+  blas::Kernel_Trace trace;
+  sb_handle.set_trace(&trace);
+  auto axpy_event = _axpy(sb_handle, size, scalar_t{2}, gpu_x_v, index_t{1},
+                          gpu_y_v, index_t{1});
+  auto asum_event =
+      _asum(sb_handle, size, gpu_y_v, index_t{1}, gpu_out_s, axpy_event);
+  sb_handle.wait(asum_event);
+  sb_handle.set_trace(nullptr);
+
+  // Not traced anymore
+  sb_handle.wait(_scal(sb_handle, size, scalar_t{2}, gpu_x_v, index_t{1}));
+
+  const auto records = trace.get_records();
+  ASSERT_GE(records.size(), size_t{2});
+  ASSERT_EQ(std::string(records[0].call), "_axpy");
+  ASSERT_EQ(blas::Kernel_Trace::short_tree_name(records[0]), "Assign");
+  ASSERT_EQ(records[0].global_size % records[0].local_size, size_t{0});
+  ASSERT_GE(records[0].global_size, static_cast<size_t>(size));
+  for (size_t i = 1; i < records.size(); ++i) {
+    ASSERT_EQ(std::string(records[i].call), "_asum");
+  }
+
+  std::ostringstream json;
+  trace.export_chrome_trace(json);
+  const auto str = json.str();
+  ASSERT_EQ(str.find("{\"traceEvents\":["), size_t{0});
+  ASSERT_NE(str.find("\"cat\":\"_axpy\""), std::string::npos);
+  ASSERT_NE(str.find("\"cat\":\"_asum\""), std::string::npos);
+  ASSERT_EQ(str.find("\"ph\":\"X\"") != std::string::npos, profiling);
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_out_s, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  bool profiling;
+  std::tie(alloc, size, profiling) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 65536),     // size
+                       ::testing::Values(true, false)    // profiling
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size;
+  bool profiling;
+  BLAS_GENERATE_NAME(info.param, alloc, size, profiling);
+}
+
+BLAS_REGISTER_TEST_ALL(KernelTrace, combination_t, combi, generate_name);
@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename kernel_warmup_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  const index_t m = size;
+  const index_t n = 33;
+  const index_t k = size;
+  std::vector<scalar_t> a_m(m * k);
+  std::vector<scalar_t> b_m(k * n);
+  std::vector<scalar_t> c_m(m * n);
+  std::vector<scalar_t> x_v(k);
+  std::vector<scalar_t> y_v(n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(x_v);
+  std::vector<scalar_t> c_cpu_m(m * n);
+  std::vector<scalar_t> y_cpu_v(n);
+  reference_blas::gemm("n", "n", m, n, k, scalar_t{1}, a_m.data(), m,
+                       b_m.data(), k, scalar_t{0}, c_cpu_m.data(), m);
+  reference_blas::gemv("t", k, n, scalar_t{1}, b_m.data(), k, x_v.data(), 1,
+                       scalar_t{0}, y_cpu_v.data(), 1);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  auto m_a_gpu = helper::allocate<mem_alloc, scalar_t>(m * k, q);
+  auto m_b_gpu = helper::allocate<mem_alloc, scalar_t>(k * n, q);
+  auto m_c_gpu = helper::allocate<mem_alloc, scalar_t>(m * n, q);
+  auto v_x_gpu = helper::allocate<mem_alloc, scalar_t>(k, q);
+  auto v_y_gpu = helper::allocate<mem_alloc, scalar_t>(n, q);
+
+  auto gemm_op = [&](blas::SB_Handle& handle) {
+    _gemm(handle, 'n', 'n', m, n, k, scalar_t{1}, m_a_gpu, m, m_b_gpu, k,
+          scalar_t{0}, m_c_gpu, m);
+  };
+  auto gemv_op = [&](blas::SB_Handle& handle) {
+    _gemv(handle, 't', k, n, scalar_t{1}, m_b_gpu, k, v_x_gpu, index_t{1},
+          scalar_t{0}, v_y_gpu, index_t{1});
+  };
+
+  // The warmup does not submit anything
+  blas::Kernel_Trace trace;
+  sb_handle.set_trace(&trace);
+  blas::Kernel_Warmup warmup;
+  sb_handle.warmup(warmup, {gemm_op, gemv_op});
+  sb_handle.set_trace(nullptr);
+  ASSERT_EQ(trace.size(), size_t{0});
+  const size_t num_kernels = warmup.size();
+  ASSERT_GE(num_kernels, size_t{2});
+#ifndef __ADAPTIVECPP__
+  ASSERT_EQ(warmup.get_kernel_bundles().size(), size_t{1});
+#endif
+
+  // The kernels are only recorded once
+  sb_handle.warmup(warmup, {gemm_op, gemv_op});
+  ASSERT_EQ(warmup.size(), num_kernels);
+#ifndef __ADAPTIVECPP__
+  ASSERT_EQ(warmup.get_kernel_bundles().size(), size_t{1});
+#endif
+
+  // The warmed up calls run as usual
+  auto copy_a = helper::copy_to_device(q, a_m.data(), m_a_gpu, m * k);
+  auto copy_b = helper::copy_to_device(q, b_m.data(), m_b_gpu, k * n);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), v_x_gpu, k);
+  sb_handle.wait({copy_a, copy_b, copy_x});
+  gemm_op(sb_handle);
+  gemv_op(sb_handle);
+  sb_handle.wait();
+
+  auto copy_c = helper::copy_to_host(q, m_c_gpu, c_m.data(), m * n);
+  auto copy_y = helper::copy_to_host(q, v_y_gpu, y_v.data(), n);
+  sb_handle.wait({copy_c, copy_y});
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_cpu_m));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+
+  helper::deallocate<mem_alloc>(m_a_gpu, q);
+  helper::deallocate<mem_alloc>(m_b_gpu, q);
+  helper::deallocate<mem_alloc>(m_c_gpu, q);
+  helper::deallocate<mem_alloc>(v_x_gpu, q);
+  helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 1002)       // size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size;
+  BLAS_GENERATE_NAME(info.param, alloc, size);
+}
+
+BLAS_REGISTER_TEST_ALL(KernelWarmup, combination_t, combi, generate_name);
@@ -0,0 +1,142 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename reproducible_test.cpp
+ *
+ **************************************************************************/
+
+#include <cstring>
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, bool>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  bool single_pass;
+  std::tie(alloc, size, single_pass) = combi;
+
+  constexpr int repetitions = 4;
+  // Number of reductions: dot, asum, nrm2 and axpy_dot
+  constexpr int num_ops = 4;
+
+  std::vector<scalar_t> x_v(size);
+  std::vector<scalar_t> y_v(size);
+  fill_random(x_v);
+  fill_random(y_v);
+
+  // Reference implementation, axpy_dot with alpha = 0 leaves y unchanged
+  std::vector<scalar_t> rs_cpu_v = {
+      reference_blas::dot(size, x_v.data(), 1, y_v.data(), 1),
+      reference_blas::asum(size, x_v.data(), 1),
+      reference_blas::nrm2(size, x_v.data(), 1),
+      reference_blas::dot(size, y_v.data(), 1, x_v.data(), 1)};
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  ASSERT_FALSE(sb_handle.is_reproducible());
+  sb_handle.set_reproducible(true);
+  ASSERT_TRUE(sb_handle.is_reproducible());
+  sb_handle.set_single_pass_reduction(single_pass);
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(size, q);
+  auto gpu_rs_v = helper::allocate<mem_alloc, scalar_t>(num_ops, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, size);
+  sb_handle.wait({copy_x, copy_y});
+
+  std::vector<scalar_t> first_v(num_ops);
+  for (int r = 0; r < repetitions; ++r) {
+    // The results are overwritten, whatever the initial values
+    std::vector<scalar_t> rs_v(num_ops, scalar_t{10});
+    auto copy_rs = helper::copy_to_device(q, rs_v.data(), gpu_rs_v, num_ops);
+    sb_handle.wait(copy_rs);
+
+    auto dot_event = _dot(sb_handle, size, gpu_x_v, index_t{1}, gpu_y_v,
+                          index_t{1}, gpu_rs_v);
+    auto asum_event =
+        _asum(sb_handle, size, gpu_x_v, index_t{1}, gpu_rs_v + 1);
+    auto nrm2_event =
+        _nrm2(sb_handle, size, gpu_x_v, index_t{1}, gpu_rs_v + 2);
+    sb_handle.wait({dot_event, asum_event, nrm2_event});
+    auto axpy_dot_event =
+        _axpy_dot(sb_handle, size, scalar_t{0}, gpu_x_v, index_t{1}, gpu_y_v,
+                  index_t{1}, gpu_x_v, index_t{1}, gpu_rs_v + 3);
+    sb_handle.wait(axpy_dot_event);
+
+    auto event = helper::copy_to_host(q, gpu_rs_v, rs_v.data(), num_ops);
+    sb_handle.wait(event);
+
+    ASSERT_TRUE(utils::compare_vectors(rs_v, rs_cpu_v));
+    if (r == 0) {
+      first_v = rs_v;
+    } else {
+      // Bitwise identical to the first run
+      ASSERT_EQ(std::memcmp(rs_v.data(), first_v.data(),
+                            num_ops * sizeof(scalar_t)),
+                0);
+    }
+  }
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+  helper::deallocate<mem_alloc>(gpu_rs_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  bool single_pass;
+  std::tie(alloc, size, single_pass) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 1002, 1002400),  // size
+                       ::testing::Values(false, true)         // single pass
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size;
+  bool single_pass;
+  BLAS_GENERATE_NAME(info.param, alloc, size, single_pass);
+}
+
+BLAS_REGISTER_TEST_ALL(Reproducible, combination_t, combi, generate_name);
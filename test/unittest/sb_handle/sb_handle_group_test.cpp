@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename sb_handle_group_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t, index_t, index_t>;
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t num_queues;
+  index_t batch_size;
+  std::tie(alloc, size, num_queues, batch_size) = combi;
+
+  const scalar_t alpha{1.5};
+  const index_t stride = 2 * size;
+  const index_t total_size = stride * batch_size;
+
+  std::vector<scalar_t> x_v(total_size);
+  std::vector<scalar_t> y_v(total_size);
+  fill_random(x_v);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v = y_v;
+
+  // Reference implementation
+  for (index_t i = 0; i < batch_size; ++i) {
+    reference_blas::axpy(size, alpha, x_v.data() + i * stride, 1,
+                         y_cpu_v.data() + i * stride, 1);
+  }
+
+  // The queues of a group share a context, here they also share the device so
+  // that the test runs on devices that cannot be partitioned.
+  auto q = make_queue();
+  std::vector<sycl::queue> queues;
+  for (index_t i = 0; i < num_queues; ++i) {
+    queues.emplace_back(q.get_context(), q.get_device());
+  }
+  blas::SB_Handle_Group sb_handle_group(queues);
+  ASSERT_EQ(sb_handle_group.size(), static_cast<size_t>(num_queues));
+
+  auto gpu_x_v = helper::allocate<mem_alloc, scalar_t>(total_size, q);
+  auto gpu_y_v = helper::allocate<mem_alloc, scalar_t>(total_size, q);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), gpu_x_v, total_size);
+  auto copy_y = helper::copy_to_device(q, y_v.data(), gpu_y_v, total_size);
+
+  auto axpy_batch_event =
+      _axpy_batch(sb_handle_group, size, alpha, gpu_x_v, index_t{1}, stride,
+                  gpu_y_v, index_t{1}, stride, batch_size, {copy_x, copy_y});
+  ASSERT_EQ(axpy_batch_event.size(),
+            static_cast<size_t>(std::min(num_queues, batch_size)));
+  sb_handle_group.wait(axpy_batch_event);
+
+  auto event = helper::copy_to_host(q, gpu_y_v, y_v.data(), total_size);
+  sb_handle_group.wait({event});
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+
+  helper::deallocate<mem_alloc>(gpu_x_v, q);
+  helper::deallocate<mem_alloc>(gpu_y_v, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  index_t num_queues;
+  index_t batch_size;
+  std::tie(alloc, size, num_queues, batch_size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 1002),      // size
+                       ::testing::Values(1, 2, 3),       // number of queues
+                       ::testing::Values(1, 5, 7)        // batch_size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size, num_queues, batch_size;
+  BLAS_GENERATE_NAME(info.param, alloc, size, num_queues, batch_size);
+}
+
+BLAS_REGISTER_TEST_ALL(SBHandleGroup, combination_t, combi, generate_name);
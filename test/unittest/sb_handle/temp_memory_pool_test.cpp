@@ -0,0 +1,289 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename temp_memory_pool_test.cpp
+ *
+ **************************************************************************/
+
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t>;
+
+template <helper::AllocType mem_alloc, typename scalar_t>
+auto acquire_mem(blas::Temp_Mem_Pool& pool, index_t size) {
+#ifdef SB_ENABLE_USM
+  if constexpr (mem_alloc == helper::AllocType::usm) {
+    return pool.acquire_usm_mem<scalar_t>(size);
+  } else
+#endif
+  {
+    return pool.acquire_buff_mem<scalar_t>(size);
+  }
+}
+
+template <helper::AllocType mem_alloc, typename container_t>
+void reclaim_mem(blas::Temp_Mem_Pool& pool, const container_t& mem) {
+#ifdef SB_ENABLE_USM
+  if constexpr (mem_alloc == helper::AllocType::usm) {
+    pool.reclaim_usm_mem(mem);
+  } else
+#endif
+  {
+    pool.reclaim_buff_mem(mem);
+  }
+}
+
+// Limits, trimming and statistics of a pool
+template <typename scalar_t, helper::AllocType mem_alloc>
+void check_limits(sycl::queue q, index_t size) {
+  using arena_t = blas::Size_Class_Arena<void*>;
+  const size_t byte_size = size * sizeof(scalar_t);
+  const size_t class_byte_size =
+      arena_t::class_byte_size(arena_t::size_class(byte_size));
+  const bool large = !arena_t::is_small(arena_t::size_class(byte_size));
+
+  blas::Temp_Mem_Pool_Config config;
+  config.trim_idle_time = std::chrono::milliseconds(0);
+  if (large) {
+    config.max_allocated_bytes = class_byte_size;
+  }
+  blas::Temp_Mem_Pool pool(q, config);
+
+  auto mem = acquire_mem<mem_alloc, scalar_t>(pool, size);
+  if (large) {
+    // Beyond the limit while the first block is in use
+    ASSERT_THROW((acquire_mem<mem_alloc, scalar_t>(pool, size)),
+                 std::bad_alloc);
+  }
+  reclaim_mem<mem_alloc>(pool, mem);
+  mem = acquire_mem<mem_alloc, scalar_t>(pool, size);
+  reclaim_mem<mem_alloc>(pool, mem);
+
+  auto stats = pool.get_stats();
+  ASSERT_EQ(stats.hits, size_t{1});
+  ASSERT_EQ(stats.misses, size_t{1});
+  ASSERT_GE(stats.high_water_mark, class_byte_size);
+  ASSERT_GE(stats.bytes_cached, class_byte_size);
+  ASSERT_GE(stats.max_acquire_us, stats.avg_acquire_us);
+
+  if (large) {
+    // A smaller class makes room by freeing the cached block
+    auto half = acquire_mem<mem_alloc, scalar_t>(
+        pool, class_byte_size / 2 / sizeof(scalar_t));
+    ASSERT_EQ(pool.get_stats().bytes_trimmed, class_byte_size);
+    reclaim_mem<mem_alloc>(pool, half);
+
+    // Nothing is in use, all the large blocks are idle
+    ASSERT_EQ(pool.trim(), class_byte_size / 2);
+    stats = pool.get_stats();
+    ASSERT_EQ(stats.bytes_allocated, size_t{0});
+    ASSERT_EQ(stats.high_water_mark, class_byte_size);
+  }
+}
+
+// The small blocks cached by a thread are given back to the pool when the
+// thread exits
+template <typename scalar_t, helper::AllocType mem_alloc>
+void check_thread_exit(sycl::queue q) {
+  blas::Temp_Mem_Pool pool(q);
+  using mem_t = decltype(acquire_mem<mem_alloc, scalar_t>(pool, 1));
+  std::optional<mem_t> mem;
+  std::thread thread([&]() {
+    mem.emplace(acquire_mem<mem_alloc, scalar_t>(pool, 1));
+    reclaim_mem<mem_alloc>(pool, *mem);
+  });
+  thread.join();
+
+  auto reused = acquire_mem<mem_alloc, scalar_t>(pool, 1);
+#ifdef SB_ENABLE_USM
+  if constexpr (mem_alloc == helper::AllocType::usm) {
+    // Most recently released first
+    ASSERT_EQ(reused, *mem);
+  } else
+#endif
+  {
+    ASSERT_EQ(pool.get_stats().hits, size_t{1});
+  }
+  reclaim_mem<mem_alloc>(pool, reused);
+}
+
+#ifdef SB_ENABLE_USM
+// Blocks acquired concurrently by several threads must not be shared
+template <typename scalar_t>
+void check_concurrent_usm(blas::Temp_Mem_Pool& pool, index_t size) {
+  constexpr int num_threads = 8;
+  constexpr int blocks_per_thread = 32;
+  std::mutex mutex;
+  std::set<scalar_t*> acquired;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int round = 0; round < 4; ++round) {
+        std::vector<scalar_t*> blocks;
+        for (int i = 0; i < blocks_per_thread; ++i) {
+          // Mix of small and large classes
+          blocks.push_back(pool.acquire_usm_mem<scalar_t>((i % 2) ? size : 1));
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          for (auto block : blocks) {
+            ASSERT_TRUE(acquired.insert(block).second);
+          }
+        }
+        std::this_thread::yield();
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          for (auto block : blocks) {
+            acquired.erase(block);
+          }
+        }
+        for (auto block : blocks) {
+          pool.reclaim_usm_mem(block);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+#endif
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  auto q = make_queue();
+  blas::Temp_Mem_Pool pool(q);
+
+#ifdef SB_ENABLE_USM
+  if constexpr (mem_alloc == helper::AllocType::usm) {
+    // A released block is reused for a request of the same size class
+    auto mem = pool.acquire_usm_mem<scalar_t>(size);
+    pool.reclaim_usm_mem(mem);
+    auto small = pool.acquire_usm_mem<scalar_t>(1);
+    ASSERT_NE(small, mem);
+    ASSERT_EQ(pool.acquire_usm_mem<scalar_t>(size), mem);
+    pool.reclaim_usm_mem(small);
+
+    // A block released with the events of a command is reused once the
+    // command is complete
+    auto fill_event = q.fill(mem, scalar_t{0}, size);
+    pool.release_usm_mem({fill_event}, mem);
+    fill_event.wait();
+    pool.trim();
+    ASSERT_EQ(pool.acquire_usm_mem<scalar_t>(size), mem);
+    pool.reclaim_usm_mem(mem);
+
+    check_concurrent_usm<scalar_t>(pool, size);
+  } else
+#endif
+  {
+    // The buffers are less than twice the requested size
+    const size_t byte_size = size * sizeof(scalar_t);
+    auto mem = pool.acquire_buff_mem<scalar_t>(size);
+    const size_t pool_byte_size = mem.get_buffer().byte_size();
+    ASSERT_GE(pool_byte_size, byte_size);
+    ASSERT_LT(pool_byte_size, std::max<size_t>(2 * byte_size, 512));
+    pool.reclaim_buff_mem(mem);
+    auto reused = pool.acquire_buff_mem<scalar_t>(size);
+    ASSERT_EQ(reused.get_buffer().byte_size(), pool_byte_size);
+    pool.reclaim_buff_mem(reused);
+  }
+
+  check_limits<scalar_t, mem_alloc>(q, size);
+  check_thread_exit<scalar_t, mem_alloc>(q);
+
+  // Repeated calls of an operation using temporary memory from the pool
+  const index_t m = size;
+  const index_t n = 33;
+  std::vector<scalar_t> a_m(m * n);
+  std::vector<scalar_t> x_v(m);
+  std::vector<scalar_t> y_v(n);
+  std::vector<scalar_t> y_cpu_v(n);
+  fill_random(a_m);
+  fill_random(x_v);
+  reference_blas::gemv("t", m, n, scalar_t{1}, a_m.data(), m, x_v.data(), 1,
+                       scalar_t{0}, y_cpu_v.data(), 1);
+
+  blas::SB_Handle sb_handle(&pool);
+  auto m_a_gpu = helper::allocate<mem_alloc, scalar_t>(m * n, q);
+  auto v_x_gpu = helper::allocate<mem_alloc, scalar_t>(m, q);
+  auto v_y_gpu = helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto copy_m = helper::copy_to_device(q, a_m.data(), m_a_gpu, m * n);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), v_x_gpu, m);
+  sb_handle.wait({copy_m, copy_x});
+
+  for (int i = 0; i < 3; ++i) {
+    auto gemv_event = _gemv(sb_handle, 't', m, n, scalar_t{1}, m_a_gpu, m,
+                            v_x_gpu, index_t{1}, scalar_t{0}, v_y_gpu,
+                            index_t{1});
+    sb_handle.wait(gemv_event);
+    auto event = helper::copy_to_host(q, v_y_gpu, y_v.data(), n);
+    sb_handle.wait(event);
+    ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  }
+
+  helper::deallocate<mem_alloc>(m_a_gpu, q);
+  helper::deallocate<mem_alloc>(v_x_gpu, q);
+  helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(100, 100000)    // size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size;
+  BLAS_GENERATE_NAME(info.param, alloc, size);
+}
+
+BLAS_REGISTER_TEST_ALL(TempMemoryPool, combination_t, combi, generate_name);
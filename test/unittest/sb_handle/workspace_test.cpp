@@ -0,0 +1,175 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  portBLAS: BLAS implementation using SYCL
+ *
+ *  @filename workspace_test.cpp
+ *
+ **************************************************************************/
+
+#include <algorithm>
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, index_t>;
+
+template <helper::AllocType mem_alloc, typename container_t>
+blas::Workspace make_workspace(container_t mem, size_t byte_size) {
+#ifdef SB_ENABLE_USM
+  if constexpr (mem_alloc == helper::AllocType::usm) {
+    return blas::Workspace(mem, byte_size);
+  } else
+#endif
+  {
+    return blas::Workspace(mem.get_buffer());
+  }
+}
+
+template <typename scalar_t, helper::AllocType mem_alloc>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  // Transposed gemv, using a temporary buffer for the dot products
+  const index_t m = size;
+  const index_t n = 33;
+  std::vector<scalar_t> a_m(m * n);
+  std::vector<scalar_t> x_v(m);
+  std::vector<scalar_t> y_v(n);
+  std::vector<scalar_t> y_cpu_v(n);
+  fill_random(a_m);
+  fill_random(x_v);
+  reference_blas::gemv("t", m, n, scalar_t{1}, a_m.data(), m, x_v.data(), 1,
+                       scalar_t{0}, y_cpu_v.data(), 1);
+
+  // Left lower trsm, using temporary buffers for invA and X
+  const index_t k = 33;
+  const scalar_t alpha{2};
+  std::vector<scalar_t> t_m(k * k);
+  std::vector<scalar_t> b_m(k * size);
+  fill_trsm_matrix(t_m, k, k, 'l', random_scalar(scalar_t{1}, scalar_t{10}));
+  fill_random(b_m);
+  std::vector<scalar_t> b_cpu_m = b_m;
+  reference_blas::trsm("l", "l", "n", "n", k, size, alpha, t_m.data(), k,
+                       b_cpu_m.data(), k);
+
+  auto q = make_queue();
+  blas::Temp_Mem_Pool pool(q);
+  blas::SB_Handle sb_handle(&pool);
+
+  auto m_a_gpu = helper::allocate<mem_alloc, scalar_t>(m * n, q);
+  auto v_x_gpu = helper::allocate<mem_alloc, scalar_t>(m, q);
+  auto v_y_gpu = helper::allocate<mem_alloc, scalar_t>(n, q);
+  auto m_t_gpu = helper::allocate<mem_alloc, scalar_t>(k * k, q);
+  auto m_b_gpu = helper::allocate<mem_alloc, scalar_t>(k * size, q);
+
+  // The queries neither allocate nor submit anything
+  const size_t gemv_byte_size = _gemv_workspace_size(
+      sb_handle, 't', m, n, scalar_t{1}, m_a_gpu, m, v_x_gpu, index_t{1},
+      scalar_t{0}, v_y_gpu, index_t{1});
+  const size_t trsm_byte_size =
+      _trsm_workspace_size(sb_handle, 'l', 'l', 'n', 'n', k, size, alpha,
+                           m_t_gpu, k, m_b_gpu, k);
+  ASSERT_GE(gemv_byte_size, n * sizeof(scalar_t));
+  ASSERT_GE(trsm_byte_size, k * size * sizeof(scalar_t));
+  ASSERT_EQ(gemv_byte_size % blas::Workspace::alignment, size_t{0});
+  ASSERT_EQ(trsm_byte_size % blas::Workspace::alignment, size_t{0});
+
+  auto copy_a = helper::copy_to_device(q, a_m.data(), m_a_gpu, m * n);
+  auto copy_x = helper::copy_to_device(q, x_v.data(), v_x_gpu, m);
+  auto copy_t = helper::copy_to_device(q, t_m.data(), m_t_gpu, k * k);
+  auto copy_b = helper::copy_to_device(q, b_m.data(), m_b_gpu, k * size);
+  sb_handle.wait({copy_a, copy_x, copy_t, copy_b});
+
+  // A single workspace reused by both operations
+  const size_t byte_size = std::max(gemv_byte_size, trsm_byte_size);
+  auto workspace_mem = helper::allocate<mem_alloc, int8_t>(byte_size, q);
+  auto workspace = make_workspace<mem_alloc>(workspace_mem, byte_size);
+
+  auto gemv_event =
+      _gemv(sb_handle, 't', m, n, scalar_t{1}, m_a_gpu, m, v_x_gpu, index_t{1},
+            scalar_t{0}, v_y_gpu, index_t{1}, workspace);
+  sb_handle.wait(gemv_event);
+  auto trsm_event = _trsm(sb_handle, 'l', 'l', 'n', 'n', k, size, alpha,
+                          m_t_gpu, k, m_b_gpu, k, workspace);
+  sb_handle.wait(trsm_event);
+  ASSERT_EQ(workspace.required_byte_size(), byte_size);
+
+  // No temporary memory was taken from the pool
+  const auto stats = pool.get_stats();
+  ASSERT_EQ(stats.hits + stats.misses, size_t{0});
+
+  auto copy_y = helper::copy_to_host(q, v_y_gpu, y_v.data(), n);
+  auto copy_b_back = helper::copy_to_host(q, m_b_gpu, b_m.data(), k * size);
+  sb_handle.wait({copy_y, copy_b_back});
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(b_m, b_cpu_m));
+
+  // A workspace too small for the operation is rejected
+  auto small_mem = helper::allocate<mem_alloc, int8_t>(sizeof(scalar_t), q);
+  auto small_workspace =
+      make_workspace<mem_alloc>(small_mem, sizeof(scalar_t));
+  ASSERT_THROW(_gemv(sb_handle, 't', m, n, scalar_t{1}, m_a_gpu, m, v_x_gpu,
+                     index_t{1}, scalar_t{0}, v_y_gpu, index_t{1},
+                     small_workspace),
+               std::bad_alloc);
+
+  helper::deallocate<mem_alloc>(m_a_gpu, q);
+  helper::deallocate<mem_alloc>(v_x_gpu, q);
+  helper::deallocate<mem_alloc>(v_y_gpu, q);
+  helper::deallocate<mem_alloc>(m_t_gpu, q);
+  helper::deallocate<mem_alloc>(m_b_gpu, q);
+  helper::deallocate<mem_alloc>(workspace_mem, q);
+  helper::deallocate<mem_alloc>(small_mem, q);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string alloc;
+  index_t size;
+  std::tie(alloc, size) = combi;
+
+  if (alloc == "usm") {  // usm alloc
+#ifdef SB_ENABLE_USM
+    run_test<scalar_t, helper::AllocType::usm>(combi);
+#else
+    GTEST_SKIP();
+#endif
+  } else {  // buffer alloc
+    run_test<scalar_t, helper::AllocType::buffer>(combi);
+  }
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values("usm", "buf"),  // allocation type
+                       ::testing::Values(11, 1002)       // size
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  std::string alloc;
+  index_t size;
+  BLAS_GENERATE_NAME(info.param, alloc, size);
+}
+
+BLAS_REGISTER_TEST_ALL(Workspace, combination_t, combi, generate_name);